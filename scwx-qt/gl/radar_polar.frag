@@ -0,0 +1,79 @@
+#version 330 core
+
+// Azimuth and range require full precision
+precision highp float;
+
+#define RANGE_FOLDED 1u
+
+uniform sampler1D  uTexture;
+uniform usampler2D uDataMoments;
+uniform sampler1D  uRadialAzimuths;
+uniform uint  uDataMomentOffset;
+uniform float uDataMomentScale;
+
+uniform float uAzimuthOffset;
+uniform float uGateRange;
+uniform float uGateInterval;
+uniform uint  uSnrThreshold;
+
+in float azimuth;
+in float range;
+
+layout (location = 0) out vec4 fragColor;
+
+// Find the radial containing an azimuth. Radial start azimuths are relative to
+// the first radial, and are followed by the end azimuth of the last radial.
+int findRadial(in float azimuth)
+{
+   float relativeAzimuth = mod(azimuth - uAzimuthOffset, 360.0f);
+   int   radials         = textureSize(uRadialAzimuths, 0) - 1;
+
+   if (radials <= 0 ||
+       relativeAzimuth >= texelFetch(uRadialAzimuths, radials, 0).r)
+   {
+      return -1;
+   }
+
+   int low  = 0;
+   int high = radials - 1;
+
+   while (low < high)
+   {
+      int mid = (low + high + 1) / 2;
+
+      if (texelFetch(uRadialAzimuths, mid, 0).r <= relativeAzimuth)
+      {
+         low = mid;
+      }
+      else
+      {
+         high = mid - 1;
+      }
+   }
+
+   return low;
+}
+
+void main()
+{
+   ivec2 size   = textureSize(uDataMoments, 0);
+   int   gate   = int(floor((range - uGateRange) / uGateInterval));
+   int   radial = findRadial(azimuth);
+
+   if (gate < 0 || gate >= size.x || radial < 0 || radial >= size.y)
+   {
+      discard;
+   }
+
+   uint dataMoment = texelFetch(uDataMoments, ivec2(gate, radial), 0).r;
+
+   if (dataMoment < uSnrThreshold && dataMoment != RANGE_FOLDED)
+   {
+      discard;
+   }
+
+   float texCoord =
+      (float(dataMoment) - float(uDataMomentOffset)) / uDataMomentScale;
+
+   fragColor = texture(uTexture, texCoord);
+}
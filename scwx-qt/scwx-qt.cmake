@@ -20,7 +20,6 @@ find_package(geos)
 find_package(glm)
 find_package(OpenGL REQUIRED)
 find_package(Python COMPONENTS Interpreter)
-find_package(SQLite3)
 
 find_package(QT NAMES Qt6
              COMPONENTS Gui
@@ -401,11 +400,16 @@ set(HDR_UI_WIDGETS source/scwx/qt/ui/widgets/focused_combo_box.hpp
 set(SRC_UI_WIDGETS source/scwx/qt/ui/widgets/imgui_button.cpp)
 set(HDR_UTIL source/scwx/qt/util/color.hpp
              source/scwx/qt/util/file.hpp
+             source/scwx/qt/util/geographic_area_index.hpp
              source/scwx/qt/util/geographic_lib.hpp
              source/scwx/qt/util/imgui.hpp
              source/scwx/qt/util/json.hpp
+             source/scwx/qt/util/loop_prefetch.hpp
              source/scwx/qt/util/maplibre.hpp
+             source/scwx/qt/util/moment_kernels.hpp
              source/scwx/qt/util/network.hpp
+             source/scwx/qt/util/polar_coordinate_table.hpp
+             source/scwx/qt/util/spatial_index.hpp
              source/scwx/qt/util/streams.hpp
              source/scwx/qt/util/texture_atlas.hpp
              source/scwx/qt/util/q_color_modulate.hpp
@@ -416,11 +420,16 @@ set(HDR_UTIL source/scwx/qt/util/color.hpp
              source/scwx/qt/util/tooltip.hpp)
 set(SRC_UTIL source/scwx/qt/util/color.cpp
              source/scwx/qt/util/file.cpp
+             source/scwx/qt/util/geographic_area_index.cpp
              source/scwx/qt/util/geographic_lib.cpp
              source/scwx/qt/util/imgui.cpp
              source/scwx/qt/util/json.cpp
+             source/scwx/qt/util/loop_prefetch.cpp
              source/scwx/qt/util/maplibre.cpp
+             source/scwx/qt/util/moment_kernels.cpp
              source/scwx/qt/util/network.cpp
+             source/scwx/qt/util/polar_coordinate_table.cpp
+             source/scwx/qt/util/spatial_index.cpp
              source/scwx/qt/util/texture_atlas.cpp
              source/scwx/qt/util/q_color_modulate.cpp
              source/scwx/qt/util/q_file_buffer.cpp
@@ -452,6 +461,8 @@ set(SHADER_FILES gl/color.frag
                  gl/map_color.vert
                  gl/radar.frag
                  gl/radar.vert
+                 gl/radar_polar.frag
+                 gl/radar_polar.vert
                  gl/texture1d.frag
                  gl/texture1d.vert
                  gl/texture2d.frag
@@ -473,7 +484,7 @@ set(ZONE_DBF_FILES   ${SCWX_DIR}/data/db/fz18mr25.dbf
                      ${SCWX_DIR}/data/db/z_18mr25.dbf)
 set(STATE_DBF_FILES  ${SCWX_DIR}/data/db/s_18mr25.dbf)
 set(WFO_DBF_FILES    ${SCWX_DIR}/data/db/w_18mr25.dbf)
-set(COUNTIES_SQLITE_DB ${scwx-qt_BINARY_DIR}/res/db/counties.db)
+set(COUNTIES_INDEX   ${scwx-qt_BINARY_DIR}/res/db/counties.idx)
 
 set(RESOURCE_INPUT  ${scwx-qt_SOURCE_DIR}/res/scwx-qt.rc.in)
 set(RESOURCE_OUTPUT ${scwx-qt_BINARY_DIR}/res/scwx-qt.rc)
@@ -572,14 +583,14 @@ add_library(scwx-qt OBJECT ${PROJECT_SOURCES})
 set_property(TARGET scwx-qt PROPERTY AUTOMOC ON)
 set_property(TARGET scwx-qt PROPERTY AUTOGEN_ORIGIN_DEPENDS OFF)
 
-add_custom_command(OUTPUT  ${COUNTIES_SQLITE_DB}
+add_custom_command(OUTPUT  ${COUNTIES_INDEX}
                    COMMAND ${Python_EXECUTABLE}
                            ${scwx-qt_SOURCE_DIR}/tools/generate_counties_db.py
                            -c ${COUNTY_DBF_FILES}
                            -z ${ZONE_DBF_FILES}
                            -s ${STATE_DBF_FILES}
                            -w ${WFO_DBF_FILES}
-                           -o ${COUNTIES_SQLITE_DB}
+                           -o ${COUNTIES_INDEX}
                    DEPENDS ${scwx-qt_SOURCE_DIR}/tools/generate_counties_db.py
                            ${COUNTY_DB_FILES}
                            ${STATE_DBF_FILES}
@@ -587,7 +598,7 @@ add_custom_command(OUTPUT  ${COUNTIES_SQLITE_DB}
                            ${WFO_DBF_FILES})
 
 add_custom_target(scwx-qt_generate_counties_db ALL
-                  DEPENDS ${COUNTIES_SQLITE_DB})
+                  DEPENDS ${COUNTIES_INDEX})
 
 add_dependencies(scwx-qt scwx-qt_generate_counties_db)
 
@@ -632,10 +643,12 @@ add_custom_target(scwx-qt_update_radar_sites
                           -u ${RADAR_SITES_FILE}
                           -t -w)
 
+# The counties index is left uncompressed, so it can be read in place
 qt_add_resources(scwx-qt "generated"
                  PREFIX  "/"
                  BASE    ${scwx-qt_BINARY_DIR}
-                 FILES   ${COUNTIES_SQLITE_DB})
+                 OPTIONS --no-compress
+                 FILES   ${COUNTIES_INDEX})
 
 qt_add_translations(scwx-qt TS_FILES ${TS_FILES}
                     INCLUDE_DIRECTORIES true
@@ -801,7 +814,6 @@ target_link_libraries(scwx-qt PUBLIC Qt${QT_VERSION_MAJOR}::Widgets
                                      imgui
                                      qt6ct-common
                                      qt6ct-widgets
-                                     SQLite::SQLite3
                                      wxdata)
 
 target_link_libraries(supercell-wx PRIVATE scwx-qt
@@ -1,14 +1,16 @@
 #include <scwx/qt/config/county_database.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <optional>
+#include <string_view>
 #include <unordered_map>
+#include <utility>
 
-#include <boost/uuid/uuid.hpp>
-#include <boost/uuid/uuid_generators.hpp>
-#include <boost/uuid/uuid_io.hpp>
-#include <QFile>
-#include <QStandardPaths>
-#include <sqlite3.h>
+#include <QResource>
 
 namespace scwx
 {
@@ -22,223 +24,235 @@ namespace CountyDatabase
 static const std::string logPrefix_ = "scwx::qt::config::county_database";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
-static const std::string countyDatabaseFilename_ = ":/res/db/counties.db";
+static const std::string countyIndexFilename_ = ":/res/db/counties.idx";
+
+// Index format, generated by tools/generate_counties_db.py (little endian):
+//   Header:  magic (8 bytes), county count, state count, WFO count, string
+//            table size (uint32 each)
+//   Records: counties, states, then WFOs, each table sorted by key
+//   Strings: UTF-8 string table referenced by the records
+static constexpr std::array<char, 8> kIndexMagic_ {
+   'S', 'C', 'W', 'X', 'C', 'T', 'Y', '1'};
+static constexpr std::size_t kHeaderSize_ = kIndexMagic_.size() + 16;
+
+// Record: key offset, value offset (uint32), key size, value size (uint16)
+static constexpr std::size_t kRecordSize_      = 12;
+static constexpr std::size_t kKeyOffsetField_  = 0;
+static constexpr std::size_t kValOffsetField_  = 4;
+static constexpr std::size_t kKeySizeField_    = 8;
+static constexpr std::size_t kValSizeField_    = 10;
+
+struct IndexTable
+{
+   const std::uint8_t* records_ {nullptr};
+   std::size_t         size_ {0};
+};
 
-typedef std::unordered_map<std::string, std::string> CountyMap;
-typedef std::unordered_map<std::string, CountyMap>   StateMap;
-typedef std::unordered_map<char, StateMap>           FormatMap;
+static bool             initialized_ {false};
+static QByteArray       indexData_ {};
+static std::string_view strings_ {};
+static IndexTable       counties_ {};
+static IndexTable       states_ {};
+static IndexTable       wfos_ {};
 
-static bool                                         initialized_ {false};
-static FormatMap                                    countyDatabase_;
 static std::unordered_map<std::string, std::string> stateMap_;
 static std::unordered_map<std::string, std::string> wfoMap_;
 
-void Initialize()
+template<typename T>
+static T ReadValue(const std::uint8_t* data)
 {
-   if (initialized_)
+   T value {};
+   std::memcpy(&value, data, sizeof(T));
+
+   if constexpr (std::endian::native == std::endian::big)
    {
-      return;
+      auto bytes = reinterpret_cast<std::uint8_t*>(&value);
+      std::reverse(bytes, bytes + sizeof(T));
    }
 
-   logger_->debug("Loading database");
+   return value;
+}
 
-   // Generate UUID for temporary file
-   boost::uuids::uuid uuid = boost::uuids::random_generator()();
+// Offsets and sizes are validated against the string table on load
+static std::string_view GetKey(const IndexTable& table, std::size_t i)
+{
+   const std::uint8_t* record = table.records_ + i * kRecordSize_;
+   return strings_.substr(ReadValue<std::uint32_t>(record + kKeyOffsetField_),
+                          ReadValue<std::uint16_t>(record + kKeySizeField_));
+}
 
-   std::string tempPath {
-      QStandardPaths::writableLocation(QStandardPaths::TempLocation)
-         .toStdString()};
-   std::string countyDatabaseCache {tempPath + "/scwx-" +
-                                    boost::uuids::to_string(uuid)};
+static std::string_view GetValue(const IndexTable& table, std::size_t i)
+{
+   const std::uint8_t* record = table.records_ + i * kRecordSize_;
+   return strings_.substr(ReadValue<std::uint32_t>(record + kValOffsetField_),
+                          ReadValue<std::uint16_t>(record + kValSizeField_));
+}
+
+static std::size_t LowerBound(const IndexTable& table, std::string_view key)
+{
+   // Binary search for the first record with a key not less than key
+   std::size_t first = 0;
+   std::size_t count = table.size_;
 
-   // Create cache directory if it doesn't exist
-   if (!std::filesystem::exists(tempPath))
+   while (count > 0)
    {
-      if (!std::filesystem::create_directories(tempPath))
+      const std::size_t step = count / 2;
+      const std::size_t i    = first + step;
+
+      if (GetKey(table, i) < key)
       {
-         logger_->error("Unable to create temp directory: \"{}\"", tempPath);
-         return;
+         first = i + 1;
+         count -= step + 1;
+      }
+      else
+      {
+         count = step;
       }
    }
 
-   // Remove existing county database if it exists
-   if (std::filesystem::exists(countyDatabaseCache))
+   return first;
+}
+
+static std::optional<std::string_view> Find(const IndexTable& table,
+                                            std::string_view  key)
+{
+   const std::size_t i = LowerBound(table, key);
+
+   if (i < table.size_ && GetKey(table, i) == key)
    {
-      std::filesystem::remove(countyDatabaseCache);
+      return GetValue(table, i);
    }
 
-   // Create a fresh copy of the county database in the temporary directory
-   QFile countyDatabaseFile(QString::fromStdString(countyDatabaseFilename_));
-   if (!countyDatabaseFile.copy(QString::fromStdString(countyDatabaseCache)))
+   return std::nullopt;
+}
+
+static std::unordered_map<std::string, std::string>
+ToMap(const IndexTable& table)
+{
+   std::unordered_map<std::string, std::string> map {};
+   map.reserve(table.size_);
+
+   for (std::size_t i = 0; i < table.size_; ++i)
    {
-      logger_->error("Unable to create cached copy of database: \"{}\" ({})",
-                     countyDatabaseCache,
-                     countyDatabaseFile.errorString().toStdString());
-      return;
+      map.emplace(GetKey(table, i), GetValue(table, i));
    }
 
-   // Open database
-   sqlite3* db;
-   int      rc;
-   char*    errorMessage = nullptr;
+   return map;
+}
 
-   rc = sqlite3_open(countyDatabaseCache.c_str(), &db);
-   if (rc != SQLITE_OK)
+static bool ValidateTable(const IndexTable& table)
+{
+   for (std::size_t i = 0; i < table.size_; ++i)
    {
-      logger_->error("Unable to open database: \"{}\"", countyDatabaseCache);
-      sqlite3_close(db);
-      std::filesystem::remove(countyDatabaseCache);
-      return;
-   }
+      const std::uint8_t* record = table.records_ + i * kRecordSize_;
 
-   // Ensure counties exists
-   countyDatabase_.emplace('C', StateMap {});
-
-   // Query database for counties
-   rc = sqlite3_exec(
-      db,
-      "SELECT * FROM counties",
-      [](void* /* param */,
-         int    columns,
-         char** columnText,
-         char** /* columnName */) -> int
+      for (auto [offsetField, sizeField] :
+           {std::pair {kKeyOffsetField_, kKeySizeField_},
+            std::pair {kValOffsetField_, kValSizeField_}})
       {
-         int status = 0;
+         const std::size_t offset =
+            ReadValue<std::uint32_t>(record + offsetField);
+         const std::size_t size = ReadValue<std::uint16_t>(record + sizeField);
 
-         if (columns == 2 && std::strlen(columnText[0]) == 6)
+         if (offset > strings_.size() || size > strings_.size() - offset)
          {
-            std::string fipsId = columnText[0];
-            std::string state  = fipsId.substr(0, 2);
-            char        type   = fipsId.at(2);
-
-            countyDatabase_[type][state].emplace(fipsId, columnText[1]);
-         }
-         else if (columns != 2)
-         {
-            logger_->error(
-               "County database format error, invalid number of columns: {}",
-               columns);
-            status = -1;
-         }
-         else
-         {
-            logger_->error("Invalid FIPS ID: {}", columnText[0]);
-            status = -1;
+            return false;
          }
+      }
+   }
+
+   return true;
+}
 
-         return status;
-      },
-      nullptr,
-      &errorMessage);
-   if (rc != SQLITE_OK)
+void Initialize()
+{
+   if (initialized_)
    {
-      logger_->error("SQL error: {}", errorMessage);
-      sqlite3_free(errorMessage);
+      return;
    }
 
-   // Query database for states
-   rc = sqlite3_exec(
-      db,
-      "SELECT * FROM states",
-      [](void* /* param */,
-         int    columns,
-         char** columnText,
-         char** /* columnName */) -> int
-      {
-         int status = 0;
+   logger_->debug("Loading database");
 
-         if (columns == 2)
-         {
-            stateMap_.emplace(columnText[0], columnText[1]);
-         }
-         else
-         {
-            logger_->error(
-               "State database format error, invalid number of columns: {}",
-               columns);
-            status = -1;
-         }
+   // Uncompressed resources are referenced in place, without a copy
+   QResource resource {QString::fromStdString(countyIndexFilename_)};
+   if (!resource.isValid())
+   {
+      logger_->error("Unable to open database: \"{}\"", countyIndexFilename_);
+      return;
+   }
 
-         return status;
-      },
-      nullptr,
-      &errorMessage);
-   if (rc != SQLITE_OK)
+   if (resource.compressionAlgorithm() == QResource::Compression::NoCompression)
    {
-      logger_->error("SQL error: {}", errorMessage);
-      sqlite3_free(errorMessage);
+      indexData_ = QByteArray::fromRawData(
+         reinterpret_cast<const char*>(resource.data()),
+         static_cast<qsizetype>(resource.size()));
+   }
+   else
+   {
+      indexData_ = resource.uncompressedData();
    }
 
-   // Query database for WFOs
-   rc = sqlite3_exec(
-      db,
-      "SELECT id, city_state FROM wfos",
-      [](void* /* param */,
-         int    columns,
-         char** columnText,
-         char** /* columnName */) -> int
-      {
-         int status = 0;
+   const auto data = reinterpret_cast<const std::uint8_t*>(indexData_.data());
+   const auto size = static_cast<std::size_t>(indexData_.size());
 
-         if (columns == 2)
-         {
-            wfoMap_.emplace(columnText[0], columnText[1]);
-         }
-         else
-         {
-            logger_->error(
-               "WFO database format error, invalid number of columns: {}",
-               columns);
-            status = -1;
-         }
+   if (size < kHeaderSize_ ||
+       !std::equal(kIndexMagic_.cbegin(), kIndexMagic_.cend(), data))
+   {
+      logger_->error("Invalid database header");
+      indexData_.clear();
+      return;
+   }
 
-         return status;
-      },
-      nullptr,
-      &errorMessage);
-   if (rc != SQLITE_OK)
+   const std::uint8_t* header = data + kIndexMagic_.size();
+
+   const std::size_t countyCount = ReadValue<std::uint32_t>(header);
+   const std::size_t stateCount  = ReadValue<std::uint32_t>(header + 4);
+   const std::size_t wfoCount    = ReadValue<std::uint32_t>(header + 8);
+   const std::size_t stringsSize = ReadValue<std::uint32_t>(header + 12);
+
+   const std::size_t recordsSize =
+      (countyCount + stateCount + wfoCount) * kRecordSize_;
+
+   if (size != kHeaderSize_ + recordsSize + stringsSize)
    {
-      logger_->error("SQL error: {}", errorMessage);
-      sqlite3_free(errorMessage);
+      logger_->error("Invalid database size: {}", size);
+      indexData_.clear();
+      return;
    }
 
-   // Close database
-   sqlite3_close(db);
+   const std::uint8_t* records = data + kHeaderSize_;
 
-   // Remove temporary file
-   std::error_code error;
-   if (!std::filesystem::remove(countyDatabaseCache, error))
+   counties_ = {records, countyCount};
+   states_   = {counties_.records_ + countyCount * kRecordSize_, stateCount};
+   wfos_     = {states_.records_ + stateCount * kRecordSize_, wfoCount};
+   strings_  = {reinterpret_cast<const char*>(records + recordsSize),
+                stringsSize};
+
+   if (!ValidateTable(counties_) || !ValidateTable(states_) ||
+       !ValidateTable(wfos_))
    {
-      logger_->warn("Unable to remove cached copy of database: {}",
-                    error.message());
+      logger_->error("Invalid database record");
+      counties_ = {};
+      states_   = {};
+      wfos_     = {};
+      strings_  = {};
+      indexData_.clear();
+      return;
    }
 
+   // States and WFOs are few, and are exposed as maps
+   stateMap_ = ToMap(states_);
+   wfoMap_   = ToMap(wfos_);
+
    initialized_ = true;
 }
 
 std::string GetCountyName(const std::string& id)
 {
-   if (id.length() > 3)
+   auto name = Find(counties_, id);
+   if (name.has_value())
    {
-      // SSFNNN
-      char        format = id.at(2);
-      std::string state  = id.substr(0, 2);
-
-      auto stateIt = countyDatabase_.find(format);
-      if (stateIt != countyDatabase_.cend())
-      {
-         StateMap& states   = stateIt->second;
-         auto      countyIt = states.find(state);
-         if (countyIt != states.cend())
-         {
-            CountyMap& counties = countyIt->second;
-            auto       it       = counties.find(id);
-            if (it != counties.cend())
-            {
-               return it->second;
-            }
-         }
-      }
+      return std::string {*name};
    }
 
    return id;
@@ -249,11 +263,14 @@ GetCounties(const std::string& state)
 {
    std::unordered_map<std::string, std::string> counties {};
 
-   StateMap& states = countyDatabase_.at('C');
-   auto      it     = states.find(state);
-   if (it != states.cend())
+   // County IDs are in the format SSCNNN, and are contiguous for each state
+   const std::string prefix = state + 'C';
+
+   for (std::size_t i = LowerBound(counties_, prefix);
+        i < counties_.size_ && GetKey(counties_, i).starts_with(prefix);
+        ++i)
    {
-      counties = it->second;
+      counties.emplace(GetKey(counties_, i), GetValue(counties_, i));
    }
 
    return counties;
@@ -269,15 +286,15 @@ const std::unordered_map<std::string, std::string>& GetWFOs()
    return wfoMap_;
 }
 
-const std::string& GetWFOName(const std::string& wfoId)
+std::string GetWFOName(const std::string& wfoId)
 {
-   auto wfo = wfoMap_.find(wfoId);
-   if (wfo == wfoMap_.end())
+   auto name = Find(wfos_, wfoId);
+   if (name.has_value())
    {
-      return wfoId;
+      return std::string {*name};
    }
 
-   return wfo->second;
+   return wfoId;
 }
 
 } // namespace CountyDatabase
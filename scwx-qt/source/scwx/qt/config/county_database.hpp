@@ -20,7 +20,7 @@ std::unordered_map<std::string, std::string>
 GetCounties(const std::string& state);
 const std::unordered_map<std::string, std::string>& GetStates();
 const std::unordered_map<std::string, std::string>& GetWFOs();
-const std::string& GetWFOName(const std::string& wfoId);
+std::string GetWFOName(const std::string& wfoId);
 
 } // namespace CountyDatabase
 } // namespace config
@@ -1,12 +1,13 @@
 #include <scwx/qt/gl/draw/geo_icons.hpp>
 #include <scwx/qt/types/icon_types.hpp>
 #include <scwx/qt/util/maplibre.hpp>
+#include <scwx/qt/util/spatial_index.hpp>
 #include <scwx/qt/util/texture_atlas.hpp>
 #include <scwx/qt/util/tooltip.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/util/time.hpp>
 
-#include <execution>
+#include <algorithm>
 
 #include <boost/unordered/unordered_flat_map.hpp>
 #include <boost/unordered/unordered_flat_set.hpp>
@@ -90,6 +91,8 @@ public:
                                   std::vector<float>&          iconBuffer,
                                   std::vector<GLint>&          integerBuffer,
                                   std::vector<IconHoverEntry>& hoverIcons);
+   static void UpdateHoverIndex(const std::vector<IconHoverEntry>& hoverIcons,
+                                util::SpatialIndex&                hoverIndex);
    void        UpdateTextureBuffer();
    void        UpdateModifiedIconBuffers();
    void        Update(bool textureAtlasChanged);
@@ -126,6 +129,13 @@ public:
    std::vector<IconHoverEntry> currentHoverIcons_ {};
    std::vector<IconHoverEntry> newHoverIcons_ {};
 
+   // Index of hover icons in map screen coordinates. The current index is
+   // rebuilt on demand after the current hover icons are modified.
+   util::SpatialIndex       currentHoverIndex_ {};
+   util::SpatialIndex       newHoverIndex_ {};
+   std::vector<std::size_t> hoverCandidates_ {};
+   bool                     hoverIndexDirty_ {false};
+
    std::shared_ptr<ShaderProgram> shaderProgram_;
 
    GLint uMVPMatrixLocation_ {static_cast<GLint>(GL_INVALID_INDEX)};
@@ -337,6 +347,8 @@ void GeoIcons::Deinitialize()
    p->currentIconList_.clear();
    p->currentIconSheets_.clear();
    p->currentHoverIcons_.clear();
+   p->currentHoverIndex_.Clear();
+   p->hoverIndexDirty_ = false;
    p->currentIconBuffer_.clear();
    p->currentIntegerBuffer_.clear();
    p->textureBuffer_.clear();
@@ -511,6 +523,7 @@ void GeoIcons::FinishIcons()
 {
    // Update buffers
    p->UpdateBuffers();
+   p->UpdateHoverIndex(p->newHoverIcons_, p->newHoverIndex_);
 
    std::unique_lock lock {p->iconMutex_};
 
@@ -519,6 +532,8 @@ void GeoIcons::FinishIcons()
    p->currentIconBuffer_.swap(p->newIconBuffer_);
    p->currentIntegerBuffer_.swap(p->newIntegerBuffer_);
    p->currentHoverIcons_.swap(p->newHoverIcons_);
+   std::swap(p->currentHoverIndex_, p->newHoverIndex_);
+   p->hoverIndexDirty_ = false;
 
    // Clear the new buffers, except the full icon list (used to update buffers
    // without re-adding icons)
@@ -526,6 +541,7 @@ void GeoIcons::FinishIcons()
    p->newIconBuffer_.clear();
    p->newIntegerBuffer_.clear();
    p->newHoverIcons_.clear();
+   p->newHoverIndex_.Clear();
 
    // Mark the draw item dirty
    p->dirty_ = true;
@@ -840,8 +856,25 @@ void GeoIcons::Impl::UpdateModifiedIconBuffers()
    if (!dirtyIcons_.empty())
    {
       dirtyIcons_.clear();
-      dirty_ = true;
+      dirty_           = true;
+      hoverIndexDirty_ = true;
+   }
+}
+
+void GeoIcons::Impl::UpdateHoverIndex(
+   const std::vector<IconHoverEntry>& hoverIcons,
+   util::SpatialIndex&                hoverIndex)
+{
+   std::vector<util::SpatialIndex::Bounds> bounds {};
+   bounds.reserve(hoverIcons.size());
+
+   for (auto& icon : hoverIcons)
+   {
+      bounds.push_back(util::SpatialIndex::CreateBounds(
+         {icon.p_}, {icon.otl_, icon.otr_, icon.obl_, icon.obr_}));
    }
+
+   hoverIndex.Build(bounds);
 }
 
 void GeoIcons::Impl::Update(bool textureAtlasChanged)
@@ -930,13 +963,28 @@ bool GeoIcons::RunMousePicking(
          scwx::util::time::now() :
          p->selectedTime_;
 
-   // For each pickable icon
+   // Rebuild the hover index if the hover icons have been modified
+   if (p->hoverIndexDirty_)
+   {
+      p->UpdateHoverIndex(p->currentHoverIcons_, p->currentHoverIndex_);
+      p->hoverIndexDirty_ = false;
+   }
+
+   // Offsets in pixels are scaled by up to the largest map scale component
+   const float pixelScale = std::max(std::abs(scale.x), std::abs(scale.y));
+
+   // Find the icons near the mouse
+   p->currentHoverIndex_.Query(mouseCoords, pixelScale, p->hoverCandidates_);
+
+   // For each pickable icon, beginning with the last icon drawn
    auto it = std::find_if(
-      std::execution::par_unseq,
-      p->currentHoverIcons_.crbegin(),
-      p->currentHoverIcons_.crend(),
-      [&mapDistance, &selectedTime, &mapMatrix, &mouseCoords](const auto& icon)
+      p->hoverCandidates_.crbegin(),
+      p->hoverCandidates_.crend(),
+      [this, &mapDistance, &selectedTime, &mapMatrix, &mouseCoords](
+         std::size_t index)
       {
+         const auto& icon = p->currentHoverIcons_[index];
+
          if ((
                 // Geo icon is thresholded
                 mapDistance > units::length::meters<double> {0.0} &&
@@ -990,17 +1038,19 @@ bool GeoIcons::RunMousePicking(
          return util::maplibre::IsPointInPolygon({tl, bl, br, tr}, mouseCoords);
       });
 
-   if (it != p->currentHoverIcons_.crend())
+   if (it != p->hoverCandidates_.crend())
    {
+      const auto& di = p->currentHoverIcons_[*it].di_;
+
       itemPicked = true;
-      if (!it->di_->hoverText_.empty())
+      if (!di->hoverText_.empty())
       {
          // Show tooltip
-         util::tooltip::Show(it->di_->hoverText_, mouseGlobalPos);
+         util::tooltip::Show(di->hoverText_, mouseGlobalPos);
       }
-      if (it->di_->event_ != nullptr)
+      if (di->event_ != nullptr)
       {
-         eventHandler = it->di_;
+         eventHandler = di;
       }
    }
 
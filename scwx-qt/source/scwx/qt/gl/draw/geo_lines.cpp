@@ -1,11 +1,12 @@
 #include <scwx/qt/gl/draw/geo_lines.hpp>
 #include <scwx/qt/util/geographic_lib.hpp>
 #include <scwx/qt/util/maplibre.hpp>
+#include <scwx/qt/util/spatial_index.hpp>
 #include <scwx/qt/util/tooltip.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/util/time.hpp>
 
-#include <execution>
+#include <algorithm>
 
 #include <boost/unordered/unordered_flat_set.hpp>
 #include <units/angle.h>
@@ -82,7 +83,13 @@ public:
    void BufferLine(const std::shared_ptr<const GeoLineDrawItem>& di);
    void Update();
    void UpdateBuffers();
+   void UpdateBufferRange(std::size_t lineOffset, std::size_t lineCount);
    void UpdateModifiedLineBuffers();
+   void UpdateHoverIndex(
+      const std::unordered_map<std::shared_ptr<GeoLineDrawItem>,
+                               LineHoverEntry>& hoverLines,
+      std::vector<const LineHoverEntry*>&       hoverIndexLines,
+      util::SpatialIndex&                       hoverIndex);
    void UpdateSingleBuffer(const std::shared_ptr<GeoLineDrawItem>& di,
                            std::vector<float>&                     linesBuffer,
                            std::vector<GLint>&                 integerBuffer,
@@ -97,6 +104,14 @@ public:
 
    boost::unordered_flat_set<std::shared_ptr<GeoLineDrawItem>> dirtyLines_ {};
 
+   // Slots of removed lines, reused by lines added later
+   std::vector<std::size_t> freeLineSlots_ {};
+
+   // Range of modified lines to upload, and the allocated buffer size
+   std::size_t dirtyLineBegin_ {};
+   std::size_t dirtyLineEnd_ {};
+   std::size_t bufferLineCapacity_ {};
+
    std::chrono::system_clock::time_point selectedTime_ {};
 
    std::mutex lineMutex_ {};
@@ -114,6 +129,15 @@ public:
    std::unordered_map<std::shared_ptr<GeoLineDrawItem>, LineHoverEntry>
       newHoverLines_ {};
 
+   // Index of hover lines in map screen coordinates, in line order. The current
+   // index is rebuilt on demand after the current hover lines are modified.
+   util::SpatialIndex                 currentHoverIndex_ {};
+   util::SpatialIndex                 newHoverIndex_ {};
+   std::vector<const LineHoverEntry*> currentHoverIndexLines_ {};
+   std::vector<const LineHoverEntry*> newHoverIndexLines_ {};
+   std::vector<std::size_t>           hoverCandidates_ {};
+   bool                               hoverIndexDirty_ {false};
+
    std::shared_ptr<ShaderProgram> shaderProgram_;
 
    GLint uMVPMatrixLocation_ {static_cast<GLint>(GL_INVALID_INDEX)};
@@ -171,6 +195,7 @@ void GeoLines::Initialize()
                 sizeof(float) * kLineBufferLength_,
                 nullptr,
                 GL_DYNAMIC_DRAW);
+   p->bufferLineCapacity_ = 0u;
 
    // NOLINTBEGIN(modernize-use-nullptr)
    // NOLINTBEGIN(performance-no-int-to-ptr)
@@ -307,6 +332,9 @@ void GeoLines::Deinitialize()
    p->currentLinesBuffer_.clear();
    p->currentIntegerBuffer_.clear();
    p->currentHoverLines_.clear();
+   p->currentHoverIndex_.Clear();
+   p->currentHoverIndexLines_.clear();
+   p->hoverIndexDirty_ = false;
 }
 
 void GeoLines::SetVisible(bool visible)
@@ -321,15 +349,43 @@ void GeoLines::StartLines()
    p->newLinesBuffer_.clear();
    p->newIntegerBuffer_.clear();
    p->newHoverLines_.clear();
+   p->freeLineSlots_.clear();
 }
 
 std::shared_ptr<GeoLineDrawItem> GeoLines::AddLine()
 {
+   if (!p->freeLineSlots_.empty())
+   {
+      // Reuse the slot of a removed line
+      const std::size_t lineIndex = p->freeLineSlots_.back();
+      p->freeLineSlots_.pop_back();
+
+      auto& di       = p->newLineList_[lineIndex];
+      di             = std::make_shared<GeoLineDrawItem>();
+      di->lineIndex_ = lineIndex;
+
+      // The slot must be rewritten, even if the line is never modified
+      p->dirtyLines_.insert(di);
+      return di;
+   }
+
    auto& di = p->newLineList_.emplace_back(std::make_shared<GeoLineDrawItem>());
    di->lineIndex_ = p->newLineList_.size() - 1;
    return di;
 }
 
+void GeoLines::RemoveLine(const std::shared_ptr<GeoLineDrawItem>& di)
+{
+   if (di->lineIndex_ < p->newLineList_.size() &&
+       p->newLineList_[di->lineIndex_] == di)
+   {
+      // Hide the line, and free its slot
+      di->visible_ = false;
+      p->dirtyLines_.insert(di);
+      p->freeLineSlots_.push_back(di->lineIndex_);
+   }
+}
+
 void GeoLines::SetLineLocation(const std::shared_ptr<GeoLineDrawItem>& di,
                                float latitude1,
                                float longitude1,
@@ -440,6 +496,8 @@ void GeoLines::FinishLines()
 {
    // Update buffers
    p->UpdateBuffers();
+   p->UpdateHoverIndex(
+      p->newHoverLines_, p->newHoverIndexLines_, p->newHoverIndex_);
 
    std::unique_lock lock {p->lineMutex_};
 
@@ -448,12 +506,17 @@ void GeoLines::FinishLines()
    p->currentLinesBuffer_.swap(p->newLinesBuffer_);
    p->currentIntegerBuffer_.swap(p->newIntegerBuffer_);
    p->currentHoverLines_.swap(p->newHoverLines_);
+   p->currentHoverIndexLines_.swap(p->newHoverIndexLines_);
+   std::swap(p->currentHoverIndex_, p->newHoverIndex_);
+   p->hoverIndexDirty_ = false;
 
    // Clear the new buffers, except the full line list (used to update buffers
    // without re-adding lines)
    p->newLinesBuffer_.clear();
    p->newIntegerBuffer_.clear();
    p->newHoverLines_.clear();
+   p->newHoverIndexLines_.clear();
+   p->newHoverIndex_.Clear();
 
    // Mark the draw item dirty
    p->dirty_ = true;
@@ -483,6 +546,19 @@ void GeoLines::Impl::UpdateBuffers()
 
 void GeoLines::Impl::UpdateModifiedLineBuffers()
 {
+   // Only synchronize the line list if lines have been added or modified
+   if (dirtyLines_.empty() && currentLineList_.size() == newLineList_.size())
+   {
+      return;
+   }
+
+   // Lines added to the end of the list are uploaded with modified lines
+   if (newLineList_.size() > currentLineList_.size())
+   {
+      UpdateBufferRange(currentLineList_.size(),
+                        newLineList_.size() - currentLineList_.size());
+   }
+
    // Synchronize line list
    currentLineList_ = newLineList_;
    currentLinesBuffer_.resize(currentLineList_.size() * kLineBufferLength_);
@@ -496,19 +572,70 @@ void GeoLines::Impl::UpdateModifiedLineBuffers()
       if (di->lineIndex_ >= currentLineList_.size() ||
           currentLineList_[di->lineIndex_] != di)
       {
+         // A removed line may have had its slot reused, remove its hover entry
+         currentHoverLines_.erase(di);
          continue;
       }
 
       UpdateSingleBuffer(
          di, currentLinesBuffer_, currentIntegerBuffer_, currentHoverLines_);
+      UpdateBufferRange(di->lineIndex_, 1u);
    }
 
    // Clear list of modified lines
    if (!dirtyLines_.empty())
    {
       dirtyLines_.clear();
-      dirty_ = true;
+      hoverIndexDirty_ = true;
+   }
+}
+
+void GeoLines::Impl::UpdateBufferRange(std::size_t lineOffset,
+                                       std::size_t lineCount)
+{
+   if (dirtyLineBegin_ == dirtyLineEnd_)
+   {
+      dirtyLineBegin_ = lineOffset;
+      dirtyLineEnd_   = lineOffset + lineCount;
+   }
+   else
+   {
+      dirtyLineBegin_ = std::min(dirtyLineBegin_, lineOffset);
+      dirtyLineEnd_   = std::max(dirtyLineEnd_, lineOffset + lineCount);
+   }
+}
+
+void GeoLines::Impl::UpdateHoverIndex(
+   const std::unordered_map<std::shared_ptr<GeoLineDrawItem>, LineHoverEntry>&
+                                       hoverLines,
+   std::vector<const LineHoverEntry*>& hoverIndexLines,
+   util::SpatialIndex&                 hoverIndex)
+{
+   hoverIndexLines.clear();
+   hoverIndexLines.reserve(hoverLines.size());
+
+   for (auto& hoverLine : hoverLines)
+   {
+      hoverIndexLines.push_back(&hoverLine.second);
+   }
+
+   // Order hover lines by draw order
+   std::sort(hoverIndexLines.begin(),
+             hoverIndexLines.end(),
+             [](const LineHoverEntry* a, const LineHoverEntry* b)
+             { return a->di_->lineIndex_ < b->di_->lineIndex_; });
+
+   std::vector<util::SpatialIndex::Bounds> bounds {};
+   bounds.reserve(hoverIndexLines.size());
+
+   for (auto& line : hoverIndexLines)
+   {
+      bounds.push_back(util::SpatialIndex::CreateBounds(
+         {line->p1_, line->p2_},
+         {line->otl_, line->otr_, line->obl_, line->obr_}));
    }
+
+   hoverIndex.Build(bounds);
 }
 
 void GeoLines::Impl::UpdateSingleBuffer(
@@ -667,27 +794,77 @@ void GeoLines::Impl::Update()
 {
    UpdateModifiedLineBuffers();
 
-   // If the lines have been updated
+   // If lines were added beyond the allocated buffer size, grow the buffers
+   // with room for additional lines
+   if (currentLineList_.size() > bufferLineCapacity_)
+   {
+      bufferLineCapacity_ =
+         std::max(currentLineList_.size(), bufferLineCapacity_ * 2);
+      dirty_ = true;
+   }
+
+   // If the lines have been replaced, upload all lines
    if (dirty_)
    {
+      bufferLineCapacity_ =
+         std::max(currentLineList_.size(), bufferLineCapacity_);
+
       // Buffer lines data
       glBindBuffer(GL_ARRAY_BUFFER, vbo_[0]);
-      glBufferData(
+      glBufferData(GL_ARRAY_BUFFER,
+                   static_cast<GLsizeiptr>(sizeof(float) * kLineBufferLength_ *
+                                           bufferLineCapacity_),
+                   nullptr,
+                   GL_DYNAMIC_DRAW);
+      glBufferSubData(
          GL_ARRAY_BUFFER,
+         0,
          static_cast<GLsizeiptr>(sizeof(float) * currentLinesBuffer_.size()),
-         currentLinesBuffer_.data(),
-         GL_DYNAMIC_DRAW);
+         currentLinesBuffer_.data());
 
       // Buffer threshold data
       glBindBuffer(GL_ARRAY_BUFFER, vbo_[1]);
-      glBufferData(
+      glBufferData(GL_ARRAY_BUFFER,
+                   static_cast<GLsizeiptr>(sizeof(GLint) *
+                                           kIntegerBufferLength_ *
+                                           bufferLineCapacity_),
+                   nullptr,
+                   GL_DYNAMIC_DRAW);
+      glBufferSubData(
          GL_ARRAY_BUFFER,
+         0,
          static_cast<GLsizeiptr>(sizeof(GLint) * currentIntegerBuffer_.size()),
-         currentIntegerBuffer_.data(),
-         GL_DYNAMIC_DRAW);
+         currentIntegerBuffer_.data());
+   }
+   // Otherwise, upload only the range of modified lines
+   else if (dirtyLineBegin_ < dirtyLineEnd_)
+   {
+      const std::size_t lineCount = dirtyLineEnd_ - dirtyLineBegin_;
+
+      // Buffer lines data
+      glBindBuffer(GL_ARRAY_BUFFER, vbo_[0]);
+      glBufferSubData(
+         GL_ARRAY_BUFFER,
+         static_cast<GLintptr>(sizeof(float) * kLineBufferLength_ *
+                               dirtyLineBegin_),
+         static_cast<GLsizeiptr>(sizeof(float) * kLineBufferLength_ *
+                                 lineCount),
+         &currentLinesBuffer_[kLineBufferLength_ * dirtyLineBegin_]);
+
+      // Buffer threshold data
+      glBindBuffer(GL_ARRAY_BUFFER, vbo_[1]);
+      glBufferSubData(
+         GL_ARRAY_BUFFER,
+         static_cast<GLintptr>(sizeof(GLint) * kIntegerBufferLength_ *
+                               dirtyLineBegin_),
+         static_cast<GLsizeiptr>(sizeof(GLint) * kIntegerBufferLength_ *
+                                 lineCount),
+         &currentIntegerBuffer_[kIntegerBufferLength_ * dirtyLineBegin_]);
    }
 
-   dirty_ = false;
+   dirty_          = false;
+   dirtyLineBegin_ = 0u;
+   dirtyLineEnd_   = 0u;
 }
 
 bool GeoLines::RunMousePicking(
@@ -723,15 +900,29 @@ bool GeoLines::RunMousePicking(
          scwx::util::time::now() :
          p->selectedTime_;
 
-   // For each pickable line
+   // Rebuild the hover index if the hover lines have been modified
+   if (p->hoverIndexDirty_)
+   {
+      p->UpdateHoverIndex(p->currentHoverLines_,
+                          p->currentHoverIndexLines_,
+                          p->currentHoverIndex_);
+      p->hoverIndexDirty_ = false;
+   }
+
+   // Offsets in pixels are scaled by up to the largest map scale component
+   const float pixelScale = std::max(std::abs(scale.x), std::abs(scale.y));
+
+   // Find the lines near the mouse
+   p->currentHoverIndex_.Query(mouseCoords, pixelScale, p->hoverCandidates_);
+
+   // For each pickable line, beginning with the last line drawn
    auto it = std::find_if(
-      std::execution::par_unseq,
-      p->currentHoverLines_.cbegin(),
-      p->currentHoverLines_.cend(),
-      [&mapDistance, &selectedTime, &mapMatrix, &mouseCoords](
-         const auto& lineIt)
+      p->hoverCandidates_.crbegin(),
+      p->hoverCandidates_.crend(),
+      [this, &mapDistance, &selectedTime, &mapMatrix, &mouseCoords](
+         std::size_t index)
       {
-         const auto& line = lineIt.second;
+         const auto& line = *p->currentHoverIndexLines_[index];
          if ((
                 // Placefile is thresholded
                 mapDistance > units::length::meters<double> {0.0} &&
@@ -787,24 +978,26 @@ bool GeoLines::RunMousePicking(
          return util::maplibre::IsPointInPolygon({tl, bl, br, tr}, mouseCoords);
       });
 
-   if (it != p->currentHoverLines_.cend())
+   if (it != p->hoverCandidates_.crend())
    {
+      const auto& di = p->currentHoverIndexLines_[*it]->di_;
+
       itemPicked = true;
 
-      if (!it->second.di_->hoverText_.empty())
+      if (!di->hoverText_.empty())
       {
          // Show tooltip
-         util::tooltip::Show(it->second.di_->hoverText_, mouseGlobalPos);
+         util::tooltip::Show(di->hoverText_, mouseGlobalPos);
       }
-      else if (it->second.di_->hoverCallback_ != nullptr)
+      else if (di->hoverCallback_ != nullptr)
       {
-         it->second.di_->hoverCallback_(it->second.di_, mouseGlobalPos);
+         di->hoverCallback_(di, mouseGlobalPos);
       }
 
-      if (it->second.di_->event_ != nullptr)
+      if (di->event_ != nullptr)
       {
          // Register event handler
-         eventHandler = it->second.di_;
+         eventHandler = di;
       }
    }
 
@@ -65,6 +65,14 @@ public:
     */
    std::shared_ptr<GeoLineDrawItem> AddLine();
 
+   /**
+    * Removes a geo line from the internal draw list. The line is hidden, and
+    * its buffer slot is reused by the next line added.
+    *
+    * @param [in] di Geo line draw item
+    */
+   void RemoveLine(const std::shared_ptr<GeoLineDrawItem>& di);
+
    /**
     * Sets the location of a geo line.
     *
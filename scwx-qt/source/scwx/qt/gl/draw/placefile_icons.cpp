@@ -1,12 +1,11 @@
 #include <scwx/qt/gl/draw/placefile_icons.hpp>
 #include <scwx/qt/util/maplibre.hpp>
+#include <scwx/qt/util/spatial_index.hpp>
 #include <scwx/qt/util/texture_atlas.hpp>
 #include <scwx/qt/util/tooltip.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/util/time.hpp>
 
-#include <execution>
-
 #include <QDir>
 #include <QUrl>
 #include <boost/unordered/unordered_flat_map.hpp>
@@ -89,6 +88,7 @@ public:
    ~Impl() {}
 
    void UpdateBuffers();
+   void UpdateHoverIndex();
    void UpdateTextureBuffer();
    void Update(bool textureAtlasChanged);
 
@@ -122,6 +122,11 @@ public:
    std::vector<IconHoverEntry> currentHoverIcons_ {};
    std::vector<IconHoverEntry> newHoverIcons_ {};
 
+   // Index of hover icons in map screen coordinates
+   util::SpatialIndex       currentHoverIndex_ {};
+   util::SpatialIndex       newHoverIndex_ {};
+   std::vector<std::size_t> hoverCandidates_ {};
+
    std::shared_ptr<ShaderProgram> shaderProgram_;
 
    GLint uMVPMatrixLocation_ {static_cast<GLint>(GL_INVALID_INDEX)};
@@ -319,6 +324,7 @@ void PlacefileIcons::Deinitialize()
    p->currentIconList_.clear();
    p->currentIconFiles_.clear();
    p->currentHoverIcons_.clear();
+   p->currentHoverIndex_.Clear();
    p->currentIconBuffer_.clear();
    p->currentIntegerBuffer_.clear();
    p->textureBuffer_.clear();
@@ -399,6 +405,7 @@ void PlacefileIcons::FinishIcons()
 
    // Update buffers
    p->UpdateBuffers();
+   p->UpdateHoverIndex();
 
    std::unique_lock lock {p->iconMutex_};
 
@@ -408,6 +415,7 @@ void PlacefileIcons::FinishIcons()
    p->currentIconBuffer_.swap(p->newIconBuffer_);
    p->currentIntegerBuffer_.swap(p->newIntegerBuffer_);
    p->currentHoverIcons_.swap(p->newHoverIcons_);
+   std::swap(p->currentHoverIndex_, p->newHoverIndex_);
 
    // Clear the new buffers
    p->newIconList_.clear();
@@ -416,6 +424,7 @@ void PlacefileIcons::FinishIcons()
    p->newIconBuffer_.clear();
    p->newIntegerBuffer_.clear();
    p->newHoverIcons_.clear();
+   p->newHoverIndex_.Clear();
 
    // Mark the draw item dirty
    p->dirty_ = true;
@@ -550,6 +559,20 @@ void PlacefileIcons::Impl::UpdateBuffers()
    }
 }
 
+void PlacefileIcons::Impl::UpdateHoverIndex()
+{
+   std::vector<util::SpatialIndex::Bounds> bounds {};
+   bounds.reserve(newHoverIcons_.size());
+
+   for (auto& icon : newHoverIcons_)
+   {
+      bounds.push_back(util::SpatialIndex::CreateBounds(
+         {icon.p_}, {icon.otl_, icon.otr_, icon.obl_, icon.obr_}));
+   }
+
+   newHoverIndex_.Build(bounds);
+}
+
 void PlacefileIcons::Impl::UpdateTextureBuffer()
 {
    textureBuffer_.clear();
@@ -720,13 +743,21 @@ bool PlacefileIcons::RunMousePicking(
          scwx::util::time::now() :
          p->selectedTime_;
 
-   // For each pickable icon
+   // Offsets in pixels are scaled by up to the largest map scale component
+   const float pixelScale = std::max(std::abs(scale.x), std::abs(scale.y));
+
+   // Find the icons near the mouse
+   p->currentHoverIndex_.Query(mouseCoords, pixelScale, p->hoverCandidates_);
+
+   // For each pickable icon, beginning with the last icon drawn
    auto it = std::find_if(
-      std::execution::par_unseq,
-      p->currentHoverIcons_.crbegin(),
-      p->currentHoverIcons_.crend(),
-      [&mapDistance, &selectedTime, &mapMatrix, &mouseCoords](const auto& icon)
+      p->hoverCandidates_.crbegin(),
+      p->hoverCandidates_.crend(),
+      [this, &mapDistance, &selectedTime, &mapMatrix, &mouseCoords](
+         std::size_t index)
       {
+         const auto& icon = p->currentHoverIcons_[index];
+
          if ((
                 // Placefile is thresholded
                 mapDistance > units::length::meters<double> {0.0} &&
@@ -780,10 +811,11 @@ bool PlacefileIcons::RunMousePicking(
          return util::maplibre::IsPointInPolygon({tl, bl, br, tr}, mouseCoords);
       });
 
-   if (it != p->currentHoverIcons_.crend())
+   if (it != p->hoverCandidates_.crend())
    {
       itemPicked = true;
-      util::tooltip::Show(it->di_->hoverText_, mouseGlobalPos);
+      util::tooltip::Show(p->currentHoverIcons_[*it].di_->hoverText_,
+                          mouseGlobalPos);
    }
 
    return itemPicked;
@@ -1,11 +1,12 @@
 #include <scwx/qt/gl/draw/placefile_lines.hpp>
 #include <scwx/qt/util/geographic_lib.hpp>
 #include <scwx/qt/util/maplibre.hpp>
+#include <scwx/qt/util/spatial_index.hpp>
 #include <scwx/qt/util/tooltip.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/util/time.hpp>
 
-#include <execution>
+#include <unordered_map>
 
 namespace scwx
 {
@@ -43,6 +44,16 @@ public:
       glm::vec2 obr_;
    };
 
+   struct BufferRange
+   {
+      std::size_t offset_ {};
+      std::size_t size_ {};
+      std::size_t integerOffset_ {};
+      std::size_t integerSize_ {};
+      std::size_t hoverOffset_ {};
+      std::size_t hoverSize_ {};
+   };
+
    explicit Impl(const std::shared_ptr<GlContext>& context) :
        context_ {context},
        shaderProgram_ {nullptr},
@@ -64,8 +75,11 @@ public:
                    const GLint                         startTime,
                    const GLint                         endTime,
                    bool                                bufferHover = false);
+   bool
+   ReuseBuffers(const std::shared_ptr<const gr::Placefile::LineDrawItem>& di);
    void
    UpdateBuffers(const std::shared_ptr<const gr::Placefile::LineDrawItem>& di);
+   void UpdateHoverIndex();
    void Update();
 
    std::shared_ptr<GlContext> context_;
@@ -88,6 +102,15 @@ public:
    std::vector<LineHoverEntry> currentHoverLines_ {};
    std::vector<LineHoverEntry> newHoverLines_ {};
 
+   // Index of hover lines in map screen coordinates
+   util::SpatialIndex       currentHoverIndex_ {};
+   util::SpatialIndex       newHoverIndex_ {};
+   std::vector<std::size_t> hoverCandidates_ {};
+
+   // Buffer ranges of each line, by draw item hash
+   std::unordered_map<std::size_t, BufferRange> currentRanges_ {};
+   std::unordered_map<std::size_t, BufferRange> newRanges_ {};
+
    std::shared_ptr<ShaderProgram> shaderProgram_;
 
    GLint uMVPMatrixLocation_ {static_cast<GLint>(GL_INVALID_INDEX)};
@@ -268,6 +291,8 @@ void PlacefileLines::Deinitialize()
    p->currentLinesBuffer_.clear();
    p->currentIntegerBuffer_.clear();
    p->currentHoverLines_.clear();
+   p->currentHoverIndex_.Clear();
+   p->currentRanges_.clear();
 }
 
 void PlacefileLines::StartLines()
@@ -276,6 +301,7 @@ void PlacefileLines::StartLines()
    p->newLinesBuffer_.clear();
    p->newIntegerBuffer_.clear();
    p->newHoverLines_.clear();
+   p->newRanges_.clear();
 
    p->newNumLines_ = 0u;
 }
@@ -285,32 +311,106 @@ void PlacefileLines::AddLine(
 {
    if (di != nullptr && !di->elements_.empty())
    {
-      p->UpdateBuffers(di);
+      // Only buffer lines which were not present in the previous set
+      if (!p->ReuseBuffers(di))
+      {
+         p->UpdateBuffers(di);
+      }
       p->newNumLines_ += (di->elements_.size() - 1) * 2;
    }
 }
 
 void PlacefileLines::FinishLines()
 {
+   // Index the new hover lines before locking
+   p->UpdateHoverIndex();
+
    std::unique_lock lock {p->lineMutex_};
 
-   // Swap buffers
-   p->currentLinesBuffer_.swap(p->newLinesBuffer_);
-   p->currentIntegerBuffer_.swap(p->newIntegerBuffer_);
+   // If the lines are unchanged, the current buffers do not need to be
+   // uploaded again
+   if (p->newLinesBuffer_ != p->currentLinesBuffer_ ||
+       p->newIntegerBuffer_ != p->currentIntegerBuffer_)
+   {
+      // Swap buffers
+      p->currentLinesBuffer_.swap(p->newLinesBuffer_);
+      p->currentIntegerBuffer_.swap(p->newIntegerBuffer_);
+
+      // Mark the draw item dirty
+      p->dirty_ = true;
+   }
+
+   // Hover entries reference the new draw items
    p->currentHoverLines_.swap(p->newHoverLines_);
+   std::swap(p->currentHoverIndex_, p->newHoverIndex_);
+   p->currentRanges_.swap(p->newRanges_);
 
    // Clear the new buffers
    p->newLinesBuffer_.clear();
    p->newIntegerBuffer_.clear();
    p->newHoverLines_.clear();
+   p->newHoverIndex_.Clear();
+   p->newRanges_.clear();
 
    // Update the number of lines
    p->currentNumLines_ = p->newNumLines_;
    p->numVertices_ =
       static_cast<GLsizei>(p->currentNumLines_ * kVerticesPerRectangle);
+}
 
-   // Mark the draw item dirty
-   p->dirty_ = true;
+bool PlacefileLines::Impl::ReuseBuffers(
+   const std::shared_ptr<const gr::Placefile::LineDrawItem>& di)
+{
+   std::unique_lock lock {lineMutex_};
+
+   auto it = currentRanges_.find(di->hash_);
+   if (it == currentRanges_.cend())
+   {
+      return false;
+   }
+
+   const BufferRange& range = it->second;
+
+   // The current buffers may have been cleared since the range was recorded
+   if (range.offset_ + range.size_ > currentLinesBuffer_.size() ||
+       range.integerOffset_ + range.integerSize_ >
+          currentIntegerBuffer_.size() ||
+       range.hoverOffset_ + range.hoverSize_ > currentHoverLines_.size())
+   {
+      return false;
+   }
+
+   // Copy the previously buffered line into the new buffers
+   const auto offset        = static_cast<std::ptrdiff_t>(range.offset_);
+   const auto size          = static_cast<std::ptrdiff_t>(range.size_);
+   const auto integerOffset = static_cast<std::ptrdiff_t>(range.integerOffset_);
+   const auto integerSize   = static_cast<std::ptrdiff_t>(range.integerSize_);
+
+   newRanges_.try_emplace(di->hash_,
+                          BufferRange {newLinesBuffer_.size(),
+                                       range.size_,
+                                       newIntegerBuffer_.size(),
+                                       range.integerSize_,
+                                       newHoverLines_.size(),
+                                       range.hoverSize_});
+
+   newLinesBuffer_.insert(newLinesBuffer_.end(),
+                          currentLinesBuffer_.cbegin() + offset,
+                          currentLinesBuffer_.cbegin() + offset + size);
+   newIntegerBuffer_.insert(newIntegerBuffer_.end(),
+                            currentIntegerBuffer_.cbegin() + integerOffset,
+                            currentIntegerBuffer_.cbegin() + integerOffset +
+                               integerSize);
+
+   for (std::size_t i = 0; i < range.hoverSize_; ++i)
+   {
+      // Hover entries must reference the new draw item
+      auto& hoverLine = newHoverLines_.emplace_back(
+         currentHoverLines_[range.hoverOffset_ + i]);
+      hoverLine.di_ = di;
+   }
+
+   return true;
 }
 
 void PlacefileLines::Impl::UpdateBuffers(
@@ -330,6 +430,10 @@ void PlacefileLines::Impl::UpdateBuffers(
                             di->endTime_.time_since_epoch())
                             .count());
 
+   const std::size_t offset        = newLinesBuffer_.size();
+   const std::size_t integerOffset = newIntegerBuffer_.size();
+   const std::size_t hoverOffset   = newHoverLines_.size();
+
    std::vector<units::angle::degrees<double>> angles {};
    angles.reserve(di->elements_.size() - 1);
 
@@ -373,6 +477,16 @@ void PlacefileLines::Impl::UpdateBuffers(
                  startTime,
                  endTime);
    }
+
+   // Record the buffer range, so the line can be reused when reloaded
+   newRanges_.try_emplace(
+      di->hash_,
+      BufferRange {offset,
+                   newLinesBuffer_.size() - offset,
+                   integerOffset,
+                   newIntegerBuffer_.size() - integerOffset,
+                   hoverOffset,
+                   newHoverLines_.size() - hoverOffset});
 }
 
 void PlacefileLines::Impl::BufferLine(
@@ -468,6 +582,20 @@ void PlacefileLines::Impl::BufferLine(
    }
 }
 
+void PlacefileLines::Impl::UpdateHoverIndex()
+{
+   std::vector<util::SpatialIndex::Bounds> bounds {};
+   bounds.reserve(newHoverLines_.size());
+
+   for (auto& line : newHoverLines_)
+   {
+      bounds.push_back(util::SpatialIndex::CreateBounds(
+         {line.p1_, line.p2_}, {line.otl_, line.otr_, line.obl_, line.obr_}));
+   }
+
+   newHoverIndex_.Build(bounds);
+}
+
 void PlacefileLines::Impl::Update()
 {
    // If the placefile has been updated
@@ -526,13 +654,21 @@ bool PlacefileLines::RunMousePicking(
          scwx::util::time::now() :
          p->selectedTime_;
 
-   // For each pickable line
+   // Offsets in pixels are scaled by up to the largest map scale component
+   const float pixelScale = std::max(std::abs(scale.x), std::abs(scale.y));
+
+   // Find the lines near the mouse
+   p->currentHoverIndex_.Query(mouseCoords, pixelScale, p->hoverCandidates_);
+
+   // For each pickable line, beginning with the last line drawn
    auto it = std::find_if(
-      std::execution::par_unseq,
-      p->currentHoverLines_.crbegin(),
-      p->currentHoverLines_.crend(),
-      [&mapDistance, &selectedTime, &mapMatrix, &mouseCoords](const auto& line)
+      p->hoverCandidates_.crbegin(),
+      p->hoverCandidates_.crend(),
+      [this, &mapDistance, &selectedTime, &mapMatrix, &mouseCoords](
+         std::size_t index)
       {
+         const auto& line = p->currentHoverLines_[index];
+
          if ((
                 // Placefile is thresholded
                 mapDistance > units::length::meters<double> {0.0} &&
@@ -588,10 +724,11 @@ bool PlacefileLines::RunMousePicking(
          return util::maplibre::IsPointInPolygon({tl, bl, br, tr}, mouseCoords);
       });
 
-   if (it != p->currentHoverLines_.crend())
+   if (it != p->hoverCandidates_.crend())
    {
       itemPicked = true;
-      util::tooltip::Show(it->di_->hoverText_, mouseGlobalPos);
+      util::tooltip::Show(p->currentHoverLines_[*it].di_->hoverText_,
+                          mouseGlobalPos);
    }
 
    return itemPicked;
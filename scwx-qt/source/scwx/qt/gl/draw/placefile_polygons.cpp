@@ -3,7 +3,12 @@
 #include <scwx/util/logger.hpp>
 #include <scwx/util/time.hpp>
 
+#include <algorithm>
+#include <execution>
 #include <mutex>
+#include <numeric>
+#include <thread>
+#include <unordered_map>
 
 #include <boost/container/stable_vector.hpp>
 
@@ -47,9 +52,52 @@ static constexpr std::size_t kTessVertexSize_    = kTessVertexA_ + 1;
 
 typedef std::array<GLdouble, kTessVertexSize_> TessVertexArray;
 
+/**
+ * Tessellates placefile polygons into triangle vertices. A GLU tessellator
+ * must not be shared between threads, so each worker uses its own instance.
+ */
+class PolygonTessellator
+{
+public:
+   explicit PolygonTessellator();
+   ~PolygonTessellator();
+
+   PolygonTessellator(const PolygonTessellator&)            = delete;
+   PolygonTessellator& operator=(const PolygonTessellator&) = delete;
+
+   PolygonTessellator(PolygonTessellator&&)            = delete;
+   PolygonTessellator& operator=(PolygonTessellator&&) = delete;
+
+   void Tessellate(const gr::Placefile::PolygonDrawItem& di,
+                   std::vector<GLfloat>&                 vertices);
+
+private:
+   static void TessellateCombineCallback(GLdouble coords[3],
+                                         void*    vertexData[4],
+                                         GLfloat  weight[4],
+                                         void**   outData,
+                                         void*    polygonData);
+   static void TessellateVertexCallback(void* vertexData, void* polygonData);
+   static void TessellateErrorCallback(GLenum errorCode);
+
+   GLUtesselator* tessellator_;
+
+   boost::container::stable_vector<TessVertexArray> tessCombineBuffer_ {};
+
+   std::vector<GLfloat>* vertices_ {nullptr};
+};
+
 class PlacefilePolygons::Impl
 {
 public:
+   struct BufferRange
+   {
+      std::size_t offset_ {};
+      std::size_t size_ {};
+      std::size_t integerOffset_ {};
+      std::size_t integerSize_ {};
+   };
+
    explicit Impl(const std::shared_ptr<GlContext>& context) :
        context_ {context},
        shaderProgram_ {nullptr},
@@ -62,39 +110,17 @@ public:
        vbo_ {GL_INVALID_INDEX},
        numVertices_ {0}
    {
-      tessellator_ = gluNewTess();
-
-      gluTessCallback(tessellator_, //
-                      GLU_TESS_COMBINE_DATA,
-                      (_GLUfuncptr) &TessellateCombineCallback);
-      gluTessCallback(tessellator_, //
-                      GLU_TESS_VERTEX_DATA,
-                      (_GLUfuncptr) &TessellateVertexCallback);
-
-      // Force GLU_TRIANGLES
-      gluTessCallback(tessellator_, //
-                      GLU_TESS_EDGE_FLAG,
-                      []() {});
-
-      gluTessCallback(tessellator_, //
-                      GLU_TESS_ERROR,
-                      (_GLUfuncptr) &TessellateErrorCallback);
    }
 
-   ~Impl() { gluDeleteTess(tessellator_); }
+   ~Impl() = default;
 
+   void BufferPolygon(const gr::Placefile::PolygonDrawItem& di,
+                      const std::vector<GLfloat>&           vertices);
+   bool IsReusable(std::size_t hash);
+   bool ReusePolygon(std::size_t hash);
+   void TessellatePolygons();
    void Update();
 
-   void Tessellate(const std::shared_ptr<gr::Placefile::PolygonDrawItem>& di);
-
-   static void TessellateCombineCallback(GLdouble coords[3],
-                                         void*    vertexData[4],
-                                         GLfloat  weight[4],
-                                         void**   outData,
-                                         void*    polygonData);
-   static void TessellateVertexCallback(void* vertexData, void* polygonData);
-   static void TessellateErrorCallback(GLenum errorCode);
-
    std::shared_ptr<GlContext> context_;
 
    bool dirty_ {false};
@@ -102,7 +128,9 @@ public:
 
    std::chrono::system_clock::time_point selectedTime_ {};
 
-   boost::container::stable_vector<TessVertexArray> tessCombineBuffer_ {};
+   // Polygons added since the draw item was started, in draw order
+   std::vector<std::shared_ptr<const gr::Placefile::PolygonDrawItem>>
+      newPolygonList_ {};
 
    std::mutex           bufferMutex_ {};
    std::vector<GLfloat> currentBuffer_ {};
@@ -110,7 +138,9 @@ public:
    std::vector<GLfloat> newBuffer_ {};
    std::vector<GLint>   newIntegerBuffer_ {};
 
-   GLUtesselator* tessellator_;
+   // Buffer ranges of each tessellated polygon, by draw item hash
+   std::unordered_map<std::size_t, BufferRange> currentRanges_ {};
+   std::unordered_map<std::size_t, BufferRange> newRanges_ {};
 
    std::shared_ptr<ShaderProgram> shaderProgram_;
    GLint                          uMVPMatrixLocation_;
@@ -123,10 +153,6 @@ public:
    std::array<GLuint, 2> vbo_;
 
    GLsizei numVertices_;
-
-   GLint currentThreshold_ {};
-   GLint currentStartTime_ {};
-   GLint currentEndTime_ {};
 };
 
 PlacefilePolygons::PlacefilePolygons(
@@ -283,13 +309,16 @@ void PlacefilePolygons::Deinitialize()
    // Clear the current buffers
    p->currentBuffer_.clear();
    p->currentIntegerBuffer_.clear();
+   p->currentRanges_.clear();
 }
 
 void PlacefilePolygons::StartPolygons()
 {
    // Clear the new buffers
+   p->newPolygonList_.clear();
    p->newBuffer_.clear();
    p->newIntegerBuffer_.clear();
+   p->newRanges_.clear();
 }
 
 void PlacefilePolygons::AddPolygon(
@@ -297,24 +326,221 @@ void PlacefilePolygons::AddPolygon(
 {
    if (di != nullptr)
    {
-      p->Tessellate(di);
+      p->newPolygonList_.emplace_back(di);
    }
 }
 
 void PlacefilePolygons::FinishPolygons()
 {
+   // Tessellate the new polygons before locking
+   p->TessellatePolygons();
+
    std::unique_lock lock {p->bufferMutex_};
 
-   // Swap buffers
-   p->currentBuffer_.swap(p->newBuffer_);
-   p->currentIntegerBuffer_.swap(p->newIntegerBuffer_);
+   // If the polygons are unchanged, the current buffers do not need to be
+   // uploaded again
+   if (p->newBuffer_ != p->currentBuffer_ ||
+       p->newIntegerBuffer_ != p->currentIntegerBuffer_)
+   {
+      // Swap buffers
+      p->currentBuffer_.swap(p->newBuffer_);
+      p->currentIntegerBuffer_.swap(p->newIntegerBuffer_);
+
+      // Mark the draw item dirty
+      p->dirty_ = true;
+   }
+
+   p->currentRanges_.swap(p->newRanges_);
 
    // Clear the new buffers
+   p->newPolygonList_.clear();
    p->newBuffer_.clear();
    p->newIntegerBuffer_.clear();
+   p->newRanges_.clear();
+}
 
-   // Mark the draw item dirty
-   p->dirty_ = true;
+void PlacefilePolygons::Impl::TessellatePolygons()
+{
+   // Polygons which were not present in the previous set are tessellated.
+   // Polygons repeated within the set are only tessellated once.
+   std::vector<std::shared_ptr<const gr::Placefile::PolygonDrawItem>>
+                                                tessellateList {};
+   std::unordered_map<std::size_t, std::size_t> tessellationIndices {};
+
+   for (auto& di : newPolygonList_)
+   {
+      if (!IsReusable(di->hash_) &&
+          tessellationIndices.try_emplace(di->hash_, tessellateList.size())
+             .second)
+      {
+         tessellateList.push_back(di);
+      }
+   }
+
+   // Distribute the polygons among the workers, each with its own tessellator
+   std::vector<std::vector<GLfloat>> tessellations(tessellateList.size());
+
+   const std::size_t workerCount = std::min<std::size_t>(
+      tessellateList.size(),
+      std::max<std::size_t>(std::thread::hardware_concurrency(), 1u));
+   std::vector<std::size_t> workers(workerCount);
+   std::iota(workers.begin(), workers.end(), 0u);
+
+   std::for_each(std::execution::par,
+                 workers.begin(),
+                 workers.end(),
+                 [&](std::size_t worker)
+                 {
+                    PolygonTessellator tessellator {};
+
+                    for (std::size_t i = worker; i < tessellateList.size();
+                         i += workerCount)
+                    {
+                       tessellator.Tessellate(*tessellateList[i],
+                                              tessellations[i]);
+                    }
+                 });
+
+   // Buffer the polygons in draw order
+   for (auto& di : newPolygonList_)
+   {
+      if (newRanges_.contains(di->hash_))
+      {
+         // Polygon is repeated within the set
+         const BufferRange range = newRanges_.at(di->hash_);
+
+         const auto offset = static_cast<std::ptrdiff_t>(range.offset_);
+         const auto size   = static_cast<std::ptrdiff_t>(range.size_);
+         const auto integerOffset =
+            static_cast<std::ptrdiff_t>(range.integerOffset_);
+         const auto integerSize =
+            static_cast<std::ptrdiff_t>(range.integerSize_);
+
+         // Resize before copying, a vector cannot be inserted into itself
+         newBuffer_.resize(newBuffer_.size() + range.size_);
+         newIntegerBuffer_.resize(newIntegerBuffer_.size() +
+                                  range.integerSize_);
+
+         std::copy_n(newBuffer_.cbegin() + offset,
+                     size,
+                     newBuffer_.end() - size);
+         std::copy_n(newIntegerBuffer_.cbegin() + integerOffset,
+                     integerSize,
+                     newIntegerBuffer_.end() - integerSize);
+         continue;
+      }
+
+      auto it = tessellationIndices.find(di->hash_);
+      if (it != tessellationIndices.cend())
+      {
+         BufferPolygon(*di, tessellations[it->second]);
+      }
+      else if (!ReusePolygon(di->hash_))
+      {
+         // The current buffers were cleared after checking, tessellate now
+         std::vector<GLfloat> vertices {};
+         PolygonTessellator {}.Tessellate(*di, vertices);
+         BufferPolygon(*di, vertices);
+      }
+   }
+}
+
+void PlacefilePolygons::Impl::BufferPolygon(
+   const gr::Placefile::PolygonDrawItem& di,
+   const std::vector<GLfloat>&           vertices)
+{
+   const std::size_t offset        = newBuffer_.size();
+   const std::size_t integerOffset = newIntegerBuffer_.size();
+
+   // Threshold value
+   units::length::nautical_miles<double> threshold = di.threshold_;
+   GLint thresholdValue = static_cast<GLint>(std::round(threshold.value()));
+
+   // Start and end time
+   GLint startTime =
+      static_cast<GLint>(std::chrono::duration_cast<std::chrono::minutes>(
+                            di.startTime_.time_since_epoch())
+                            .count());
+   GLint endTime =
+      static_cast<GLint>(std::chrono::duration_cast<std::chrono::minutes>(
+                            di.endTime_.time_since_epoch())
+                            .count());
+
+   newBuffer_.insert(newBuffer_.end(), vertices.cbegin(), vertices.cend());
+
+   for (std::size_t i = 0; i < vertices.size() / kPointsPerVertex; ++i)
+   {
+      newIntegerBuffer_.insert(newIntegerBuffer_.end(),
+                               {thresholdValue, startTime, endTime});
+   }
+
+   // Record the buffer range, so the polygon can be reused when reloaded
+   newRanges_.try_emplace(di.hash_,
+                          BufferRange {offset,
+                                       newBuffer_.size() - offset,
+                                       integerOffset,
+                                       newIntegerBuffer_.size() -
+                                          integerOffset});
+}
+
+bool PlacefilePolygons::Impl::IsReusable(std::size_t hash)
+{
+   std::unique_lock lock {bufferMutex_};
+
+   auto it = currentRanges_.find(hash);
+   if (it == currentRanges_.cend())
+   {
+      return false;
+   }
+
+   const BufferRange& range = it->second;
+
+   // The current buffers may have been cleared since the range was recorded
+   return range.offset_ + range.size_ <= currentBuffer_.size() &&
+          range.integerOffset_ + range.integerSize_ <=
+             currentIntegerBuffer_.size();
+}
+
+bool PlacefilePolygons::Impl::ReusePolygon(std::size_t hash)
+{
+   std::unique_lock lock {bufferMutex_};
+
+   auto it = currentRanges_.find(hash);
+   if (it == currentRanges_.cend())
+   {
+      return false;
+   }
+
+   const BufferRange& range = it->second;
+
+   // The current buffers may have been cleared since the range was recorded
+   if (range.offset_ + range.size_ > currentBuffer_.size() ||
+       range.integerOffset_ + range.integerSize_ > currentIntegerBuffer_.size())
+   {
+      return false;
+   }
+
+   // Copy the previously tessellated polygon into the new buffers
+   const auto offset        = static_cast<std::ptrdiff_t>(range.offset_);
+   const auto size          = static_cast<std::ptrdiff_t>(range.size_);
+   const auto integerOffset = static_cast<std::ptrdiff_t>(range.integerOffset_);
+   const auto integerSize   = static_cast<std::ptrdiff_t>(range.integerSize_);
+
+   newRanges_.try_emplace(hash,
+                          BufferRange {newBuffer_.size(),
+                                       range.size_,
+                                       newIntegerBuffer_.size(),
+                                       range.integerSize_});
+
+   newBuffer_.insert(newBuffer_.end(),
+                     currentBuffer_.cbegin() + offset,
+                     currentBuffer_.cbegin() + offset + size);
+   newIntegerBuffer_.insert(newIntegerBuffer_.end(),
+                            currentIntegerBuffer_.cbegin() + integerOffset,
+                            currentIntegerBuffer_.cbegin() + integerOffset +
+                               integerSize);
+
+   return true;
 }
 
 void PlacefilePolygons::Impl::Update()
@@ -346,32 +572,44 @@ void PlacefilePolygons::Impl::Update()
    }
 }
 
-void PlacefilePolygons::Impl::Tessellate(
-   const std::shared_ptr<gr::Placefile::PolygonDrawItem>& di)
+PolygonTessellator::PolygonTessellator() : tessellator_ {gluNewTess()}
+{
+   gluTessCallback(tessellator_, //
+                   GLU_TESS_COMBINE_DATA,
+                   (_GLUfuncptr) &TessellateCombineCallback);
+   gluTessCallback(tessellator_, //
+                   GLU_TESS_VERTEX_DATA,
+                   (_GLUfuncptr) &TessellateVertexCallback);
+
+   // Force GLU_TRIANGLES
+   gluTessCallback(tessellator_, //
+                   GLU_TESS_EDGE_FLAG,
+                   []() {});
+
+   gluTessCallback(tessellator_, //
+                   GLU_TESS_ERROR,
+                   (_GLUfuncptr) &TessellateErrorCallback);
+}
+
+PolygonTessellator::~PolygonTessellator()
+{
+   gluDeleteTess(tessellator_);
+}
+
+void PolygonTessellator::Tessellate(const gr::Placefile::PolygonDrawItem& di,
+                                    std::vector<GLfloat>& vertices)
 {
    // Vertex storage
-   boost::container::stable_vector<TessVertexArray> vertices {};
+   boost::container::stable_vector<TessVertexArray> tessVertices {};
 
    // Default color to "Color" statement
-   boost::gil::rgba8_pixel_t lastColor = di->color_;
+   boost::gil::rgba8_pixel_t lastColor = di.color_;
 
-   // Current threshold
-   units::length::nautical_miles<double> threshold = di->threshold_;
-   currentThreshold_ = static_cast<GLint>(std::round(threshold.value()));
-
-   // Start and end time
-   currentStartTime_ =
-      static_cast<GLint>(std::chrono::duration_cast<std::chrono::minutes>(
-                            di->startTime_.time_since_epoch())
-                            .count());
-   currentEndTime_ =
-      static_cast<GLint>(std::chrono::duration_cast<std::chrono::minutes>(
-                            di->endTime_.time_since_epoch())
-                            .count());
+   vertices_ = &vertices;
 
    gluTessBeginPolygon(tessellator_, this);
 
-   for (auto& contour : di->contours_)
+   for (auto& contour : di.contours_)
    {
       gluTessBeginContour(tessellator_);
 
@@ -389,15 +627,15 @@ void PlacefilePolygons::Impl::Tessellate(
 
          // Add vertex to temporary storage
          auto& vertex =
-            vertices.emplace_back(TessVertexArray {screenCoordinate.x,
-                                                   screenCoordinate.y,
-                                                   0.0, // z
-                                                   element.x_,
-                                                   element.y_,
-                                                   lastColor[0] / 255.0,
-                                                   lastColor[1] / 255.0,
-                                                   lastColor[2] / 255.0,
-                                                   lastColor[3] / 255.0});
+            tessVertices.emplace_back(TessVertexArray {screenCoordinate.x,
+                                                       screenCoordinate.y,
+                                                       0.0, // z
+                                                       element.x_,
+                                                       element.y_,
+                                                       lastColor[0] / 255.0,
+                                                       lastColor[1] / 255.0,
+                                                       lastColor[2] / 255.0,
+                                                       lastColor[3] / 255.0});
 
          // Tessellate vertex
          gluTessVertex(tessellator_, vertex.data(), vertex.data());
@@ -410,25 +648,24 @@ void PlacefilePolygons::Impl::Tessellate(
 
    // Clear temporary storage
    tessCombineBuffer_.clear();
+   vertices_ = nullptr;
 
    // Remove extra vertices that don't correspond to a full triangle
-   while (newBuffer_.size() % kVerticesPerTriangle != 0)
-   {
-      newBuffer_.pop_back();
-      newIntegerBuffer_.pop_back();
-   }
+   const std::size_t vertexCount = vertices.size() / kPointsPerVertex;
+   vertices.resize((vertexCount - vertexCount % kVerticesPerTriangle) *
+                   kPointsPerVertex);
 }
 
-void PlacefilePolygons::Impl::TessellateCombineCallback(GLdouble coords[3],
-                                                        void*    vertexData[4],
-                                                        GLfloat  w[4],
-                                                        void**   outData,
-                                                        void*    polygonData)
+void PolygonTessellator::TessellateCombineCallback(GLdouble coords[3],
+                                                   void*    vertexData[4],
+                                                   GLfloat  w[4],
+                                                   void**   outData,
+                                                   void*    polygonData)
 {
    static constexpr std::size_t r = kTessVertexR_;
    static constexpr std::size_t a = kTessVertexA_;
 
-   Impl* self = static_cast<Impl*>(polygonData);
+   PolygonTessellator* self = static_cast<PolygonTessellator*>(polygonData);
 
    // Create new vertex data with given coordinates and interpolated color
    auto& newVertexData = self->tessCombineBuffer_.emplace_back( //
@@ -460,14 +697,14 @@ void PlacefilePolygons::Impl::TessellateCombineCallback(GLdouble coords[3],
    *outData = &newVertexData;
 }
 
-void PlacefilePolygons::Impl::TessellateVertexCallback(void* vertexData,
-                                                       void* polygonData)
+void PolygonTessellator::TessellateVertexCallback(void* vertexData,
+                                                  void* polygonData)
 {
-   Impl*     self = static_cast<Impl*>(polygonData);
-   GLdouble* data = static_cast<GLdouble*>(vertexData);
+   PolygonTessellator* self = static_cast<PolygonTessellator*>(polygonData);
+   GLdouble*           data = static_cast<GLdouble*>(vertexData);
 
    // Buffer vertex
-   self->newBuffer_.insert(self->newBuffer_.end(),
+   self->vertices_->insert(self->vertices_->end(),
                            {static_cast<float>(data[kTessVertexScreenX_]),
                             static_cast<float>(data[kTessVertexScreenY_]),
                             static_cast<float>(data[kTessVertexXOffset_]),
@@ -476,13 +713,9 @@ void PlacefilePolygons::Impl::TessellateVertexCallback(void* vertexData,
                             static_cast<float>(data[kTessVertexG_]),
                             static_cast<float>(data[kTessVertexB_]),
                             static_cast<float>(data[kTessVertexA_])});
-   self->newIntegerBuffer_.insert(self->newIntegerBuffer_.end(),
-                                  {self->currentThreshold_,
-                                   self->currentStartTime_,
-                                   self->currentEndTime_});
 }
 
-void PlacefilePolygons::Impl::TessellateErrorCallback(GLenum errorCode)
+void PolygonTessellator::TessellateErrorCallback(GLenum errorCode)
 {
    logger_->error("GL Error: {}", errorCode);
 }
@@ -40,14 +40,16 @@ public:
    void StartPolygons();
 
    /**
-    * Adds a placefile polygon to the internal draw list.
+    * Adds a placefile polygon to the internal draw list. Polygons are
+    * tessellated when the draw item is finalized.
     *
     * @param [in] di Placefile polygon
     */
    void AddPolygon(const std::shared_ptr<gr::Placefile::PolygonDrawItem>& di);
 
    /**
-    * Finalizes the draw item after adding new polygons.
+    * Finalizes the draw item after adding new polygons. Polygons which were
+    * not present in the previous set are tessellated in parallel.
     */
    void FinishPolygons();
 
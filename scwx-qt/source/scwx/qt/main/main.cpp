@@ -16,8 +16,10 @@
 #include <scwx/qt/ui/setup/setup_wizard.hpp>
 #include <scwx/qt/main/check_privilege.hpp>
 #include <scwx/network/cpr.hpp>
+#include <scwx/provider/object_cache.hpp>
 #include <scwx/util/environment.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/task_graph.hpp>
 #include <scwx/util/threads.hpp>
 
 #include <string>
@@ -42,6 +44,9 @@
 static const std::string logPrefix_ = "scwx::main";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
+// Size budget for downloaded radar data retained between sessions
+static constexpr std::uintmax_t kObjectCacheSize_ = 2ull * 1024 * 1024 * 1024;
+
 static void ConfigureTheme(const std::vector<std::string>& args);
 static void InitializeOpenGL();
 static void OverrideDefaultStyle(const std::vector<std::string>& args);
@@ -122,12 +127,45 @@ int main(int argc, char* argv[])
    Aws::SDKOptions awsSdkOptions;
    Aws::InitAPI(awsSdkOptions);
 
-   // Initialize application
-   scwx::qt::config::RadarSite::Initialize();
-   scwx::qt::config::CountyDatabase::Initialize();
-   scwx::qt::manager::TaskManager::Initialize();
-   scwx::qt::manager::SettingsManager::Instance().Initialize();
-   scwx::qt::manager::ResourceManager::Initialize();
+   // Initialize application. Independent steps run in parallel. Steps creating
+   // Qt objects or using QFont run on the main thread.
+   {
+      using scwx::util::TaskGraph;
+
+      const std::string objectCachePath =
+         QStandardPaths::writableLocation(QStandardPaths::CacheLocation)
+            .toStdString() +
+         "/radar";
+
+      TaskGraph startup {"Startup"};
+
+      startup.AddTask("RadarSite", &scwx::qt::config::RadarSite::Initialize);
+      startup.AddTask("CountyDatabase",
+                      &scwx::qt::config::CountyDatabase::Initialize);
+      startup.AddTask("ObjectCache",
+                      [&]()
+                      {
+                         scwx::provider::ObjectCache::Instance().Initialize(
+                            objectCachePath, kObjectCacheSize_);
+                      });
+      startup.AddTask("Textures",
+                      &scwx::qt::manager::ResourceManager::InitializeTextures);
+      startup.AddTask("TaskManager",
+                      &scwx::qt::manager::TaskManager::Initialize,
+                      {"RadarSite"},
+                      TaskGraph::Thread::Caller);
+      startup.AddTask(
+         "Settings",
+         []() { scwx::qt::manager::SettingsManager::Instance().Initialize(); },
+         {"RadarSite", "CountyDatabase"},
+         TaskGraph::Thread::Caller);
+      startup.AddTask("Fonts",
+                      &scwx::qt::manager::ResourceManager::InitializeFonts,
+                      {"Settings"},
+                      TaskGraph::Thread::Caller);
+
+      startup.Run(threadPool);
+   }
 
    // Theme
    ConfigureTheme(args);
@@ -6,10 +6,16 @@
 #include <scwx/qt/settings/audio_settings.hpp>
 #include <scwx/qt/settings/general_settings.hpp>
 #include <scwx/qt/types/location_types.hpp>
-#include <scwx/qt/util/geographic_lib.hpp>
+#include <scwx/qt/util/geographic_area_index.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/util/time.hpp>
 
+#include <algorithm>
+#include <mutex>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+
 #include <boost/asio/post.hpp>
 #include <boost/asio/thread_pool.hpp>
 #include <boost/uuid/random_generator.hpp>
@@ -40,16 +46,21 @@ public:
 
       QObject::connect(
          textEventManager_.get(),
-         &manager::TextEventManager::AlertUpdated,
+         &manager::TextEventManager::AlertsUpdated,
          self_,
-         [this](const types::TextEventKey& key, size_t messageIndex)
+         [this](const std::unordered_set<
+                types::TextEventKey,
+                types::TextEventHash<types::TextEventKey>>& keys)
          {
             boost::asio::post(threadPool_,
                               [=, this]()
                               {
                                  try
                                  {
-                                    HandleAlert(key, messageIndex);
+                                    for (const auto& key : keys)
+                                    {
+                                       HandleAlert(key);
+                                    }
                                  }
                                  catch (const std::exception& ex)
                                  {
@@ -61,13 +72,44 @@ public:
 
    ~Impl() { threadPool_.join(); }
 
+   struct AlertArea
+   {
+      types::TextEventKey                   key_ {};
+      std::size_t                           segment_ {};
+      std::chrono::system_clock::time_point eventEnd_ {};
+   };
+
    common::Coordinate
         CurrentCoordinate(types::LocationMethod locationMethod) const;
-   void HandleAlert(const types::TextEventKey& key, size_t messageIndex) const;
+   void HandleAlert(const types::TextEventKey& key);
+   std::set<std::size_t>
+        SegmentsInRange(const types::TextEventKey&    key,
+                        const common::Coordinate&     coordinate,
+                        units::length::meters<double> distance) const;
+   void UpdateAlertAreas(
+      const types::TextEventKey&                        key,
+      const std::shared_ptr<awips::TextProductMessage>& message);
    void UpdateLocationTracking(const std::string& value) const;
 
    boost::asio::thread_pool threadPool_ {1u};
 
+   // Areas of active alert segments, identified by area ID
+   mutable std::mutex                         alertAreaMutex_ {};
+   util::GeographicAreaIndex                  alertAreaIndex_ {};
+   std::unordered_map<std::size_t, AlertArea> alertAreas_ {};
+   std::unordered_map<types::TextEventKey,
+                      std::vector<std::size_t>,
+                      types::TextEventHash<types::TextEventKey>>
+               alertAreaIds_ {};
+   std::size_t nextAlertAreaId_ {};
+
+   // Most recent message evaluated for each event, accessed only from the
+   // thread pool
+   std::unordered_map<types::TextEventKey,
+                      std::shared_ptr<awips::TextProductMessage>,
+                      types::TextEventHash<types::TextEventKey>>
+      lastMessages_ {};
+
    AlertManager* self_;
 
    boost::uuids::uuid uuid_ {boost::uuids::random_generator()()};
@@ -136,17 +178,29 @@ common::Coordinate AlertManager::Impl::CurrentCoordinate(
    return coordinate;
 }
 
-void AlertManager::Impl::HandleAlert(const types::TextEventKey& key,
-                                     size_t messageIndex) const
+void AlertManager::Impl::HandleAlert(const types::TextEventKey& key)
 {
    auto messages = textEventManager_->message_list(key);
 
-   // Skip alert if there are more messages to be processed
-   if (messages.empty() || messageIndex + 1 < messages.size())
+   // Only the most recent message for the event is evaluated
+   if (messages.empty())
    {
+      lastMessages_.erase(key);
+      UpdateAlertAreas(key, nullptr);
       return;
    }
 
+   auto message = messages.back();
+
+   // Skip the event if the most recent message has already been evaluated,
+   // e.g., if an older message was loaded
+   auto& lastMessage = lastMessages_[key];
+   if (lastMessage == message)
+   {
+      return;
+   }
+   lastMessage = message;
+
    settings::AudioSettings& audioSettings = settings::AudioSettings::Instance();
    types::LocationMethod    locationMethod = types::GetLocationMethod(
       audioSettings.alert_location_method().GetValue());
@@ -156,10 +210,22 @@ void AlertManager::Impl::HandleAlert(const types::TextEventKey& key,
       audioSettings.alert_radius().GetValue());
    std::string alertWFO = audioSettings.alert_wfo().GetValue();
 
-   auto message = messages.at(messageIndex);
+   UpdateAlertAreas(key, message);
 
-   for (auto& segment : message->segments())
+   std::set<std::size_t> segmentsInRange {};
+   if (locationMethod == types::LocationMethod::Fixed ||
+       locationMethod == types::LocationMethod::Track ||
+       locationMethod == types::LocationMethod::RadarSite)
    {
+      segmentsInRange = SegmentsInRange(key, currentCoordinate, alertRadius);
+   }
+
+   auto segments = message->segments();
+
+   for (std::size_t i = 0; i < segments.size(); ++i)
+   {
+      auto& segment = segments[i];
+
       if (!segment->codedLocation_.has_value())
       {
          continue;
@@ -185,11 +251,8 @@ void AlertManager::Impl::HandleAlert(const types::TextEventKey& key,
           locationMethod == types::LocationMethod::Track ||
           locationMethod == types::LocationMethod::RadarSite)
       {
-         // Determine if the alert is active at the current coordinte
-         auto alertCoordinates = segment->codedLocation_->coordinates();
-
-         activeAtLocation = util::GeographicLib::AreaInRangeOfPoint(
-            alertCoordinates, currentCoordinate, alertRadius);
+         // Determine if the alert is active at the current coordinate
+         activeAtLocation = segmentsInRange.contains(i);
       }
       else if (locationMethod == types::LocationMethod::County)
       {
@@ -218,6 +281,115 @@ void AlertManager::Impl::HandleAlert(const types::TextEventKey& key,
    }
 }
 
+std::set<std::size_t> AlertManager::Impl::SegmentsInRange(
+   const types::TextEventKey&    key,
+   const common::Coordinate&     coordinate,
+   units::length::meters<double> distance) const
+{
+   std::set<std::size_t> segments {};
+
+   const std::unique_lock lock {alertAreaMutex_};
+
+   auto it = alertAreaIds_.find(key);
+   if (it != alertAreaIds_.cend())
+   {
+      for (std::size_t id : it->second)
+      {
+         if (alertAreaIndex_.InRange(id, coordinate, distance))
+         {
+            segments.insert(alertAreas_.at(id).segment_);
+         }
+      }
+   }
+
+   return segments;
+}
+
+void AlertManager::Impl::UpdateAlertAreas(
+   const types::TextEventKey&                        key,
+   const std::shared_ptr<awips::TextProductMessage>& message)
+{
+   const auto now = scwx::util::time::now();
+
+   const std::unique_lock lock {alertAreaMutex_};
+
+   auto RemoveArea = [this](std::size_t id)
+   {
+      alertAreaIndex_.Remove(id);
+      alertAreas_.erase(id);
+   };
+
+   // Remove the previous areas of the alert
+   auto it = alertAreaIds_.find(key);
+   if (it != alertAreaIds_.cend())
+   {
+      std::for_each(it->second.cbegin(), it->second.cend(), RemoveArea);
+      alertAreaIds_.erase(it);
+   }
+
+   // Remove the areas of other alerts which have ended
+   for (auto areaIt = alertAreas_.begin(); areaIt != alertAreas_.end();)
+   {
+      if (areaIt->second.eventEnd_ < now)
+      {
+         auto& ids = alertAreaIds_[areaIt->second.key_];
+         std::erase(ids, areaIt->first);
+         if (ids.empty())
+         {
+            alertAreaIds_.erase(areaIt->second.key_);
+         }
+
+         alertAreaIndex_.Remove(areaIt->first);
+         areaIt = alertAreas_.erase(areaIt);
+      }
+      else
+      {
+         ++areaIt;
+      }
+   }
+
+   if (message == nullptr)
+   {
+      return;
+   }
+
+   // Add the areas of active segments
+   auto                     segments = message->segments();
+   std::vector<std::size_t> ids {};
+
+   for (std::size_t i = 0; i < segments.size(); ++i)
+   {
+      auto& segment = segments[i];
+
+      if (!segment->codedLocation_.has_value() ||
+          !segment->header_.has_value() ||
+          segment->header_->vtecString_.empty())
+      {
+         continue;
+      }
+
+      auto& vtec     = segment->header_->vtecString_.front();
+      auto  action   = vtec.pVtec_.action();
+      auto  eventEnd = vtec.pVtec_.event_end();
+
+      if (eventEnd < now || action == awips::PVtec::Action::Canceled)
+      {
+         continue;
+      }
+
+      const std::size_t id = nextAlertAreaId_++;
+
+      alertAreaIndex_.Insert(id, segment->codedLocation_->coordinates());
+      alertAreas_.emplace(id, AlertArea {key, i, eventEnd});
+      ids.push_back(id);
+   }
+
+   if (!ids.empty())
+   {
+      alertAreaIds_.emplace(key, std::move(ids));
+   }
+}
+
 void AlertManager::Impl::UpdateLocationTracking(
    const std::string& locationMethodName) const
 {
@@ -227,6 +399,36 @@ void AlertManager::Impl::UpdateLocationTracking(
    positionManager_->EnablePositionUpdates(uuid_, locationEnabled);
 }
 
+std::vector<types::TextEventKey>
+AlertManager::GetActiveAlerts(const common::Coordinate&     coordinate,
+                              units::length::meters<double> distance) const
+{
+   std::vector<types::TextEventKey> alerts {};
+   std::vector<std::size_t>         ids {};
+
+   const auto now = scwx::util::time::now();
+
+   const std::unique_lock lock {p->alertAreaMutex_};
+
+   p->alertAreaIndex_.Query(coordinate, distance, ids);
+
+   std::unordered_set<types::TextEventKey,
+                      types::TextEventHash<types::TextEventKey>>
+      alertSet {};
+
+   for (std::size_t id : ids)
+   {
+      const auto& alertArea = p->alertAreas_.at(id);
+
+      if (alertArea.eventEnd_ >= now && alertSet.insert(alertArea.key_).second)
+      {
+         alerts.push_back(alertArea.key_);
+      }
+   }
+
+   return alerts;
+}
+
 void AlertManager::SetRadarSite(
    const std::shared_ptr<config::RadarSite>& radarSite)
 {
@@ -1,10 +1,14 @@
 #pragma once
 
 #include <scwx/qt/config/radar_site.hpp>
+#include <scwx/qt/types/text_event_key.hpp>
+#include <scwx/common/geographic.hpp>
 
 #include <memory>
+#include <vector>
 
 #include <QObject>
+#include <units/length.h>
 
 namespace scwx
 {
@@ -22,6 +26,19 @@ public:
    explicit AlertManager();
    ~AlertManager();
 
+   /**
+    * Get the active alerts with a segment area within a distance of a
+    * location.
+    *
+    * @param [in] coordinate Location to check against each alert
+    * @param [in] distance The max distance in meters
+    *
+    * @return Active alerts in range of the location
+    */
+   [[nodiscard]] std::vector<types::TextEventKey>
+   GetActiveAlerts(const common::Coordinate&     coordinate,
+                   units::length::meters<double> distance = {}) const;
+
    void SetRadarSite(const std::shared_ptr<config::RadarSite>& radarSite);
    static std::shared_ptr<AlertManager> Instance();
 
@@ -8,6 +8,7 @@
 #include <scwx/util/json.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <filesystem>
 #include <shared_mutex>
 #include <vector>
 
@@ -155,6 +156,11 @@ public:
    std::string                           lastRadarSite_ {};
    std::chrono::system_clock::time_point lastUpdateTime_ {};
 
+   // Validators of the current placefile, used to skip unmodified reloads
+   std::string                     etag_ {};
+   std::string                     lastModified_ {};
+   std::filesystem::file_time_type lastWriteTime_ {};
+
    std::size_t failureCount_ {};
 };
 
@@ -318,6 +324,9 @@ void PlacefileManager::set_placefile_url(const std::string& name,
       auto placefileRecord        = it->second;
       placefileRecord->name_      = normalizedUrl;
       placefileRecord->placefile_ = nullptr;
+      placefileRecord->etag_.clear();
+      placefileRecord->lastModified_.clear();
+      placefileRecord->lastWriteTime_ = {};
       placefileRecord->fonts_.clear();
       placefileRecord->images_.clear();
       p->placefileRecordMap_.erase(it);
@@ -574,15 +583,31 @@ void PlacefileManager::Impl::PlacefileRecord::Update()
    const std::string name {name_};
 
    std::shared_ptr<gr::Placefile> updatedPlacefile {};
+   bool                           notModified = false;
+
+   std::string                     etag {};
+   std::string                     lastModified {};
+   std::filesystem::file_time_type lastWriteTime {};
 
    QUrl url = QUrl::fromUserInput(QString::fromStdString(name));
    if (url.isLocalFile())
    {
-      updatedPlacefile = gr::Placefile::Load(name);
+      std::error_code error;
+      lastWriteTime = std::filesystem::last_write_time(name, error);
 
-      if (updatedPlacefile == nullptr)
+      if (!error && placefile_ != nullptr && lastWriteTime == lastWriteTime_)
       {
-         logger_->error("Local placefile not found: {}", name);
+         // The local placefile has not been written since it was last loaded
+         notModified = true;
+      }
+      else
+      {
+         updatedPlacefile = gr::Placefile::Load(name);
+
+         if (updatedPlacefile == nullptr)
+         {
+            logger_->error("Local placefile not found: {}", name);
+         }
       }
    }
    else
@@ -635,14 +660,45 @@ void PlacefileManager::Impl::PlacefileRecord::Update()
          }
       }
 
+      cpr::Header header = network::cpr::GetHeader();
+
+      // Make the request conditional if the current placefile was requested
+      // for the same radar site
+      if (placefile_ != nullptr && lastRadarSite_ == p->radarSite_->id())
+      {
+         if (!etag_.empty())
+         {
+            header.insert_or_assign("If-None-Match", etag_);
+         }
+         if (!lastModified_.empty())
+         {
+            header.insert_or_assign("If-Modified-Since", lastModified_);
+         }
+      }
+
       // Send HTTP GET request
-      auto response =
-         cpr::Get(cpr::Url {decodedUrl}, network::cpr::GetHeader(), parameters);
+      auto response = cpr::Get(cpr::Url {decodedUrl}, header, parameters);
 
-      if (cpr::status::is_success(response.status_code))
+      if (response.status_code == cpr::status::HTTP_NOT_MODIFIED)
+      {
+         notModified = true;
+      }
+      else if (cpr::status::is_success(response.status_code))
       {
          std::istringstream responseBody {response.text};
          updatedPlacefile = gr::Placefile::Load(name, responseBody);
+
+         auto etagIt         = response.header.find("ETag");
+         auto lastModifiedIt = response.header.find("Last-Modified");
+
+         if (etagIt != response.header.cend())
+         {
+            etag = etagIt->second;
+         }
+         if (lastModifiedIt != response.header.cend())
+         {
+            lastModified = lastModifiedIt->second;
+         }
       }
       else if (response.status_code == 0)
       {
@@ -654,7 +710,22 @@ void PlacefileManager::Impl::PlacefileRecord::Update()
       }
    }
 
-   if (updatedPlacefile != nullptr)
+   if (notModified)
+   {
+      logger_->debug("Placefile not modified: {}", name);
+
+      // Keep the current placefile and resources, unless the name updated
+      // since the request was made
+      if (name_ == name)
+      {
+         lastUpdateTime_ = std::chrono::system_clock::now();
+         failureCount_   = 0;
+      }
+
+      // Update refresh timer
+      ScheduleRefresh();
+   }
+   else if (updatedPlacefile != nullptr)
    {
       // Load placefile resources
       auto newFonts  = Impl::LoadFontResources(updatedPlacefile);
@@ -668,6 +739,9 @@ void PlacefileManager::Impl::PlacefileRecord::Update()
          title_          = placefile_->title();
          lastUpdateTime_ = std::chrono::system_clock::now();
          failureCount_   = 0;
+         etag_           = etag;
+         lastModified_   = lastModified;
+         lastWriteTime_  = lastWriteTime;
 
          // Update font resources
          {
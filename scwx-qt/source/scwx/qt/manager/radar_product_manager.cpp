@@ -2,7 +2,8 @@
 #include <scwx/qt/manager/radar_product_manager_notifier.hpp>
 #include <scwx/qt/settings/general_settings.hpp>
 #include <scwx/qt/types/time_types.hpp>
-#include <scwx/qt/util/geographic_lib.hpp>
+#include <scwx/qt/util/loop_prefetch.hpp>
+#include <scwx/qt/util/polar_coordinate_table.hpp>
 #include <scwx/common/constants.hpp>
 #include <scwx/provider/aws_level2_chunks_data_provider.hpp>
 #include <scwx/provider/nexrad_data_provider_factory.hpp>
@@ -12,7 +13,10 @@
 #include <scwx/util/time.hpp>
 #include <scwx/wsr88d/nexrad_file_factory.hpp>
 
+#include <atomic>
 #include <execution>
+#include <future>
+#include <map>
 #include <mutex>
 #include <shared_mutex>
 #include <unordered_map>
@@ -27,8 +31,6 @@
 #include <boost/asio/steady_timer.hpp>
 #include <boost/asio/thread_pool.hpp>
 #include <boost/container_hash/hash.hpp>
-#include <boost/range/irange.hpp>
-#include <boost/timer/timer.hpp>
 #include <fmt/chrono.h>
 #include <qmaplibre.hpp>
 #include <units/angle.h>
@@ -52,18 +54,10 @@ typedef std::map<std::chrono::system_clock::time_point,
 typedef std::list<std::shared_ptr<types::RadarProductRecord>>
    RadarProductRecordList;
 
-static constexpr uint32_t NUM_RADIAL_GATES_0_5_DEGREE =
-   common::MAX_0_5_DEGREE_RADIALS * common::MAX_DATA_MOMENT_GATES;
-static constexpr uint32_t NUM_RADIAL_GATES_1_DEGREE =
-   common::MAX_1_DEGREE_RADIALS * common::MAX_DATA_MOMENT_GATES;
-static constexpr uint32_t NUM_COORIDNATES_0_5_DEGREE =
-   NUM_RADIAL_GATES_0_5_DEGREE * 2;
-static constexpr uint32_t NUM_COORIDNATES_1_DEGREE =
-   NUM_RADIAL_GATES_1_DEGREE * 2;
-
 static const std::string kDefaultLevel3Product_ {"N0B"};
 
-static constexpr std::size_t kTimerPlaces_ {6u};
+static constexpr std::size_t kDefaultCacheMemoryLimit_ =
+   4ull * 1024 * 1024 * 1024;
 
 static constexpr std::chrono::seconds kFastRetryInterval_ {15};
 static constexpr std::chrono::seconds kFastRetryIntervalChunks_ {3};
@@ -81,6 +75,22 @@ static std::shared_mutex fileIndexMutex_;
 
 static std::mutex fileLoadMutex_;
 
+// Records retained by the recent record lists of all radar product managers,
+// ordered from most to least recently used. Recent record lists are only
+// modified while holding both the owning manager's product record mutex and
+// the cached records mutex.
+struct CachedRecord
+{
+   std::shared_ptr<types::RadarProductRecord> record_;
+   RadarProductRecordList*                    recentList_;
+   RadarProductManagerImpl*                   owner_;
+   std::size_t                                size_;
+};
+static std::list<CachedRecord> cachedRecords_ {};
+static std::size_t             cachedRecordsSize_ {0u};
+static std::size_t             cacheMemoryLimit_ {kDefaultCacheMemoryLimit_};
+static std::mutex              cachedRecordsMutex_;
+
 class ProviderManager : public QObject
 {
    Q_OBJECT
@@ -175,6 +185,23 @@ public:
    }
    ~RadarProductManagerImpl()
    {
+      {
+         // Release records held by this manager's recent record lists
+         const std::unique_lock cacheLock {cachedRecordsMutex_};
+         for (auto it = cachedRecords_.begin(); it != cachedRecords_.end();)
+         {
+            if (it->owner_ == this)
+            {
+               cachedRecordsSize_ -= it->size_;
+               it = cachedRecords_.erase(it);
+            }
+            else
+            {
+               ++it;
+            }
+         }
+      }
+
       level2ProviderManager_->Disable();
       level2ChunksProviderManager_->Disable();
 
@@ -189,6 +216,10 @@ public:
                     });
       lock.unlock();
 
+      loopPrefetch_.Cancel();
+      prefetchThreadPool_.stop();
+      prefetchThreadPool_.join();
+
       threadPool_.stop();
       threadPool_.join();
    }
@@ -197,6 +228,11 @@ public:
 
    boost::asio::thread_pool threadPool_ {4u};
 
+   // Prefetch loads run one at a time, leaving the main thread pool available
+   // for products being displayed
+   boost::asio::thread_pool prefetchThreadPool_ {1u};
+   util::LoopPrefetch       loopPrefetch_ {};
+
    std::shared_ptr<ProviderManager>
    GetLevel3ProviderManager(const std::string& product);
 
@@ -216,21 +252,37 @@ public:
                           std::chrono::system_clock::time_point time);
    std::shared_ptr<types::RadarProductRecord>
    StoreRadarProductRecord(std::shared_ptr<types::RadarProductRecord> record);
+   static void EvictCachedRecords();
    void UpdateRecentRecords(RadarProductRecordList& recentList,
                             std::shared_ptr<types::RadarProductRecord> record);
+   void RemoveRecentRecord(
+      RadarProductRecordList*                           recentList,
+      const std::shared_ptr<types::RadarProductRecord>& record);
 
    void LoadNexradFileAsync(
       CreateNexradFileFunction                           load,
       const std::shared_ptr<request::NexradFileRequest>& request,
-      std::mutex&                                        mutex,
+      const ProviderManager*                             providerManager,
+      std::chrono::system_clock::time_point              time);
+   std::shared_ptr<types::RadarProductRecord> LoadNexradRecord(
+      const CreateNexradFileFunction&                    load,
+      const std::shared_ptr<request::NexradFileRequest>& request,
+      const ProviderManager*                             providerManager,
       std::chrono::system_clock::time_point              time);
    void
    LoadProviderData(std::chrono::system_clock::time_point time,
                     std::shared_ptr<ProviderManager>      providerManager,
                     RadarProductRecordMap&                recordMap,
                     std::shared_mutex&                    recordMutex,
-                    std::mutex&                           loadDataMutex,
                     const std::shared_ptr<request::NexradFileRequest>& request);
+   static std::shared_ptr<wsr88d::NexradFile>
+   LoadProviderFile(std::chrono::system_clock::time_point   time,
+                    const std::shared_ptr<ProviderManager>& providerManager,
+                    RadarProductRecordMap&                  recordMap,
+                    std::shared_mutex&                      recordMutex);
+   void PrefetchLoopSync(std::size_t                           generation,
+                         const util::LoopPrefetch::Loop&       loop,
+                         std::chrono::system_clock::time_point currentTime);
 
    bool AreLevel2ProductTimesPopulated(
       std::chrono::system_clock::time_point time) const;
@@ -246,12 +298,8 @@ public:
 
    void UpdateAvailableProductsSync();
 
-   void
-   CalculateCoordinates(const boost::integer_range<std::uint32_t>& radialGates,
-                        const units::angle::degrees<float>         radialAngle,
-                        const units::angle::degrees<float>         angleOffset,
-                        const float         gateRangeOffset,
-                        std::vector<float>& outputCoordinates);
+   std::shared_ptr<const util::PolarCoordinateTable> GetCoordinateTable(
+      float radialAngle, float angleOffset, float gateRangeOffset);
 
    static bool AreProductTimesPopulated(
       const std::shared_ptr<ProviderManager>& providerManager,
@@ -269,6 +317,10 @@ public:
                   const std::shared_ptr<request::NexradFileRequest>& request,
                   std::mutex&                                        mutex,
                   std::chrono::system_clock::time_point              time = {});
+   static std::shared_ptr<types::RadarProductRecord> CreateRadarProductRecord(
+      const std::shared_ptr<wsr88d::NexradFile>&         nexradFile,
+      const std::shared_ptr<request::NexradFileRequest>& request,
+      std::chrono::system_clock::time_point              time);
 
    const std::string radarId_;
    bool              initialized_;
@@ -276,12 +328,17 @@ public:
    bool              level3AvailabilityReady_ {false};
 
    std::shared_ptr<config::RadarSite> radarSite_;
-   std::size_t                        cacheLimit_ {6u};
 
-   std::vector<float> coordinates0_5Degree_ {};
-   std::vector<float> coordinates0_5DegreeSmooth_ {};
-   std::vector<float> coordinates1Degree_ {};
-   std::vector<float> coordinates1DegreeSmooth_ {};
+   // Records within the active loop are evicted from the cache last
+   std::chrono::system_clock::time_point cacheLoopStartTime_ {};
+   std::chrono::system_clock::time_point cacheLoopEndTime_ {};
+
+   std::shared_ptr<const util::PolarCoordinateTable> coordinates0_5Degree_ {};
+   std::shared_ptr<const util::PolarCoordinateTable>
+      coordinates0_5DegreeSmooth_ {};
+   std::shared_ptr<const util::PolarCoordinateTable> coordinates1Degree_ {};
+   std::shared_ptr<const util::PolarCoordinateTable>
+      coordinates1DegreeSmooth_ {};
 
    RadarProductRecordMap  level2ProductRecords_ {};
    RadarProductRecordList level2ProductRecentRecords_ {};
@@ -300,8 +357,14 @@ public:
 
    std::mutex initializeMutex_ {};
    std::mutex level3ProductsInitializeMutex_ {};
-   std::mutex loadLevel2DataMutex_ {};
-   std::mutex loadLevel3DataMutex_ {};
+
+   // Provider loads in progress, keyed by provider manager and time. Requests
+   // for a load in progress wait for the same record.
+   std::map<std::pair<const ProviderManager*,
+                      std::chrono::system_clock::time_point>,
+            std::shared_future<std::shared_ptr<types::RadarProductRecord>>>
+              pendingLoads_ {};
+   std::mutex pendingLoadsMutex_ {};
 
    common::Level3ProductCategoryMap availableCategoryMap_ {};
    std::shared_mutex                availableCategoryMutex_ {};
@@ -421,6 +484,16 @@ void RadarProductManager::DumpRecords()
 const std::vector<float>&
 RadarProductManager::coordinates(common::RadialSize radialSize,
                                  bool               smoothingEnabled) const
+{
+   static const std::vector<float> kEmptyCoordinates_ {};
+
+   auto table = coordinate_table(radialSize, smoothingEnabled);
+   return (table != nullptr) ? table->coordinates() : kEmptyCoordinates_;
+}
+
+std::shared_ptr<const util::PolarCoordinateTable>
+RadarProductManager::coordinate_table(common::RadialSize radialSize,
+                                      bool               smoothingEnabled) const
 {
    switch (radialSize)
    {
@@ -446,6 +519,7 @@ RadarProductManager::coordinates(common::RadialSize radialSize,
       throw std::invalid_argument("Invalid radial size");
    }
 }
+
 const scwx::util::time_zone* RadarProductManager::default_time_zone() const
 {
    types::DefaultTimeZone defaultTimeZone = types::GetDefaultTimeZone(
@@ -519,143 +593,53 @@ void RadarProductManager::Initialize()
       return;
    }
 
-   boost::timer::cpu_timer timer;
-
-   // Calculate half degree azimuth coordinates
-   timer.start();
-   std::vector<float>& coordinates0_5Degree = p->coordinates0_5Degree_;
-
-   coordinates0_5Degree.resize(NUM_COORIDNATES_0_5_DEGREE);
-
-   const auto radialGates0_5Degree =
-      boost::irange<uint32_t>(0, NUM_RADIAL_GATES_0_5_DEGREE);
+   // Coordinate tables are shared between radar product managers, and are only
+   // calculated if not already cached
 
    // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers): Values are given
    // descriptions
-   p->CalculateCoordinates(
-      radialGates0_5Degree,
-      units::angle::degrees<float> {0.5f}, // Radial angle
-      units::angle::degrees<float> {0.0f}, // Angle offset
+   p->coordinates0_5Degree_ = p->GetCoordinateTable(
+      0.5f, // Radial angle
+      0.0f, // Angle offset
       // Far end of the first gate is the gate size distance from the radar site
-      1.0f,
-      coordinates0_5Degree);
-   // NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
-
-   timer.stop();
-   logger_->debug("Coordinates (0.5 degree) calculated in {}",
-                  timer.format(kTimerPlaces_, "%ws"));
-
-   // Calculate half degree smooth azimuth coordinates
-   timer.start();
-   std::vector<float>& coordinates0_5DegreeSmooth =
-      p->coordinates0_5DegreeSmooth_;
-
-   coordinates0_5DegreeSmooth.resize(NUM_COORIDNATES_0_5_DEGREE);
-
-   // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers): Values are given
-   // descriptions
-   p->CalculateCoordinates(radialGates0_5Degree,
-                           units::angle::degrees<float> {0.5f},  // Radial angle
-                           units::angle::degrees<float> {0.25f}, // Angle offset
-                           // Center of the first gate is half the gate size
-                           // distance from the radar site
-                           0.5f,
-                           coordinates0_5DegreeSmooth);
-   // NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
-
-   timer.stop();
-   logger_->debug("Coordinates (0.5 degree smooth) calculated in {}",
-                  timer.format(kTimerPlaces_, "%ws"));
-
-   // Calculate 1 degree azimuth coordinates
-   timer.start();
-   std::vector<float>& coordinates1Degree = p->coordinates1Degree_;
-
-   coordinates1Degree.resize(NUM_COORIDNATES_1_DEGREE);
-
-   const auto radialGates1Degree =
-      boost::irange<uint32_t>(0, NUM_RADIAL_GATES_1_DEGREE);
-
-   // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers): Values are given
-   // descriptions
-   p->CalculateCoordinates(
-      radialGates1Degree,
-      units::angle::degrees<float> {1.0f}, // Radial angle
-      units::angle::degrees<float> {0.0f}, // Angle offset
+      1.0f);
+
+   p->coordinates0_5DegreeSmooth_ = p->GetCoordinateTable(
+      0.5f,  // Radial angle
+      0.25f, // Angle offset
+      // Center of the first gate is half the gate size distance from the radar
+      // site
+      0.5f);
+
+   p->coordinates1Degree_ = p->GetCoordinateTable(
+      1.0f, // Radial angle
+      0.0f, // Angle offset
       // Far end of the first gate is the gate size distance from the radar site
-      1.0f,
-      coordinates1Degree);
-   // NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
-
-   timer.stop();
-   logger_->debug("Coordinates (1 degree) calculated in {}",
-                  timer.format(kTimerPlaces_, "%ws"));
-
-   // Calculate 1 degree smooth azimuth coordinates
-   timer.start();
-   std::vector<float>& coordinates1DegreeSmooth = p->coordinates1DegreeSmooth_;
-
-   coordinates1DegreeSmooth.resize(NUM_COORIDNATES_1_DEGREE);
-
-   // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers): Values are given
-   // descriptions
-   p->CalculateCoordinates(radialGates1Degree,
-                           units::angle::degrees<float> {1.0f}, // Radial angle
-                           units::angle::degrees<float> {0.5f}, // Angle offset
-                           // Center of the first gate is half the gate size
-                           // distance from the radar site
-                           0.5f,
-                           coordinates1DegreeSmooth);
+      1.0f);
+
+   p->coordinates1DegreeSmooth_ = p->GetCoordinateTable(
+      1.0f, // Radial angle
+      0.5f, // Angle offset
+      // Center of the first gate is half the gate size distance from the radar
+      // site
+      0.5f);
    // NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
 
-   timer.stop();
-   logger_->debug("Coordinates (1 degree smooth) calculated in {}",
-                  timer.format(kTimerPlaces_, "%ws"));
-
    p->initialized_ = true;
 }
 
-void RadarProductManagerImpl::CalculateCoordinates(
-   const boost::integer_range<std::uint32_t>& radialGates,
-   const units::angle::degrees<float>         radialAngle,
-   const units::angle::degrees<float>         angleOffset,
-   const float                                gateRangeOffset,
-   std::vector<float>&                        outputCoordinates)
+std::shared_ptr<const util::PolarCoordinateTable>
+RadarProductManagerImpl::GetCoordinateTable(float radialAngle,
+                                            float angleOffset,
+                                            float gateRangeOffset)
 {
-   const GeographicLib::Geodesic& geodesic(
-      util::GeographicLib::DefaultGeodesic());
-
-   const QMapLibre::Coordinate radar(radarSite_->latitude(),
-                                     radarSite_->longitude());
-
-   const float gateSize = self_->gate_size();
-
-   std::for_each(
-      std::execution::par_unseq,
-      radialGates.begin(),
-      radialGates.end(),
-      [&](uint32_t radialGate)
-      {
-         const auto gate = static_cast<std::uint16_t>(
-            radialGate % common::MAX_DATA_MOMENT_GATES);
-         const auto radial = static_cast<std::uint16_t>(
-            radialGate / common::MAX_DATA_MOMENT_GATES);
-
-         const float angle = static_cast<float>(radial) * radialAngle.value() +
-                             angleOffset.value();
-         const float range =
-            (static_cast<float>(gate) + gateRangeOffset) * gateSize;
-         const std::size_t offset = static_cast<std::size_t>(radialGate) * 2;
-
-         double latitude  = 0.0;
-         double longitude = 0.0;
-
-         geodesic.Direct(
-            radar.first, radar.second, angle, range, latitude, longitude);
-
-         outputCoordinates[offset]     = static_cast<float>(latitude);
-         outputCoordinates[offset + 1] = static_cast<float>(longitude);
-      });
+   return util::PolarCoordinateTable::Get(
+      {.latitude_        = radarSite_->latitude(),
+       .longitude_       = radarSite_->longitude(),
+       .gateSize_        = self_->gate_size(),
+       .gateRangeOffset_ = gateRangeOffset,
+       .radialAngle_     = radialAngle,
+       .angleOffset_     = angleOffset});
 }
 
 std::shared_ptr<ProviderManager>
@@ -983,7 +967,6 @@ void RadarProductManagerImpl::LoadProviderData(
    std::shared_ptr<ProviderManager>                   providerManager,
    RadarProductRecordMap&                             recordMap,
    std::shared_mutex&                                 recordMutex,
-   std::mutex&                                        loadDataMutex,
    const std::shared_ptr<request::NexradFileRequest>& request)
 {
    logger_->trace("LoadProviderData: {}, {}",
@@ -993,44 +976,52 @@ void RadarProductManagerImpl::LoadProviderData(
    LoadNexradFileAsync(
       [=, &recordMap, &recordMutex]() -> std::shared_ptr<wsr88d::NexradFile>
       {
-         std::shared_ptr<types::RadarProductRecord> existingRecord = nullptr;
-         std::shared_ptr<wsr88d::NexradFile>        nexradFile     = nullptr;
+         return LoadProviderFile(time, providerManager, recordMap, recordMutex);
+      },
+      request,
+      providerManager.get(),
+      time);
+}
 
-         {
-            std::shared_lock sharedLock {recordMutex};
+std::shared_ptr<wsr88d::NexradFile> RadarProductManagerImpl::LoadProviderFile(
+   std::chrono::system_clock::time_point   time,
+   const std::shared_ptr<ProviderManager>& providerManager,
+   RadarProductRecordMap&                  recordMap,
+   std::shared_mutex&                      recordMutex)
+{
+   std::shared_ptr<types::RadarProductRecord> existingRecord = nullptr;
+   std::shared_ptr<wsr88d::NexradFile>        nexradFile     = nullptr;
 
-            auto it = recordMap.find(time);
-            if (it != recordMap.cend())
-            {
-               existingRecord = it->second.lock();
+   {
+      std::shared_lock sharedLock {recordMutex};
 
-               if (existingRecord != nullptr)
-               {
-                  logger_->trace(
-                     "Data previously loaded, loading from data cache");
-               }
-            }
-         }
+      auto it = recordMap.find(time);
+      if (it != recordMap.cend())
+      {
+         existingRecord = it->second.lock();
 
-         if (existingRecord == nullptr)
-         {
-            nexradFile = providerManager->provider_->LoadObjectByTime(time);
-            if (nexradFile == nullptr)
-            {
-               logger_->warn("Attempting to load object without key: {}",
-                             scwx::util::TimeString(time));
-            }
-         }
-         else
+         if (existingRecord != nullptr)
          {
-            nexradFile = existingRecord->nexrad_file();
+            logger_->trace("Data previously loaded, loading from data cache");
          }
+      }
+   }
 
-         return nexradFile;
-      },
-      request,
-      loadDataMutex,
-      time);
+   if (existingRecord == nullptr)
+   {
+      nexradFile = providerManager->provider_->LoadObjectByTime(time);
+      if (nexradFile == nullptr)
+      {
+         logger_->warn("Attempting to load object without key: {}",
+                       scwx::util::TimeString(time));
+      }
+   }
+   else
+   {
+      nexradFile = existingRecord->nexrad_file();
+   }
+
+   return nexradFile;
 }
 
 void RadarProductManager::LoadLevel2Data(
@@ -1043,7 +1034,6 @@ void RadarProductManager::LoadLevel2Data(
                        p->level2ProviderManager_,
                        p->level2ProductRecords_,
                        p->level2ProductRecordMutex_,
-                       p->loadLevel2DataMutex_,
                        request);
 }
 
@@ -1075,7 +1065,6 @@ void RadarProductManager::LoadLevel3Data(
                        level3ProviderManager->second,
                        level3ProductRecords,
                        p->level3ProductRecordMutex_,
-                       p->loadLevel3DataMutex_,
                        request);
 }
 
@@ -1149,21 +1138,86 @@ void RadarProductManager::LoadFile(
 void RadarProductManagerImpl::LoadNexradFileAsync(
    CreateNexradFileFunction                           load,
    const std::shared_ptr<request::NexradFileRequest>& request,
-   std::mutex&                                        mutex,
+   const ProviderManager*                             providerManager,
    std::chrono::system_clock::time_point              time)
 {
-   boost::asio::post(threadPool_,
-                     [=, &mutex]()
-                     {
-                        try
-                        {
-                           LoadNexradFile(load, request, mutex, time);
-                        }
-                        catch (const std::exception& ex)
-                        {
-                           logger_->error(ex.what());
-                        }
-                     });
+   boost::asio::post(
+      threadPool_,
+      [=, this]()
+      {
+         try
+         {
+            auto record =
+               LoadNexradRecord(load, request, providerManager, time);
+
+            if (request != nullptr)
+            {
+               request->set_radar_product_record(record);
+               Q_EMIT request->RequestComplete(request);
+            }
+         }
+         catch (const std::exception& ex)
+         {
+            logger_->error(ex.what());
+         }
+      });
+}
+
+std::shared_ptr<types::RadarProductRecord>
+RadarProductManagerImpl::LoadNexradRecord(
+   const CreateNexradFileFunction&                    load,
+   const std::shared_ptr<request::NexradFileRequest>& request,
+   const ProviderManager*                             providerManager,
+   std::chrono::system_clock::time_point              time)
+{
+   const auto key = std::make_pair(providerManager, time);
+
+   std::promise<std::shared_ptr<types::RadarProductRecord>> promise {};
+   std::shared_future<std::shared_ptr<types::RadarProductRecord>> future {};
+
+   {
+      const std::unique_lock lock {pendingLoadsMutex_};
+
+      auto it = pendingLoads_.find(key);
+      if (it != pendingLoads_.cend())
+      {
+         future = it->second;
+      }
+      else
+      {
+         pendingLoads_.emplace(key, promise.get_future().share());
+      }
+   }
+
+   if (future.valid())
+   {
+      // Another thread is loading the same data, wait for its result
+      logger_->trace("Waiting for load in progress: {}",
+                     scwx::util::TimeString(time));
+      return future.get();
+   }
+
+   std::shared_ptr<types::RadarProductRecord> record = nullptr;
+
+   try
+   {
+      record = CreateRadarProductRecord(load(), request, time);
+      promise.set_value(record);
+   }
+   catch (...)
+   {
+      promise.set_exception(std::current_exception());
+
+      const std::unique_lock lock {pendingLoadsMutex_};
+      pendingLoads_.erase(key);
+      throw;
+   }
+
+   // Subsequent requests are served from the record cache
+   const std::unique_lock lock {pendingLoadsMutex_};
+   pendingLoads_.erase(key);
+
+   return record;
 }
 
 void RadarProductManagerImpl::LoadNexradFile(
@@ -1174,14 +1228,27 @@ void RadarProductManagerImpl::LoadNexradFile(
 {
    std::unique_lock lock {mutex};
 
-   std::shared_ptr<wsr88d::NexradFile> nexradFile = load();
+   std::shared_ptr<types::RadarProductRecord> record =
+      CreateRadarProductRecord(load(), request, time);
 
-   std::shared_ptr<types::RadarProductRecord> record  = nullptr;
-   std::shared_ptr<RadarProductManager>       manager = nullptr;
+   lock.unlock();
+
+   if (request != nullptr)
+   {
+      request->set_radar_product_record(record);
+      Q_EMIT request->RequestComplete(request);
+   }
+}
 
-   bool fileValid = (nexradFile != nullptr);
+std::shared_ptr<types::RadarProductRecord>
+RadarProductManagerImpl::CreateRadarProductRecord(
+   const std::shared_ptr<wsr88d::NexradFile>&         nexradFile,
+   const std::shared_ptr<request::NexradFileRequest>& request,
+   std::chrono::system_clock::time_point              time)
+{
+   std::shared_ptr<types::RadarProductRecord> record = nullptr;
 
-   if (fileValid)
+   if (nexradFile != nullptr)
    {
       record = types::RadarProductRecord::Create(nexradFile);
 
@@ -1200,18 +1267,13 @@ void RadarProductManagerImpl::LoadNexradFile(
          recordRadarId = request->current_radar_site();
       }
 
-      manager = RadarProductManager::Instance(recordRadarId);
+      std::shared_ptr<RadarProductManager> manager =
+         RadarProductManager::Instance(recordRadarId);
       manager->Initialize();
       record = manager->p->StoreRadarProductRecord(record);
    }
 
-   lock.unlock();
-
-   if (request != nullptr)
-   {
-      request->set_radar_product_record(record);
-      Q_EMIT request->RequestComplete(request);
-   }
+   return record;
 }
 
 bool RadarProductManagerImpl::AreLevel2ProductTimesPopulated(
@@ -1727,8 +1789,9 @@ void RadarProductManagerImpl::UpdateRecentRecords(
    RadarProductRecordList&                    recentList,
    std::shared_ptr<types::RadarProductRecord> record)
 {
-   const std::size_t recentListMaxSize {cacheLimit_};
-   bool              iteratorErased = false;
+   const std::unique_lock cacheLock {cachedRecordsMutex_};
+
+   bool iteratorErased = false;
 
    auto it = std::find(recentList.cbegin(), recentList.cend(), record);
    if (it != recentList.cbegin() && it != recentList.cend())
@@ -1744,10 +1807,98 @@ void RadarProductManagerImpl::UpdateRecentRecords(
       recentList.push_front(record);
    }
 
-   while (recentList.size() > recentListMaxSize)
+   // Move the record to the front of the cache
+   auto cachedRecord = std::find_if(
+      cachedRecords_.begin(),
+      cachedRecords_.end(),
+      [&](const CachedRecord& cached)
+      { return cached.record_ == record && cached.recentList_ == &recentList; });
+
+   if (cachedRecord != cachedRecords_.end())
+   {
+      cachedRecords_.splice(
+         cachedRecords_.begin(), cachedRecords_, cachedRecord);
+   }
+   else
+   {
+      const std::size_t size = record->memory_usage();
+      cachedRecords_.push_front({record, &recentList, this, size});
+      cachedRecordsSize_ += size;
+   }
+
+   EvictCachedRecords();
+}
+
+void RadarProductManagerImpl::EvictCachedRecords()
+{
+   // First evict records outside of each manager's active loop, then records
+   // within the loop if the cache is still too large. The most recent record
+   // of each product is never evicted.
+   for (const bool evictLoop : {false, true})
+   {
+      for (auto it = cachedRecords_.end();
+           it != cachedRecords_.begin() &&
+           cachedRecordsSize_ > cacheMemoryLimit_;)
+      {
+         --it;
+
+         RadarProductManagerImpl* owner = it->owner_;
+         const auto               time  = it->record_->time();
+
+         const bool inLoop = (time >= owner->cacheLoopStartTime_ &&
+                              time <= owner->cacheLoopEndTime_);
+         const bool mostRecent = (it->recentList_->front() == it->record_);
+
+         if (mostRecent || (inLoop && !evictLoop))
+         {
+            continue;
+         }
+
+         if (inLoop)
+         {
+            logger_->debug("Evicting record within the active loop");
+         }
+
+         // The owning manager's product record mutex may not be acquired
+         // while holding the cached records mutex, remove the record from the
+         // recent list on the owning manager's thread pool
+         boost::asio::post(owner->threadPool_,
+                           [owner,
+                            recentList = it->recentList_,
+                            record     = it->record_]()
+                           { owner->RemoveRecentRecord(recentList, record); });
+
+         cachedRecordsSize_ -= it->size_;
+         it = cachedRecords_.erase(it);
+      }
+   }
+}
+
+void RadarProductManagerImpl::RemoveRecentRecord(
+   RadarProductRecordList*                           recentList,
+   const std::shared_ptr<types::RadarProductRecord>& record)
+{
+   std::shared_mutex& recordMutex =
+      (record->radar_product_group() == common::RadarProductGroup::Level2) ?
+         level2ProductRecordMutex_ :
+         level3ProductRecordMutex_;
+
+   const std::unique_lock lock {recordMutex};
+   const std::unique_lock cacheLock {cachedRecordsMutex_};
+
+   // The record may have been used again since it was evicted
+   const bool cached = std::any_of(
+      cachedRecords_.cbegin(),
+      cachedRecords_.cend(),
+      [&](const CachedRecord& cachedRecord)
+      {
+         return cachedRecord.record_ == record &&
+                cachedRecord.recentList_ == recentList;
+      });
+
+   if (!cached)
    {
-      // Remove from the end of the list while it's too big
-      recentList.pop_back();
+      recentList->remove(record);
    }
 }
 
@@ -1904,9 +2055,191 @@ std::vector<std::string> RadarProductManager::GetLevel3Products()
    return level3ProviderManager->provider_->GetAvailableProducts();
 }
 
-void RadarProductManager::SetCacheLimit(size_t cacheLimit)
+void RadarProductManager::SetCacheLoopWindow(
+   std::chrono::system_clock::time_point startTime,
+   std::chrono::system_clock::time_point endTime)
+{
+   const std::unique_lock cacheLock {cachedRecordsMutex_};
+   p->cacheLoopStartTime_ = startTime;
+   p->cacheLoopEndTime_   = endTime;
+}
+
+void RadarProductManager::PrefetchLoop(
+   std::chrono::system_clock::time_point                  startTime,
+   std::chrono::system_clock::time_point                  endTime,
+   std::chrono::system_clock::time_point                  currentTime,
+   const std::set<std::chrono::system_clock::time_point>& volumeTimes,
+   bool                                                   reverse,
+   bool                                                   timeSelected)
+{
+   const util::LoopPrefetch::Loop loop {startTime, endTime, reverse};
+
+   // The prefetch in progress continues while the loop is played, and while
+   // the loop window advances without new volume scans
+   const std::optional<std::size_t> generation =
+      p->loopPrefetch_.Start(loop, volumeTimes, timeSelected);
+   if (!generation.has_value())
+   {
+      return;
+   }
+
+   boost::asio::post(p->prefetchThreadPool_,
+                     [=, this]()
+                     {
+                        try
+                        {
+                           p->PrefetchLoopSync(
+                              generation.value(), loop, currentTime);
+                        }
+                        catch (const std::exception& ex)
+                        {
+                           logger_->error(ex.what());
+                        }
+                     });
+}
+
+void RadarProductManager::CancelPrefetch()
+{
+   p->loopPrefetch_.Cancel();
+}
+
+void RadarProductManagerImpl::PrefetchLoopSync(
+   std::size_t                           generation,
+   const util::LoopPrefetch::Loop&       loop,
+   std::chrono::system_clock::time_point currentTime)
+{
+   struct PrefetchItem
+   {
+      std::chrono::system_clock::time_point time_;
+      std::shared_ptr<ProviderManager>      providerManager_;
+      RadarProductRecordMap*                recordMap_;
+      std::shared_mutex*                    recordMutex_;
+   };
+
+   if (loopPrefetch_.IsCancelled(generation))
+   {
+      // A newer prefetch has been requested
+      return;
+   }
+
+   // Find the products displayed on each map. Chunks are only used for the
+   // latest volume scan, and are not prefetched.
+   std::set<std::shared_ptr<ProviderManager>> providerManagers {};
+   {
+      const std::shared_lock lock {refreshMapMutex_};
+      for (auto& refreshEntry : refreshMap_)
+      {
+         for (auto& providerManager : refreshEntry.second)
+         {
+            if (!providerManager->isChunks_)
+            {
+               providerManagers.insert(providerManager);
+            }
+         }
+      }
+   }
+
+   // Find the products within the loop which are not loaded
+   std::vector<PrefetchItem> items {};
+
+   for (auto& providerManager : providerManagers)
+   {
+      RadarProductRecordMap* recordMap   = &level2ProductRecords_;
+      std::shared_mutex*     recordMutex = &level2ProductRecordMutex_;
+
+      if (providerManager->group_ == common::RadarProductGroup::Level3)
+      {
+         const std::unique_lock lock {level3ProductRecordMutex_};
+         recordMap   = &level3ProductRecordsMap_[providerManager->product_];
+         recordMutex = &level3ProductRecordMutex_;
+      }
+
+      // Walk the times available from the provider which loads the product.
+      // The Level 2 record map also contains times from the chunks provider,
+      // which the archive provider cannot load.
+      std::set<std::chrono::system_clock::time_point> times {};
+      for (auto date = std::chrono::floor<std::chrono::days>(loop.startTime_) -
+                       std::chrono::days {1};
+           date <= loop.endTime_;
+           date += std::chrono::days {1})
+      {
+         auto timePoints =
+            providerManager->provider_->GetTimePointsByDate(date, false);
+         times.insert(timePoints.cbegin(), timePoints.cend());
+      }
+
+      const std::shared_lock lock {*recordMutex};
+
+      // Include the product in effect at the start of the loop
+      for (auto it = scwx::util::GetBoundedElementIterator(times,
+                                                           loop.startTime_);
+           it != times.cend() && *it <= loop.endTime_;
+           ++it)
+      {
+         auto recordIt = recordMap->find(*it);
+         if (recordIt == recordMap->cend() || recordIt->second.expired())
+         {
+            items.push_back({*it, providerManager, recordMap, recordMutex});
+         }
+      }
+   }
+
+   if (items.empty())
+   {
+      return;
+   }
+
+   // Order products by the time until they are played, wrapping at the end of
+   // the loop
+   util::LoopPrefetch::SortByPlayOrder(
+      items, loop, currentTime, &PrefetchItem::time_);
+
+   logger_->debug("Prefetching {} products", items.size());
+
+   for (auto& item : items)
+   {
+      if (loopPrefetch_.IsCancelled(generation))
+      {
+         logger_->debug("Prefetch cancelled");
+         return;
+      }
+
+      {
+         // Skip products loaded since the prefetch was queued
+         const std::shared_lock lock {*item.recordMutex_};
+         auto                   it = item.recordMap_->find(item.time_);
+         if (it != item.recordMap_->cend() && !it->second.expired())
+         {
+            continue;
+         }
+      }
+
+      logger_->trace("Prefetch: {}, {}",
+                     item.providerManager_->name(),
+                     scwx::util::TimeString(item.time_));
+
+      // Requests for the same product wait on this load
+      auto request = std::make_shared<request::NexradFileRequest>(radarId_);
+
+      LoadNexradRecord(
+         [&]()
+         {
+            return LoadProviderFile(item.time_,
+                                    item.providerManager_,
+                                    *item.recordMap_,
+                                    *item.recordMutex_);
+         },
+         request,
+         item.providerManager_.get(),
+         item.time_);
+   }
+}
+
+void RadarProductManager::SetCacheMemoryLimit(std::size_t cacheMemoryLimit)
 {
-   p->cacheLimit_ = std::max<std::size_t>(cacheLimit, 6u);
+   const std::unique_lock cacheLock {cachedRecordsMutex_};
+   cacheMemoryLimit_ = cacheMemoryLimit;
+   RadarProductManagerImpl::EvictCachedRecords();
 }
 
 void RadarProductManager::UpdateAvailableProducts()
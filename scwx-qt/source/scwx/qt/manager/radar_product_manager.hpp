@@ -6,6 +6,7 @@
 #include <scwx/qt/request/nexrad_file_request.hpp>
 #include <scwx/qt/types/radar_product_record.hpp>
 #include <scwx/qt/types/radar_product_types.hpp>
+#include <scwx/qt/util/polar_coordinate_table.hpp>
 #include <scwx/util/time.hpp>
 #include <scwx/wsr88d/ar2v_file.hpp>
 #include <scwx/wsr88d/level3_file.hpp>
@@ -39,6 +40,8 @@ public:
 
    [[nodiscard]] const std::vector<float>&
    coordinates(common::RadialSize radialSize, bool smoothingEnabled) const;
+   [[nodiscard]] std::shared_ptr<const util::PolarCoordinateTable>
+   coordinate_table(common::RadialSize radialSize, bool smoothingEnabled) const;
    [[nodiscard]] const scwx::util::time_zone* default_time_zone() const;
    [[nodiscard]] float                        gate_size() const;
    [[nodiscard]] std::optional<float> incoming_level_2_elevation() const;
@@ -132,12 +135,53 @@ public:
    std::vector<std::string>         GetLevel3Products();
 
    /**
-    * @brief Set the maximum number of products of each type that may be cached.
-    * The cache limit cannot be set lower than 6.
+    * @brief Set the time range of the active loop. Cached products within the
+    * loop are only evicted if the cache cannot otherwise be kept within its
+    * memory limit.
     *
-    * @param [in] cacheLimit The maximum number of products of each type
+    * @param [in] startTime Time of the first product in the loop
+    * @param [in] endTime Time of the last product in the loop
     */
-   void SetCacheLimit(std::size_t cacheLimit);
+   void SetCacheLoopWindow(std::chrono::system_clock::time_point startTime,
+                           std::chrono::system_clock::time_point endTime);
+
+   /**
+    * @brief Load the products displayed on each map within the active loop in
+    * the background, in the order they will be played. Products nearest the
+    * current time are loaded first. Replaces any prefetch in progress, unless
+    * the volume scans in the loop are unchanged and the time was advanced by
+    * playing the loop.
+    *
+    * @param [in] startTime Start time of the loop
+    * @param [in] endTime End time of the loop
+    * @param [in] currentTime Currently selected time
+    * @param [in] volumeTimes Active volume scan times
+    * @param [in] reverse Whether the loop is played in reverse
+    * @param [in] timeSelected Whether the current time was selected, rather
+    * than advanced by playing the loop
+    */
+   void PrefetchLoop(
+      std::chrono::system_clock::time_point                  startTime,
+      std::chrono::system_clock::time_point                  endTime,
+      std::chrono::system_clock::time_point                  currentTime,
+      const std::set<std::chrono::system_clock::time_point>& volumeTimes,
+      bool                                                   reverse = false,
+      bool timeSelected = true);
+
+   /**
+    * @brief Cancel any products queued by PrefetchLoop which have not yet
+    * started loading.
+    */
+   void CancelPrefetch();
+
+   /**
+    * @brief Set the memory limit of cached products, shared by all radar
+    * product managers. The most recent product of each type is always
+    * retained.
+    *
+    * @param [in] cacheMemoryLimit Memory limit in bytes
+    */
+   static void SetCacheMemoryLimit(std::size_t cacheMemoryLimit);
 
    void UpdateAvailableProducts();
 
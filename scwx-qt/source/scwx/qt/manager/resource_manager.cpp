@@ -25,19 +25,41 @@ static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 static const size_t atlasWidth  = 2048;
 static const size_t atlasHeight = 2048;
 
-static void LoadFonts();
-static void LoadTextures();
-
 static const std::vector<std::pair<types::Font, std::string>> fontNames_ {
    {types::Font::din1451alt, ":/res/fonts/din1451alt.ttf"},
    {types::Font::din1451alt_g, ":/res/fonts/din1451alt_g.ttf"},
    {types::Font::Inconsolata_Regular, ":/res/fonts/Inconsolata-Regular.ttf"},
    {types::Font::RobotoFlex_Regular, ":/res/fonts/RobotoFlex-Regular.ttf"}};
 
-void Initialize()
+void InitializeFonts()
+{
+   auto& fontManager = FontManager::Instance();
+
+   for (auto& fontName : fontNames_)
+   {
+      fontManager.LoadApplicationFont(fontName.first, fontName.second);
+   }
+
+   fontManager.InitializeFonts();
+}
+
+void InitializeTextures()
 {
-   LoadFonts();
-   LoadTextures();
+   util::TextureAtlas& textureAtlas = util::TextureAtlas::Instance();
+
+   for (auto imageTexture : types::ImageTextureIterator())
+   {
+      textureAtlas.RegisterTexture(GetTextureName(imageTexture),
+                                   GetTexturePath(imageTexture));
+   }
+
+   for (auto lineTexture : types::LineTextureIterator())
+   {
+      textureAtlas.RegisterTexture(GetTextureName(lineTexture),
+                                   GetTexturePath(lineTexture));
+   }
+
+   BuildAtlas();
 }
 
 void Shutdown() {}
@@ -84,37 +106,6 @@ LoadImageResources(const std::vector<std::string>& urlStrings)
    return images;
 }
 
-static void LoadFonts()
-{
-   auto& fontManager = FontManager::Instance();
-
-   for (auto& fontName : fontNames_)
-   {
-      fontManager.LoadApplicationFont(fontName.first, fontName.second);
-   }
-
-   fontManager.InitializeFonts();
-}
-
-static void LoadTextures()
-{
-   util::TextureAtlas& textureAtlas = util::TextureAtlas::Instance();
-
-   for (auto imageTexture : types::ImageTextureIterator())
-   {
-      textureAtlas.RegisterTexture(GetTextureName(imageTexture),
-                                   GetTexturePath(imageTexture));
-   }
-
-   for (auto lineTexture : types::LineTextureIterator())
-   {
-      textureAtlas.RegisterTexture(GetTextureName(lineTexture),
-                                   GetTexturePath(lineTexture));
-   }
-
-   BuildAtlas();
-}
-
 void BuildAtlas()
 {
    util::TextureAtlas& textureAtlas = util::TextureAtlas::Instance();
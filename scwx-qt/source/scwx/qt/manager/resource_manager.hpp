@@ -15,7 +15,16 @@ namespace manager
 namespace ResourceManager
 {
 
-void Initialize();
+/**
+ * Loads application fonts. Must be called from the main thread.
+ */
+void InitializeFonts();
+
+/**
+ * Loads and builds the texture atlas. May be called from any thread.
+ */
+void InitializeTextures();
+
 void Shutdown();
 
 std::shared_ptr<boost::gil::rgba8_image_t>
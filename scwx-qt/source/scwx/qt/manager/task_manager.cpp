@@ -20,8 +20,9 @@ void Initialize()
    ntpClient_              = network::NtpClient::Instance();
    radarSiteStatusManager_ = manager::RadarSiteStatusManager::Instance();
 
+   // Don't wait for the initial time offset. The offset is applied to the
+   // current time once the first response is received.
    ntpClient_->Start();
-   ntpClient_->WaitForInitialOffset();
 
    radarSiteStatusManager_->Start();
 }
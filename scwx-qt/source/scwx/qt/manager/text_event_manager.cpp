@@ -11,8 +11,10 @@
 #include <atomic>
 #include <list>
 #include <map>
+#include <optional>
 #include <shared_mutex>
 #include <unordered_map>
+#include <unordered_set>
 
 #include <boost/asio/post.hpp>
 #include <boost/asio/steady_timer.hpp>
@@ -124,8 +126,15 @@ public:
    Impl(const Impl&&)            = delete;
    Impl& operator=(const Impl&&) = delete;
 
-   void HandleMessage(const std::shared_ptr<awips::TextProductMessage>& message,
-                      bool archiveEvent = false);
+   std::optional<types::TextEventKey>
+   HandleMessage(const std::shared_ptr<awips::TextProductMessage>& message,
+                 bool archiveEvent = false);
+   void HandleMessages(
+      const std::vector<std::shared_ptr<awips::TextProductMessage>>& messages,
+      bool archiveEvent = false);
+   void HandleFiles(
+      const std::vector<std::shared_ptr<awips::TextProductFile>>& files,
+      bool archiveEvent = false);
    template<ranges::forward_range DateRange>
       requires std::same_as<ranges::range_value_t<DateRange>,
                             std::chrono::sys_days>
@@ -155,6 +164,10 @@ public:
                       std::vector<std::shared_ptr<awips::TextProductMessage>>,
                       types::TextEventHash<types::TextEventKey>>
                      textEventMap_;
+   std::unordered_map<types::TextEventKey,
+                      awips::WmoHeaderSet,
+                      types::TextEventHash<types::TextEventKey>>
+                     textEventWmoHeaderMap_ {};
    std::shared_mutex textEventMutex_;
 
    std::shared_ptr<provider::WarningsProvider> warningsProvider_ {nullptr};
@@ -236,11 +249,7 @@ void TextEventManager::LoadFile(const std::string& filename)
                            }
 
                            // Process messages
-                           auto messages = file.messages();
-                           for (auto& message : messages)
-                           {
-                              p->HandleMessage(message);
-                           }
+                           p->HandleMessages(file.messages());
                         }
                         catch (const std::exception& ex)
                         {
@@ -294,7 +303,48 @@ void TextEventManager::SelectTime(
       });
 }
 
-void TextEventManager::Impl::HandleMessage(
+void TextEventManager::Impl::HandleMessages(
+   const std::vector<std::shared_ptr<awips::TextProductMessage>>& messages,
+   bool                                                           archiveEvent)
+{
+   std::unordered_set<types::TextEventKey,
+                      types::TextEventHash<types::TextEventKey>>
+      updatedKeys {};
+
+   for (auto& message : messages)
+   {
+      auto key = HandleMessage(message, archiveEvent);
+      if (key.has_value())
+      {
+         updatedKeys.insert(std::move(key.value()));
+      }
+   }
+
+   // Notify consumers once for the entire set of messages
+   if (!updatedKeys.empty())
+   {
+      Q_EMIT self_->AlertsUpdated(updatedKeys);
+   }
+}
+
+void TextEventManager::Impl::HandleFiles(
+   const std::vector<std::shared_ptr<awips::TextProductFile>>& files,
+   bool                                                        archiveEvent)
+{
+   std::vector<std::shared_ptr<awips::TextProductMessage>> messages {};
+
+   for (auto& file : files)
+   {
+      auto fileMessages = file->messages();
+      messages.insert(messages.end(),
+                      std::make_move_iterator(fileMessages.begin()),
+                      std::make_move_iterator(fileMessages.end()));
+   }
+
+   HandleMessages(messages, archiveEvent);
+}
+
+std::optional<types::TextEventKey> TextEventManager::Impl::HandleMessage(
    const std::shared_ptr<awips::TextProductMessage>& message, bool archiveEvent)
 {
    using namespace std::chrono_literals;
@@ -304,7 +354,7 @@ void TextEventManager::Impl::HandleMessage(
    // If there are no segments, skip this message
    if (segments.empty())
    {
-      return;
+      return std::nullopt;
    }
 
    for (auto& segment : segments)
@@ -315,7 +365,7 @@ void TextEventManager::Impl::HandleMessage(
       if (!segment->header_.has_value() ||
           segment->header_->vtecString_.empty())
       {
-         return;
+         return std::nullopt;
       }
    }
 
@@ -330,9 +380,8 @@ void TextEventManager::Impl::HandleMessage(
    // Find a matching event in the event map
    auto&               vtecString = segments[0]->header_->vtecString_;
    types::TextEventKey key {vtecString[0].pVtec_, wmoYear};
-   size_t              messageIndex = 0;
-   auto                it           = textEventMap_.find(key);
-   bool                updated      = false;
+   auto                it      = textEventMap_.find(key);
+   bool                updated = false;
 
    if (
       // If there was no matching event
@@ -354,8 +403,8 @@ void TextEventManager::Impl::HandleMessage(
    {
       // If there was no matching event, add the message to a new event
       textEventMap_.emplace(key, std::vector {message});
-      messageIndex = 0;
-      updated      = true;
+      textEventWmoHeaderMap_[key] = {message->wmo_header()};
+      updated                     = true;
 
       if (!archiveEvent)
       {
@@ -363,13 +412,7 @@ void TextEventManager::Impl::HandleMessage(
          liveEventKeys_.insert(key);
       }
    }
-   else if (std::find_if(it->second.cbegin(),
-                         it->second.cend(),
-                         [=](auto& storedMessage)
-                         {
-                            return *message->wmo_header().get() ==
-                                   *storedMessage->wmo_header().get();
-                         }) == it->second.cend())
+   else if (textEventWmoHeaderMap_[key].insert(message->wmo_header()).second)
    {
       // If there was a matching event, and this message has not been stored
       // (WMO header equivalence check), add the updated message to the existing
@@ -390,7 +433,6 @@ void TextEventManager::Impl::HandleMessage(
          });
 
       // Insert the message in chronological order
-      messageIndex = std::distance(it->second.begin(), insertionPoint);
       it->second.insert(insertionPoint, message);
       updated = true;
    };
@@ -410,8 +452,10 @@ void TextEventManager::Impl::HandleMessage(
 
    if (updated)
    {
-      Q_EMIT self_->AlertUpdated(key, messageIndex, message->uuid());
+      return key;
    }
+
+   return std::nullopt;
 }
 
 template<ranges::forward_range DateRange>
@@ -550,15 +594,7 @@ void TextEventManager::Impl::LoadArchives(
    }
 
    // Process loaded products
-   for (auto& product : products)
-   {
-      const auto& messages = product->messages();
-
-      for (auto& message : messages)
-      {
-         HandleMessage(message, true);
-      }
-   }
+   HandleFiles(products, true);
 }
 
 void TextEventManager::Impl::PruneArchives()
@@ -644,6 +680,7 @@ void TextEventManager::Impl::PruneArchives()
    for (const auto& eventKey : eventKeysToPrune)
    {
       textEventMap_.erase(eventKey);
+      textEventWmoHeaderMap_.erase(eventKey);
    }
 
    // If event keys were pruned, emit a signal
@@ -709,13 +746,7 @@ void TextEventManager::Impl::Refresh()
    loadHistoryDuration_ = kDefaultLoadHistoryDuration_;
 
    // Handle messages
-   for (auto& file : updatedFiles)
-   {
-      for (auto& message : file->messages())
-      {
-         HandleMessage(message);
-      }
-   }
+   HandleFiles(updatedFiles);
 
    // Check for shutdown
    if (stopping_)
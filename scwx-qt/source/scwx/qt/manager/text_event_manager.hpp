@@ -40,9 +40,16 @@ signals:
       const std::unordered_set<types::TextEventKey,
                                types::TextEventHash<types::TextEventKey>>&
          keys);
-   void AlertUpdated(const types::TextEventKey& key,
-                     std::size_t                messageIndex,
-                     boost::uuids::uuid         uuid);
+
+   /**
+    * Emitted after a set of messages has been processed, with the keys of all
+    * events which received new messages. Updates are coalesced, so a key is
+    * present once regardless of how many of its messages were added.
+    */
+   void AlertsUpdated(
+      const std::unordered_set<types::TextEventKey,
+                               types::TextEventHash<types::TextEventKey>>&
+         keys);
 
 private:
    class Impl;
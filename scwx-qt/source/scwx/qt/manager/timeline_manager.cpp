@@ -67,9 +67,15 @@ public:
    std::pair<std::chrono::system_clock::time_point,
              std::chrono::system_clock::time_point>
         GetLoopStartAndEndTimes();
-   void UpdateCacheLimit(
+   void UpdateCacheLoopWindow(
       std::shared_ptr<manager::RadarProductManager> radarProductManager,
       const std::set<std::chrono::system_clock::time_point>& volumeTimes);
+   void UpdatePrefetch(
+      std::shared_ptr<manager::RadarProductManager>          radarProductManager,
+      const std::set<std::chrono::system_clock::time_point>& volumeTimes,
+      std::chrono::system_clock::time_point                  selectedTime,
+      bool                                                   timeSelected);
+   void CancelPrefetch();
 
    void RadarSweepMonitorDisable();
    void RadarSweepMonitorReset();
@@ -81,7 +87,8 @@ public:
    void
    SelectTimeAsync(std::chrono::system_clock::time_point selectedTime = {});
    std::pair<bool, bool>
-        SelectTime(std::chrono::system_clock::time_point selectedTime = {});
+        SelectTime(std::chrono::system_clock::time_point selectedTime = {},
+                   bool                                  timeSelected = true);
    void StepAsync(Direction direction);
    void Step(Direction direction);
 
@@ -100,6 +107,7 @@ public:
    std::chrono::minutes                  loopTime_;
    double                                loopSpeed_;
    std::chrono::milliseconds             loopDelay_;
+   Direction                             direction_ {Direction::Next};
 
    bool                    radarSweepMonitorActive_ {false};
    std::mutex              radarSweepMonitorMutex_ {};
@@ -112,6 +120,9 @@ public:
    std::mutex                animationTimerMutex_ {};
 
    std::mutex selectTimeMutex_ {};
+
+   std::weak_ptr<manager::RadarProductManager> prefetchManager_ {};
+   std::mutex                                  prefetchMutex_ {};
 };
 
 TimelineManager::TimelineManager() : p(std::make_unique<Impl>(this)) {}
@@ -404,21 +415,69 @@ TimelineManager::Impl::GetLoopStartAndEndTimes()
    return {startTime, endTime};
 }
 
-void TimelineManager::Impl::UpdateCacheLimit(
+void TimelineManager::Impl::UpdateCacheLoopWindow(
    std::shared_ptr<manager::RadarProductManager>          radarProductManager,
    const std::set<std::chrono::system_clock::time_point>& volumeTimes)
 {
-   // Calculate the number of volume scans in the loop
+   // Determine the volume scans bounding the loop
    auto [startTime, endTime] = GetLoopStartAndEndTimes();
    auto startIter =
       scwx::util::GetBoundedElementIterator(volumeTimes, startTime);
    auto endIter = scwx::util::GetBoundedElementIterator(volumeTimes, endTime);
-   std::size_t numVolumeScans = std::distance(startIter, endIter) + 1;
 
-   // Dynamically update maximum cached volume scans to the lesser of
-   // either 1.5x the loop length or 5 greater than the loop length
-   radarProductManager->SetCacheLimit(std::min(
-      static_cast<std::size_t>(numVolumeScans * 1.5), numVolumeScans + 5u));
+   if (startIter == volumeTimes.cend() || endIter == volumeTimes.cend())
+   {
+      return;
+   }
+
+   // Retain the volume scans in the loop when the cache is trimmed
+   radarProductManager->SetCacheLoopWindow(*startIter, *endIter);
+}
+
+void TimelineManager::Impl::UpdatePrefetch(
+   std::shared_ptr<manager::RadarProductManager>          radarProductManager,
+   const std::set<std::chrono::system_clock::time_point>& volumeTimes,
+   std::chrono::system_clock::time_point                  selectedTime,
+   bool                                                   timeSelected)
+{
+   auto [startTime, endTime] = GetLoopStartAndEndTimes();
+
+   std::unique_lock lock {prefetchMutex_};
+
+   // Cancel prefetching for the previous radar site
+   auto previousManager = prefetchManager_.lock();
+   if (previousManager != nullptr && previousManager != radarProductManager)
+   {
+      previousManager->CancelPrefetch();
+   }
+
+   prefetchManager_ = radarProductManager;
+
+   lock.unlock();
+
+   // Load upcoming products in the loop ahead of playback. If the time was
+   // selected, or the volume scans in the loop have changed, this replaces any
+   // previous prefetch, so products are loaded in order from the new time.
+   // Otherwise, playback follows the prefetch in progress.
+   radarProductManager->PrefetchLoop(startTime,
+                                     endTime,
+                                     selectedTime,
+                                     volumeTimes,
+                                     direction_ == Direction::Back,
+                                     timeSelected);
+}
+
+void TimelineManager::Impl::CancelPrefetch()
+{
+   const std::unique_lock lock {prefetchMutex_};
+
+   auto radarProductManager = prefetchManager_.lock();
+   if (radarProductManager != nullptr)
+   {
+      radarProductManager->CancelPrefetch();
+   }
+
+   prefetchManager_.reset();
 }
 
 void TimelineManager::Impl::Play()
@@ -459,6 +518,8 @@ void TimelineManager::Impl::PlaySync()
    std::chrono::system_clock::time_point currentTime = selectedTime_;
    std::chrono::system_clock::time_point newTime;
 
+   direction_ = Direction::Next;
+
    if (currentTime < startTime || currentTime >= endTime)
    {
       // If the currently selected time is out of the loop, select the
@@ -482,7 +543,7 @@ void TimelineManager::Impl::PlaySync()
 
    // Select the time
    auto selectTimeStart = std::chrono::steady_clock::now();
-   SelectTime(newTime);
+   SelectTime(newTime, false);
    auto selectTimeEnd = std::chrono::steady_clock::now();
    auto elapsedTime   = selectTimeEnd - selectTimeStart;
 
@@ -546,7 +607,7 @@ void TimelineManager::Impl::SelectTimeAsync(
 }
 
 std::pair<bool, bool> TimelineManager::Impl::SelectTime(
-   std::chrono::system_clock::time_point selectedTime)
+   std::chrono::system_clock::time_point selectedTime, bool timeSelected)
 {
    bool volumeTimeUpdated   = false;
    bool selectedTimeUpdated = false;
@@ -559,6 +620,8 @@ std::pair<bool, bool> TimelineManager::Impl::SelectTime(
    else if (selectedTime == std::chrono::system_clock::time_point {})
    {
       // If a default time point is given, reset to a live view
+      CancelPrefetch();
+
       selectedTime_      = selectedTime;
       adjustedTime_      = selectedTime;
       previousRadarSite_ = radarSite_;
@@ -578,13 +641,21 @@ std::pair<bool, bool> TimelineManager::Impl::SelectTime(
    // Take a lock for time selection
    std::unique_lock lock {selectTimeMutex_};
 
+   const bool radarSiteChanged = (radarSite_ != previousRadarSite_);
+
    // Request active volume times
    auto radarProductManager =
       manager::RadarProductManager::Instance(radarSite_);
    auto volumeTimes = radarProductManager->GetActiveVolumeTimes(selectedTime);
 
-   // Dynamically update maximum cached volume scans
-   UpdateCacheLimit(radarProductManager, volumeTimes);
+   // Dynamically update the cached volume scans to retain
+   UpdateCacheLoopWindow(radarProductManager, volumeTimes);
+
+   // Prefetch the remainder of the loop
+   UpdatePrefetch(radarProductManager,
+                  volumeTimes,
+                  selectedTime,
+                  timeSelected || radarSiteChanged);
 
    // Find the best match bounded time
    auto elementPtr =
@@ -657,6 +728,8 @@ void TimelineManager::Impl::Step(Direction direction)
 
    std::chrono::system_clock::time_point newTime = selectedTime_;
 
+   direction_ = direction;
+
    if (newTime == std::chrono::system_clock::time_point {})
    {
       if (direction == Direction::Back)
@@ -703,7 +776,7 @@ void TimelineManager::Impl::Step(Direction direction)
       RadarSweepMonitorReset();
 
       // Select the time
-      SelectTime(newTime);
+      SelectTime(newTime, false);
 
       // Wait for radar sweeps to update
       RadarSweepMonitorWait(radarSweepMonitorLock);
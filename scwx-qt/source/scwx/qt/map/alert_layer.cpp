@@ -11,17 +11,17 @@
 #include <chrono>
 #include <mutex>
 #include <ranges>
-#include <set>
 #include <shared_mutex>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
-#include <boost/algorithm/string/join.hpp>
 #include <boost/asio/system_timer.hpp>
 #include <boost/asio/thread_pool.hpp>
 #include <boost/container/stable_vector.hpp>
 #include <boost/container_hash/hash.hpp>
+#include <fmt/ranges.h>
 #include <QEvent>
 
 namespace scwx::qt::map
@@ -73,9 +73,9 @@ public:
    explicit AlertLayerHandler()
    {
       connect(textEventManager_.get(),
-              &manager::TextEventManager::AlertUpdated,
+              &manager::TextEventManager::AlertsUpdated,
               this,
-              &AlertLayerHandler::HandleAlert);
+              &AlertLayerHandler::HandleAlerts);
       connect(textEventManager_.get(),
               &manager::TextEventManager::AlertsRemoved,
               this,
@@ -100,9 +100,16 @@ public:
       types::TextEventHash<types::TextEventKey>>
       segmentsByKey_ {};
 
-   void HandleAlert(const types::TextEventKey& key,
-                    size_t                     messageIndex,
-                    boost::uuids::uuid         uuid);
+   std::unordered_map<
+      types::TextEventKey,
+      std::unordered_set<std::shared_ptr<const awips::TextProductMessage>>,
+      types::TextEventHash<types::TextEventKey>>
+      handledMessagesByKey_ {};
+
+   void HandleAlerts(
+      const std::unordered_set<types::TextEventKey,
+                               types::TextEventHash<types::TextEventKey>>&
+         keys);
    void HandleAlertsRemoved(
       const std::unordered_set<types::TextEventKey,
                                types::TextEventHash<types::TextEventKey>>&
@@ -115,11 +122,24 @@ public:
 
    std::shared_mutex alertMutex_ {};
 
+private:
+   void HandleMessage(
+      const types::TextEventKey&                                     key,
+      const std::vector<std::shared_ptr<awips::TextProductMessage>>& messages,
+      std::size_t                                  messageIndex,
+      std::vector<std::shared_ptr<SegmentRecord>>& segmentsAdded,
+      std::vector<std::shared_ptr<SegmentRecord>>& segmentsUpdated,
+      std::unordered_set<std::pair<awips::Phenomenon, bool>,
+                         AlertTypeHash<std::pair<awips::Phenomenon, bool>>>&
+         alertsUpdated);
+
 signals:
-   void AlertAdded(const std::shared_ptr<SegmentRecord>& segmentRecord,
-                   awips::Phenomenon                     phenomenon);
-   void AlertUpdated(const std::shared_ptr<SegmentRecord>& segmentRecord);
-   void AlertsRemoved(awips::Phenomenon phenomenon);
+   void
+   SegmentsAdded(const std::vector<std::shared_ptr<SegmentRecord>>& segments);
+   void SegmentsUpdated(
+      const std::vector<std::shared_ptr<SegmentRecord>>& segments);
+   void
+   SegmentsRemoved(const std::vector<std::shared_ptr<SegmentRecord>>& segments);
    void AlertsUpdated(awips::Phenomenon phenomenon, bool alertActive);
 };
 
@@ -174,6 +194,8 @@ public:
       const std::shared_ptr<AlertLayerHandler::SegmentRecord>& segmentRecord);
    void UpdateAlert(
       const std::shared_ptr<AlertLayerHandler::SegmentRecord>& segmentRecord);
+   void RemoveAlert(
+      const std::shared_ptr<AlertLayerHandler::SegmentRecord>& segmentRecord);
    void ConnectAlertHandlerSignals();
    void ConnectSignals();
    void HandleGeoLinesEvent(std::weak_ptr<gl::draw::GeoLineDrawItem>& di,
@@ -206,7 +228,6 @@ public:
                  boost::container::stable_vector<
                     std::shared_ptr<gl::draw::GeoLineDrawItem>>& drawItems);
    void PopulateLines(bool alertActive);
-   void RepopulateLines();
    void UpdateLines();
 
    static LineData CreateLineData(const settings::LineSettings& lineSettings);
@@ -330,38 +351,76 @@ bool IsAlertActive(const std::shared_ptr<const awips::Segment>& segment)
    return alertActive;
 }
 
-void AlertLayerHandler::HandleAlert(const types::TextEventKey& key,
-                                    size_t                     messageIndex,
-                                    boost::uuids::uuid         uuid)
+void AlertLayerHandler::HandleAlerts(
+   const std::unordered_set<types::TextEventKey,
+                            types::TextEventHash<types::TextEventKey>>& keys)
 {
-   logger_->trace("HandleAlert: {}", key.ToString());
+   logger_->trace("HandleAlerts: {} keys", keys.size());
 
    std::unordered_set<std::pair<awips::Phenomenon, bool>,
                       AlertTypeHash<std::pair<awips::Phenomenon, bool>>>
       alertsUpdated {};
 
-   const auto& messageList = textEventManager_->message_list(key);
+   std::vector<std::shared_ptr<SegmentRecord>> segmentsAdded {};
+   std::vector<std::shared_ptr<SegmentRecord>> segmentsUpdated {};
+
+   // Take a unique mutex once for the batch before modifying segments
+   std::unique_lock lock {alertMutex_};
+
+   for (const auto& key : keys)
+   {
+      const auto messageList     = textEventManager_->message_list(key);
+      auto&      handledMessages = handledMessagesByKey_[key];
+
+      // Process each message not previously handled in chronological order.
+      // Messages may have been inserted before handled messages, so the
+      // entire list is checked.
+      for (std::size_t i = 0; i < messageList.size(); ++i)
+      {
+         if (handledMessages.insert(messageList[i]).second)
+         {
+            HandleMessage(key,
+                          messageList,
+                          i,
+                          segmentsAdded,
+                          segmentsUpdated,
+                          alertsUpdated);
+         }
+      }
+   }
 
-   // Find message by UUID instead of index, as the message index could have
-   // changed between the signal being emitted and the handler being called
-   auto messageIt = std::find_if(messageList.cbegin(),
-                                 messageList.cend(),
-                                 [&uuid](const auto& message)
-                                 { return uuid == message->uuid(); });
+   // Release the lock after completing segment updates
+   lock.unlock();
 
-   if (messageIt == messageList.cend())
+   // Emit added segments first, so updates to segments added in this batch are
+   // applied
+   if (!segmentsAdded.empty())
    {
-      logger_->warn(
-         "Could not find alert uuid: {} ({})", key.ToString(), messageIndex);
-      return;
+      Q_EMIT SegmentsAdded(segmentsAdded);
+   }
+   if (!segmentsUpdated.empty())
+   {
+      Q_EMIT SegmentsUpdated(segmentsUpdated);
    }
 
-   auto& message       = *messageIt;
-   auto  nextMessageIt = std::next(messageIt);
+   for (auto& alert : alertsUpdated)
+   {
+      // Emit signal for each updated alert type
+      Q_EMIT AlertsUpdated(alert.first, alert.second);
+   }
+}
 
-   // Store the current message index
-   messageIndex =
-      static_cast<std::size_t>(std::distance(messageList.cbegin(), messageIt));
+void AlertLayerHandler::HandleMessage(
+   const types::TextEventKey&                                     key,
+   const std::vector<std::shared_ptr<awips::TextProductMessage>>& messages,
+   std::size_t                                                    messageIndex,
+   std::vector<std::shared_ptr<SegmentRecord>>& segmentsAdded,
+   std::vector<std::shared_ptr<SegmentRecord>>& segmentsUpdated,
+   std::unordered_set<std::pair<awips::Phenomenon, bool>,
+                      AlertTypeHash<std::pair<awips::Phenomenon, bool>>>&
+      alertsUpdated)
+{
+   auto& message = messages[messageIndex];
 
    // Determine start time for first segment
    std::chrono::system_clock::time_point segmentBegin {};
@@ -372,33 +431,29 @@ void AlertLayerHandler::HandleAlert(const types::TextEventKey& key,
 
    // Determine the start time for the first segment of the next message
    std::optional<std::chrono::system_clock::time_point> nextMessageBegin {};
-   if (nextMessageIt != messageList.cend())
+   if (messageIndex + 1 < messages.size())
    {
-      nextMessageBegin =
-         (*nextMessageIt)
-            ->wmo_header()
-            ->GetDateTime((*nextMessageIt)->segment(0)->event_begin());
+      auto& nextMessage = messages[messageIndex + 1];
+      nextMessageBegin  = nextMessage->wmo_header()->GetDateTime(
+         nextMessage->segment(0)->event_begin());
    }
 
-   // Take a unique mutex before modifying segments
-   std::unique_lock lock {alertMutex_};
-
    // Update any existing earlier segments with new end time
    auto& segmentsForKey = segmentsByKey_[key];
    for (auto& segmentRecord : segmentsForKey)
    {
       // Determine if the segment is earlier than the current message
       auto it = std::find(
-         messageList.cbegin(), messageList.cend(), segmentRecord->message_);
+         messages.cbegin(), messages.cend(), segmentRecord->message_);
       auto segmentIndex =
-         static_cast<std::size_t>(std::distance(messageList.cbegin(), it));
+         static_cast<std::size_t>(std::distance(messages.cbegin(), it));
 
       if (segmentIndex < messageIndex &&
           segmentRecord->segmentEnd_ > segmentBegin)
       {
          segmentRecord->segmentEnd_ = segmentBegin;
 
-         Q_EMIT AlertUpdated(segmentRecord);
+         segmentsUpdated.push_back(segmentRecord);
       }
    }
 
@@ -431,20 +486,10 @@ void AlertLayerHandler::HandleAlert(const types::TextEventKey& key,
 
       segmentsForKey.push_back(segmentRecord);
       segmentsForType.push_back(segmentRecord);
-
-      Q_EMIT AlertAdded(segmentRecord, phenomenon);
+      segmentsAdded.push_back(segmentRecord);
 
       alertsUpdated.emplace(phenomenon, alertActive);
    }
-
-   // Release the lock after completing segment updates
-   lock.unlock();
-
-   for (auto& alert : alertsUpdated)
-   {
-      // Emit signal for each updated alert type
-      Q_EMIT AlertsUpdated(alert.first, alert.second);
-   }
 }
 
 void AlertLayerHandler::HandleAlertsRemoved(
@@ -453,7 +498,7 @@ void AlertLayerHandler::HandleAlertsRemoved(
 {
    logger_->trace("HandleAlertsRemoved: {} keys", keys.size());
 
-   std::set<awips::Phenomenon> alertsRemoved {};
+   std::vector<std::shared_ptr<SegmentRecord>> segmentsRemoved {};
 
    // Take a unique lock before modifying segments
    std::unique_lock lock {alertMutex_};
@@ -486,21 +531,23 @@ void AlertLayerHandler::HandleAlertsRemoved(
                }
             }
 
-            alertsRemoved.emplace(key.phenomenon_);
+            segmentsRemoved.push_back(segmentRecord);
          }
 
          // Remove the key from segmentsByKey_
          segmentsByKey_.erase(segmentsIt);
       }
+
+      handledMessagesByKey_.erase(key);
    }
 
    // Release the lock after completing segment updates
    lock.unlock();
 
-   // Emit signal to notify that alerts have been removed
-   for (auto& alert : alertsRemoved)
+   // Emit signal to notify that segments have been removed
+   if (!segmentsRemoved.empty())
    {
-      Q_EMIT AlertsRemoved(alert);
+      Q_EMIT SegmentsRemoved(segmentsRemoved);
    }
 }
 
@@ -510,50 +557,82 @@ void AlertLayer::Impl::ConnectAlertHandlerSignals()
 
    QObject::connect(
       &alertLayerHandler,
-      &AlertLayerHandler::AlertAdded,
+      &AlertLayerHandler::SegmentsAdded,
+      receiver_.get(),
+      [this](const std::vector<
+             std::shared_ptr<AlertLayerHandler::SegmentRecord>>& segments)
+      {
+         // Only process one signal at a time
+         const std::unique_lock lock {receiverMutex_};
+
+         bool added = false;
+
+         for (auto& segmentRecord : segments)
+         {
+            if (segmentRecord->key_.phenomenon_ == phenomenon_)
+            {
+               AddAlert(segmentRecord);
+               added = true;
+            }
+         }
+
+         if (added)
+         {
+            Q_EMIT self_->NeedsRendering();
+         }
+      });
+   QObject::connect(
+      &alertLayerHandler,
+      &AlertLayerHandler::SegmentsUpdated,
       receiver_.get(),
-      [this](
-         const std::shared_ptr<AlertLayerHandler::SegmentRecord>& segmentRecord,
-         awips::Phenomenon                                        phenomenon)
+      [this](const std::vector<
+             std::shared_ptr<AlertLayerHandler::SegmentRecord>>& segments)
       {
-         if (phenomenon == phenomenon_)
+         // Only process one signal at a time
+         const std::unique_lock lock {receiverMutex_};
+
+         bool updated = false;
+
+         for (auto& segmentRecord : segments)
          {
-            // Only process one signal at a time
-            const std::unique_lock lock {receiverMutex_};
+            if (segmentRecord->key_.phenomenon_ == phenomenon_)
+            {
+               UpdateAlert(segmentRecord);
+               updated = true;
+            }
+         }
 
-            AddAlert(segmentRecord);
+         if (updated)
+         {
+            Q_EMIT self_->NeedsRendering();
          }
       });
    QObject::connect(
       &alertLayerHandler,
-      &AlertLayerHandler::AlertUpdated,
+      &AlertLayerHandler::SegmentsRemoved,
       receiver_.get(),
-      [this](
-         const std::shared_ptr<AlertLayerHandler::SegmentRecord>& segmentRecord)
+      [this](const std::vector<
+             std::shared_ptr<AlertLayerHandler::SegmentRecord>>& segments)
       {
-         if (segmentRecord->key_.phenomenon_ == phenomenon_)
+         // Only process one signal at a time
+         const std::unique_lock lock {receiverMutex_};
+
+         bool removed = false;
+
+         for (auto& segmentRecord : segments)
          {
-            // Only process one signal at a time
-            const std::unique_lock lock {receiverMutex_};
+            if (segmentRecord->key_.phenomenon_ == phenomenon_)
+            {
+               RemoveAlert(segmentRecord);
+               removed = true;
+            }
+         }
 
-            UpdateAlert(segmentRecord);
+         if (removed)
+         {
+            Q_EMIT self_->NeedsRendering();
          }
       });
-   QObject::connect(&alertLayerHandler,
-                    &AlertLayerHandler::AlertsRemoved,
-                    receiver_.get(),
-                    [this](awips::Phenomenon phenomenon)
-                    {
-                       if (phenomenon == phenomenon_)
-                       {
-                          // Only process one signal at a time
-                          const std::unique_lock lock {receiverMutex_};
-
-                          // Re-populate the lines if multiple alerts were
-                          // removed
-                          RepopulateLines();
-                       }
-                    });
 }
 
 void AlertLayer::Impl::ConnectSignals()
@@ -685,8 +764,6 @@ void AlertLayer::Impl::AddAlert(
                lineHover,
                drawItems.first->second);
    }
-
-   Q_EMIT self_->NeedsRendering();
 }
 
 void AlertLayer::Impl::UpdateAlert(
@@ -710,8 +787,31 @@ void AlertLayer::Impl::UpdateAlert(
          geoLines->SetLineEndTime(line, segmentRecord->segmentEnd_);
       }
    }
+}
+
+void AlertLayer::Impl::RemoveAlert(
+   const std::shared_ptr<AlertLayerHandler::SegmentRecord>& segmentRecord)
+{
+   // Take a mutex before modifying lines by segment
+   std::unique_lock lock {linesMutex_};
+
+   auto it = linesBySegment_.find(segmentRecord);
+   if (it != linesBySegment_.cend())
+   {
+      auto& segment     = segmentRecord->segment_;
+      bool  alertActive = IsAlertActive(segment);
+
+      auto& geoLines = geoLines_.at(alertActive);
+
+      // Free the line slots, to be reused by the next alert added
+      for (auto& line : it->second)
+      {
+         geoLines->RemoveLine(line);
+         segmentsByLine_.erase(line);
+      }
 
-   Q_EMIT self_->NeedsRendering();
+      linesBySegment_.erase(it);
+   }
 }
 
 void AlertLayer::Impl::AddLines(
@@ -813,25 +913,6 @@ void AlertLayer::Impl::PopulateLines(bool alertActive)
    geoLines->FinishLines();
 }
 
-void AlertLayer::Impl::RepopulateLines()
-{
-   auto& alertLayerHandler = AlertLayerHandler::Instance();
-
-   // Take a shared lock to prevent handling additional alerts while populating
-   // initial lists
-   const std::shared_lock alertLock {alertLayerHandler.alertMutex_};
-
-   linesBySegment_.clear();
-   segmentsByLine_.clear();
-
-   for (auto alertActive : {false, true})
-   {
-      PopulateLines(alertActive);
-   }
-
-   Q_EMIT self_->NeedsRendering();
-}
-
 void AlertLayer::Impl::UpdateLines()
 {
    std::unique_lock lock {linesMutex_};
@@ -917,8 +998,8 @@ void AlertLayer::Impl::HandleGeoLinesHover(
       auto it = segmentsByLine_.find(di);
       if (it != segmentsByLine_.cend())
       {
-         tooltip_ =
-            boost::algorithm::join(it->second->segment_->productContent_, "\n");
+         tooltip_ = fmt::format(
+            "{}", fmt::join(it->second->segment_->productContent_, "\n"));
       }
       else
       {
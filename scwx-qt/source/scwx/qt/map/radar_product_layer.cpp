@@ -4,10 +4,14 @@
 #include <scwx/qt/settings/unit_settings.hpp>
 #include <scwx/qt/types/unit_types.hpp>
 #include <scwx/qt/util/geographic_lib.hpp>
+#include <scwx/qt/util/polar_coordinate_table.hpp>
 #include <scwx/qt/util/tooltip.hpp>
 #include <scwx/qt/view/radar_product_view.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <algorithm>
+#include <list>
+
 #if defined(_MSC_VER)
 #   pragma warning(push, 0)
 #endif
@@ -31,9 +35,35 @@ namespace scwx::qt::map
 static const std::string logPrefix_ = "scwx::qt::map::radar_product_layer";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
+// Memory budget for buffers retained for cached sweeps
+static constexpr GLsizeiptr kMaxCachedSweepsSize_ = 512 * 1024 * 1024;
+
+// Polar mesh resolution, in coordinate table radials and gates. At 1 degree
+// and 2 km, the mesh deviates from the true radial arc by less than 20 meters
+// at the maximum range. Azimuth and range are resolved per fragment, so the
+// mesh does not limit the displayed resolution.
+static constexpr std::size_t kPolarMeshRadialStep_ = 2u;
+static constexpr std::size_t kPolarMeshGateStep_   = 8u;
+
+// Latitude, longitude, azimuth, range
+static constexpr std::size_t kPolarMeshVertexSize_ = 4u;
+
+static constexpr GLint kColorTableTextureUnit_     = 0;
+static constexpr GLint kDataMomentsTextureUnit_    = 1;
+static constexpr GLint kRadialAzimuthsTextureUnit_ = 2;
+
 class RadarProductLayer::Impl
 {
 public:
+   struct SweepBuffers
+   {
+      std::uint64_t         frameId_ {0u};
+      GLuint                vao_ {GL_INVALID_INDEX};
+      std::array<GLuint, 3> vbo_ {GL_INVALID_INDEX};
+      GLsizeiptr            numVertices_ {0};
+      GLsizeiptr            size_ {0};
+   };
+
    explicit Impl() = default;
    ~Impl()         = default;
 
@@ -42,6 +72,17 @@ public:
    Impl(const Impl&&)            = delete;
    Impl& operator=(const Impl&&) = delete;
 
+   void ClearCachedSweeps();
+   void EvictCachedSweeps();
+   void UpdatePolarMesh(
+      const std::shared_ptr<const util::PolarCoordinateTable>& coordinateTable);
+   void UpdatePolarSweep(
+      const std::shared_ptr<view::RadarProductView>& radarProductView,
+      const view::RadarProductView::PolarSweep&      polarSweep);
+
+   static void CreateBuffers(SweepBuffers& buffers);
+   static void DeleteBuffers(SweepBuffers& buffers);
+
    std::shared_ptr<gl::ShaderProgram> shaderProgram_ {nullptr};
 
    GLint uMVPMatrixLocation_ {static_cast<GLint>(GL_INVALID_INDEX)};
@@ -49,11 +90,43 @@ public:
    GLint uDataMomentOffsetLocation_ {static_cast<GLint>(GL_INVALID_INDEX)};
    GLint uDataMomentScaleLocation_ {static_cast<GLint>(GL_INVALID_INDEX)};
    GLint uCFPEnabledLocation_ {static_cast<GLint>(GL_INVALID_INDEX)};
-   std::array<GLuint, 3> vbo_ {GL_INVALID_INDEX};
-   GLuint                vao_ {GL_INVALID_INDEX};
-   GLuint                texture_ {GL_INVALID_INDEX};
+   GLuint texture_ {GL_INVALID_INDEX};
+
+   // Buffers for the current sweep when it is not held in the frame cache
+   SweepBuffers sweepBuffers_ {};
+
+   // Buffers for sweeps held in the frame cache, most recently used first
+   std::list<SweepBuffers> cachedSweeps_ {};
+   GLsizeiptr              cachedSweepsSize_ {0};
+
+   SweepBuffers* activeBuffers_ {&sweepBuffers_};
+
+   // Polar texture rendering resources
+   std::shared_ptr<gl::ShaderProgram> polarShaderProgram_ {nullptr};
+
+   GLint uPolarMVPMatrixLocation_ {static_cast<GLint>(GL_INVALID_INDEX)};
+   GLint uPolarOriginLatLongLocation_ {static_cast<GLint>(GL_INVALID_INDEX)};
+   GLint uPolarDataMomentOffsetLocation_ {
+      static_cast<GLint>(GL_INVALID_INDEX)};
+   GLint uPolarDataMomentScaleLocation_ {static_cast<GLint>(GL_INVALID_INDEX)};
+   GLint uAzimuthOffsetLocation_ {static_cast<GLint>(GL_INVALID_INDEX)};
+   GLint uGateRangeLocation_ {static_cast<GLint>(GL_INVALID_INDEX)};
+   GLint uGateIntervalLocation_ {static_cast<GLint>(GL_INVALID_INDEX)};
+   GLint uSnrThresholdLocation_ {static_cast<GLint>(GL_INVALID_INDEX)};
+
+   GLuint                polarVao_ {GL_INVALID_INDEX};
+   std::array<GLuint, 2> polarVbo_ {GL_INVALID_INDEX};
+   GLuint                dataMomentsTexture_ {GL_INVALID_INDEX};
+   GLuint                radialAzimuthsTexture_ {GL_INVALID_INDEX};
+   GLsizei               polarNumIndices_ {0};
+
+   std::shared_ptr<const util::PolarCoordinateTable> polarMeshTable_ {nullptr};
 
-   GLsizeiptr numVertices_ {0};
+   bool          polarSweepActive_ {false};
+   float         azimuthOffset_ {0.0f};
+   float         gateRange_ {0.0f};
+   float         gateInterval_ {1.0f};
+   std::uint16_t snrThreshold_ {0u};
 
    bool cfpEnabled_ {false};
 
@@ -121,11 +194,59 @@ void RadarProductLayer::Initialize(
 
    p->shaderProgram_->Use();
 
-   // Generate a vertex array object
-   glGenVertexArrays(1, &p->vao_);
+   // Generate vertex array and buffer objects
+   Impl::CreateBuffers(p->sweepBuffers_);
+
+   // Load and configure polar texture shader
+   p->polarShaderProgram_ = glContext->GetShaderProgram(
+      ":/gl/radar_polar.vert", ":/gl/radar_polar.frag");
+
+   const GLuint polarProgramId = p->polarShaderProgram_->id();
+
+   p->uPolarMVPMatrixLocation_ =
+      glGetUniformLocation(polarProgramId, "uMVPMatrix");
+   p->uPolarOriginLatLongLocation_ =
+      glGetUniformLocation(polarProgramId, "uOriginLatLong");
+   p->uPolarDataMomentOffsetLocation_ =
+      glGetUniformLocation(polarProgramId, "uDataMomentOffset");
+   p->uPolarDataMomentScaleLocation_ =
+      glGetUniformLocation(polarProgramId, "uDataMomentScale");
+   p->uAzimuthOffsetLocation_ =
+      glGetUniformLocation(polarProgramId, "uAzimuthOffset");
+   p->uGateRangeLocation_ = glGetUniformLocation(polarProgramId, "uGateRange");
+   p->uGateIntervalLocation_ =
+      glGetUniformLocation(polarProgramId, "uGateInterval");
+   p->uSnrThresholdLocation_ =
+      glGetUniformLocation(polarProgramId, "uSnrThreshold");
+
+   p->polarShaderProgram_->Use();
+
+   glUniform1i(glGetUniformLocation(polarProgramId, "uTexture"),
+               kColorTableTextureUnit_);
+   glUniform1i(glGetUniformLocation(polarProgramId, "uDataMoments"),
+               kDataMomentsTextureUnit_);
+   glUniform1i(glGetUniformLocation(polarProgramId, "uRadialAzimuths"),
+               kRadialAzimuthsTextureUnit_);
+
+   // Generate polar mesh and texture objects
+   glGenVertexArrays(1, &p->polarVao_);
+   glGenBuffers(static_cast<GLsizei>(p->polarVbo_.size()), p->polarVbo_.data());
+   glGenTextures(1, &p->dataMomentsTexture_);
+   glGenTextures(1, &p->radialAzimuthsTexture_);
+
+   // Integer and lookup textures must not be filtered
+   glBindTexture(GL_TEXTURE_2D, p->dataMomentsTexture_);
+   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+   glBindTexture(GL_TEXTURE_1D, p->radialAzimuthsTexture_);
+   glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+   glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+   glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
 
-   // Generate vertex buffer objects
-   glGenBuffers(3, p->vbo_.data());
+   p->shaderProgram_->Use();
 
    // Update radar sweep
    p->sweepNeedsUpdate_ = true;
@@ -192,13 +313,61 @@ void RadarProductLayer::UpdateSweep(
 
    p->sweepNeedsUpdate_ = false;
 
+   const std::optional<view::RadarProductView::PolarSweep> polarSweep =
+      radarProductView->GetPolarSweep();
+   if (polarSweep.has_value())
+   {
+      // The sweep is rendered from a polar texture, and does not use vertex
+      // buffers
+      p->ClearCachedSweeps();
+      p->activeBuffers_ = &p->sweepBuffers_;
+      p->UpdatePolarSweep(radarProductView, *polarSweep);
+      return;
+   }
+
+   p->polarSweepActive_ = false;
+
+   const std::uint64_t frameId = radarProductView->frame_id();
+
+   if (frameId != 0u)
+   {
+      auto it = std::find_if(p->cachedSweeps_.begin(),
+                             p->cachedSweeps_.end(),
+                             [frameId](const Impl::SweepBuffers& buffers)
+                             { return buffers.frameId_ == frameId; });
+
+      if (it != p->cachedSweeps_.end())
+      {
+         // The sweep has already been buffered, so only the active buffers
+         // need to be swapped
+         logger_->debug("Using cached sweep buffers");
+         p->cachedSweeps_.splice(
+            p->cachedSweeps_.begin(), p->cachedSweeps_, it);
+         p->activeBuffers_ = &p->cachedSweeps_.front();
+         return;
+      }
+
+      p->cachedSweeps_.emplace_front();
+      p->cachedSweeps_.front().frameId_ = frameId;
+      Impl::CreateBuffers(p->cachedSweeps_.front());
+      p->activeBuffers_ = &p->cachedSweeps_.front();
+   }
+   else
+   {
+      // The frame cache is not in use
+      p->ClearCachedSweeps();
+      p->activeBuffers_ = &p->sweepBuffers_;
+   }
+
+   Impl::SweepBuffers& buffers = *p->activeBuffers_;
+
    const std::vector<float>& vertices = radarProductView->vertices();
 
    // Bind a vertex array object
-   glBindVertexArray(p->vao_);
+   glBindVertexArray(buffers.vao_);
 
    // Buffer vertices
-   glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[0]);
+   glBindBuffer(GL_ARRAY_BUFFER, buffers.vbo_[0]);
    timer.start();
    glBufferData(GL_ARRAY_BUFFER,
                 static_cast<GLsizeiptr>(vertices.size() * sizeof(GLfloat)),
@@ -227,7 +396,7 @@ void RadarProductLayer::UpdateSweep(
       type = GL_UNSIGNED_SHORT;
    }
 
-   glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[1]);
+   glBindBuffer(GL_ARRAY_BUFFER, buffers.vbo_[1]);
    timer.start();
    glBufferData(GL_ARRAY_BUFFER, dataSize, data, GL_STATIC_DRAW);
    timer.stop();
@@ -256,7 +425,7 @@ void RadarProductLayer::UpdateSweep(
          cfpType = GL_UNSIGNED_SHORT;
       }
 
-      glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[2]);
+      glBindBuffer(GL_ARRAY_BUFFER, buffers.vbo_[2]);
       timer.start();
       glBufferData(GL_ARRAY_BUFFER, cfpDataSize, cfpData, GL_STATIC_DRAW);
       timer.stop();
@@ -270,7 +439,16 @@ void RadarProductLayer::UpdateSweep(
       glDisableVertexAttribArray(2);
    }
 
-   p->numVertices_ = static_cast<GLsizeiptr>(vertices.size() / 2);
+   buffers.numVertices_ = static_cast<GLsizeiptr>(vertices.size() / 2);
+   buffers.size_ =
+      static_cast<GLsizeiptr>(vertices.size() * sizeof(GLfloat)) + dataSize +
+      (cfpData != nullptr ? cfpDataSize : 0);
+
+   if (frameId != 0u)
+   {
+      p->cachedSweepsSize_ += buffers.size_;
+      p->EvictCachedSweeps();
+   }
 
    // NOLINTEND(modernize-use-nullptr)
    // NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
@@ -342,24 +520,62 @@ void RadarProductLayer::Render(
                                glm::radians(static_cast<float>(params.bearing)),
                                glm::vec3(0.0f, 0.0f, 1.0f));
 
-      glUniform2fv(
-         p->uOriginLatLongLocation_,
-         1,
-         glm::value_ptr(glm::vec2 {params.latitude, params.longitude}));
+      if (p->polarSweepActive_)
+      {
+         p->polarShaderProgram_->Use();
+
+         glUniform2fv(
+            p->uPolarOriginLatLongLocation_,
+            1,
+            glm::value_ptr(glm::vec2 {params.latitude, params.longitude}));
+
+         glUniformMatrix4fv(p->uPolarMVPMatrixLocation_,
+                            1,
+                            GL_FALSE,
+                            glm::value_ptr(uMVPMatrix));
+
+         glUniform1ui(p->uPolarDataMomentOffsetLocation_, p->rangeMin_);
+         glUniform1f(p->uPolarDataMomentScaleLocation_, p->scale_);
+
+         glUniform1f(p->uAzimuthOffsetLocation_, p->azimuthOffset_);
+         glUniform1f(p->uGateRangeLocation_, p->gateRange_);
+         glUniform1f(p->uGateIntervalLocation_, p->gateInterval_);
+         glUniform1ui(p->uSnrThresholdLocation_, p->snrThreshold_);
+
+         glActiveTexture(GL_TEXTURE0 + kDataMomentsTextureUnit_);
+         glBindTexture(GL_TEXTURE_2D, p->dataMomentsTexture_);
+         glActiveTexture(GL_TEXTURE0 + kRadialAzimuthsTextureUnit_);
+         glBindTexture(GL_TEXTURE_1D, p->radialAzimuthsTexture_);
+         glActiveTexture(GL_TEXTURE0 + kColorTableTextureUnit_);
+         glBindTexture(GL_TEXTURE_1D, p->texture_);
+         glBindVertexArray(p->polarVao_);
+
+         glDrawElements(
+            GL_TRIANGLES, p->polarNumIndices_, GL_UNSIGNED_INT, nullptr);
+      }
+      else
+      {
+         glUniform2fv(
+            p->uOriginLatLongLocation_,
+            1,
+            glm::value_ptr(glm::vec2 {params.latitude, params.longitude}));
 
-      glUniformMatrix4fv(
-         p->uMVPMatrixLocation_, 1, GL_FALSE, glm::value_ptr(uMVPMatrix));
+         glUniformMatrix4fv(
+            p->uMVPMatrixLocation_, 1, GL_FALSE, glm::value_ptr(uMVPMatrix));
 
-      glUniform1i(p->uCFPEnabledLocation_, p->cfpEnabled_ ? 1 : 0);
+         glUniform1i(p->uCFPEnabledLocation_, p->cfpEnabled_ ? 1 : 0);
 
-      glUniform1ui(p->uDataMomentOffsetLocation_, p->rangeMin_);
-      glUniform1f(p->uDataMomentScaleLocation_, p->scale_);
+         glUniform1ui(p->uDataMomentOffsetLocation_, p->rangeMin_);
+         glUniform1f(p->uDataMomentScaleLocation_, p->scale_);
 
-      glActiveTexture(GL_TEXTURE0);
-      glBindTexture(GL_TEXTURE_1D, p->texture_);
-      glBindVertexArray(p->vao_);
+         glActiveTexture(GL_TEXTURE0);
+         glBindTexture(GL_TEXTURE_1D, p->texture_);
+         glBindVertexArray(p->activeBuffers_->vao_);
 
-      glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(p->numVertices_));
+         glDrawArrays(GL_TRIANGLES,
+                      0,
+                      static_cast<GLsizei>(p->activeBuffers_->numVertices_));
+      }
    }
 
    if (wireframeEnabled)
@@ -385,19 +601,264 @@ void RadarProductLayer::Deinitialize()
 {
    logger_->debug("Deinitialize()");
 
-   glDeleteVertexArrays(1, &p->vao_);
-   glDeleteBuffers(3, p->vbo_.data());
+   p->ClearCachedSweeps();
+   Impl::DeleteBuffers(p->sweepBuffers_);
+   p->activeBuffers_ = &p->sweepBuffers_;
+
+   glDeleteVertexArrays(1, &p->polarVao_);
+   glDeleteBuffers(static_cast<GLsizei>(p->polarVbo_.size()),
+                   p->polarVbo_.data());
+   glDeleteTextures(1, &p->dataMomentsTexture_);
+   glDeleteTextures(1, &p->radialAzimuthsTexture_);
+
+   p->polarVao_              = GL_INVALID_INDEX;
+   p->polarVbo_              = {GL_INVALID_INDEX};
+   p->dataMomentsTexture_    = GL_INVALID_INDEX;
+   p->radialAzimuthsTexture_ = GL_INVALID_INDEX;
+   p->polarNumIndices_       = 0;
+   p->polarMeshTable_        = nullptr;
+   p->polarSweepActive_      = false;
 
    p->uMVPMatrixLocation_        = GL_INVALID_INDEX;
    p->uOriginLatLongLocation_    = GL_INVALID_INDEX;
    p->uDataMomentOffsetLocation_ = GL_INVALID_INDEX;
    p->uDataMomentScaleLocation_  = GL_INVALID_INDEX;
    p->uCFPEnabledLocation_       = GL_INVALID_INDEX;
-   p->vao_                       = GL_INVALID_INDEX;
-   p->vbo_                       = {GL_INVALID_INDEX};
    p->texture_                   = GL_INVALID_INDEX;
 }
 
+void RadarProductLayer::Impl::ClearCachedSweeps()
+{
+   for (auto& buffers : cachedSweeps_)
+   {
+      DeleteBuffers(buffers);
+   }
+
+   cachedSweeps_.clear();
+   cachedSweepsSize_ = 0;
+}
+
+void RadarProductLayer::Impl::EvictCachedSweeps()
+{
+   // Evict least recently used sweeps, always retaining the active sweep
+   while (cachedSweepsSize_ > kMaxCachedSweepsSize_ && cachedSweeps_.size() > 1)
+   {
+      cachedSweepsSize_ -= cachedSweeps_.back().size_;
+      DeleteBuffers(cachedSweeps_.back());
+      cachedSweeps_.pop_back();
+   }
+}
+
+void RadarProductLayer::Impl::UpdatePolarMesh(
+   const std::shared_ptr<const util::PolarCoordinateTable>& coordinateTable)
+{
+   logger_->debug("UpdatePolarMesh()");
+
+   const auto&       parameters  = coordinateTable->parameters();
+   const auto&       coordinates = coordinateTable->coordinates();
+   const std::size_t radialCount = coordinateTable->radial_count();
+   const std::size_t gateCount   = coordinateTable->gate_count();
+
+   // The first mesh column is repeated at the end of the mesh, with the
+   // azimuth continuing past 360 degrees
+   const std::size_t columns = radialCount / kPolarMeshRadialStep_ + 1;
+
+   // Each column starts at the radar site, followed by every mesh step of
+   // gates, ending at the last gate
+   std::vector<std::size_t> ringGates {};
+   for (std::size_t gate = kPolarMeshGateStep_ - 1; gate < gateCount;
+        gate += kPolarMeshGateStep_)
+   {
+      ringGates.push_back(gate);
+   }
+   if (ringGates.empty() || ringGates.back() != gateCount - 1)
+   {
+      ringGates.push_back(gateCount - 1);
+   }
+   const std::size_t rings = ringGates.size() + 1;
+
+   std::vector<float> vertices {};
+   vertices.reserve(columns * rings * kPolarMeshVertexSize_);
+
+   for (std::size_t column = 0; column < columns; ++column)
+   {
+      const std::size_t radialIndex = column * kPolarMeshRadialStep_;
+      const std::size_t radial      = radialIndex % radialCount;
+      const float       azimuth =
+         static_cast<float>(radialIndex) * parameters.radialAngle_ +
+         parameters.angleOffset_;
+
+      vertices.insert(vertices.end(),
+                      {static_cast<float>(parameters.latitude_),
+                       static_cast<float>(parameters.longitude_),
+                       azimuth,
+                       0.0f});
+
+      for (std::size_t gate : ringGates)
+      {
+         const std::size_t offset = (radial * gateCount + gate) * 2;
+         const float       range =
+            (static_cast<float>(gate) + parameters.gateRangeOffset_) *
+            parameters.gateSize_;
+
+         vertices.insert(
+            vertices.end(),
+            {coordinates[offset], coordinates[offset + 1], azimuth, range});
+      }
+   }
+
+   std::vector<GLuint> indices {};
+   indices.reserve((columns - 1) * (rings - 1) * 6);
+
+   for (std::size_t column = 0; column + 1 < columns; ++column)
+   {
+      for (std::size_t ring = 0; ring + 1 < rings; ++ring)
+      {
+         // Draw two triangles per mesh cell
+         //
+         // 2 +---+ 4
+         //   |  /|
+         //   | / |
+         //   |/  |
+         // 1 +---+ 3
+
+         const auto index1 = static_cast<GLuint>(column * rings + ring);
+         const auto index2 = index1 + 1;
+         const auto index3 = static_cast<GLuint>(index1 + rings);
+         const auto index4 = index3 + 1;
+
+         indices.insert(indices.end(),
+                        {index1, index2, index4, index1, index3, index4});
+      }
+   }
+
+   // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+   // NOLINTBEGIN(performance-no-int-to-ptr)
+
+   glBindVertexArray(polarVao_);
+
+   glBindBuffer(GL_ARRAY_BUFFER, polarVbo_[0]);
+   glBufferData(GL_ARRAY_BUFFER,
+                static_cast<GLsizeiptr>(vertices.size() * sizeof(GLfloat)),
+                vertices.data(),
+                GL_STATIC_DRAW);
+
+   constexpr auto kStride =
+      static_cast<GLsizei>(kPolarMeshVertexSize_ * sizeof(GLfloat));
+
+   // aLatLong
+   glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, kStride, nullptr);
+   glEnableVertexAttribArray(0);
+
+   // aAzimuthRange
+   glVertexAttribPointer(1,
+                         2,
+                         GL_FLOAT,
+                         GL_FALSE,
+                         kStride,
+                         reinterpret_cast<void*>(2 * sizeof(GLfloat)));
+   glEnableVertexAttribArray(1);
+
+   glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, polarVbo_[1]);
+   glBufferData(GL_ELEMENT_ARRAY_BUFFER,
+                static_cast<GLsizeiptr>(indices.size() * sizeof(GLuint)),
+                indices.data(),
+                GL_STATIC_DRAW);
+
+   // NOLINTEND(performance-no-int-to-ptr)
+   // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+
+   polarNumIndices_ = static_cast<GLsizei>(indices.size());
+   polarMeshTable_  = coordinateTable;
+}
+
+void RadarProductLayer::Impl::UpdatePolarSweep(
+   const std::shared_ptr<view::RadarProductView>& radarProductView,
+   const view::RadarProductView::PolarSweep&      polarSweep)
+{
+   boost::timer::cpu_timer timer;
+
+   // The polar mesh is shared by all products and sweeps from a radar site
+   auto coordinateTable =
+      radarProductView->radar_product_manager()->coordinate_table(
+         common::RadialSize::_0_5Degree, false);
+
+   if (coordinateTable == nullptr || polarSweep.radials_ == 0 ||
+       polarSweep.gates_ == 0)
+   {
+      polarSweepActive_ = false;
+      return;
+   }
+
+   if (coordinateTable != polarMeshTable_)
+   {
+      UpdatePolarMesh(coordinateTable);
+   }
+
+   // Buffer data moments as a radial by gate texture
+   const bool   wordSize8 = polarSweep.componentSize_ == sizeof(std::uint8_t);
+   const GLenum type      = wordSize8 ? GL_UNSIGNED_BYTE : GL_UNSIGNED_SHORT;
+   const GLint  internalFormat = wordSize8 ? GL_R8UI : GL_R16UI;
+
+   timer.start();
+   glActiveTexture(GL_TEXTURE0 + kDataMomentsTextureUnit_);
+   glBindTexture(GL_TEXTURE_2D, dataMomentsTexture_);
+   glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+   glTexImage2D(GL_TEXTURE_2D,
+                0,
+                internalFormat,
+                static_cast<GLsizei>(polarSweep.gates_),
+                static_cast<GLsizei>(polarSweep.radials_),
+                0,
+                GL_RED_INTEGER,
+                type,
+                polarSweep.moments_);
+   glPixelStorei(GL_UNPACK_ALIGNMENT, 4); // NOLINT(*-magic-numbers)
+
+   // Buffer radial azimuths
+   glActiveTexture(GL_TEXTURE0 + kRadialAzimuthsTextureUnit_);
+   glBindTexture(GL_TEXTURE_1D, radialAzimuthsTexture_);
+   glTexImage1D(GL_TEXTURE_1D,
+                0,
+                GL_R32F,
+                static_cast<GLsizei>(polarSweep.radialAzimuths_.size()),
+                0,
+                GL_RED,
+                GL_FLOAT,
+                polarSweep.radialAzimuths_.data());
+
+   glActiveTexture(GL_TEXTURE0 + kColorTableTextureUnit_);
+   timer.stop();
+   logger_->debug("Polar sweep buffered in {}", timer.format(6, "%ws"));
+
+   azimuthOffset_    = polarSweep.azimuthOffset_;
+   gateRange_        = polarSweep.gateRange_;
+   gateInterval_     = polarSweep.gateInterval_;
+   snrThreshold_     = polarSweep.snrThreshold_;
+   polarSweepActive_ = true;
+}
+
+void RadarProductLayer::Impl::CreateBuffers(SweepBuffers& buffers)
+{
+   // Generate a vertex array object
+   glGenVertexArrays(1, &buffers.vao_);
+
+   // Generate vertex buffer objects
+   glGenBuffers(static_cast<GLsizei>(buffers.vbo_.size()), buffers.vbo_.data());
+}
+
+void RadarProductLayer::Impl::DeleteBuffers(SweepBuffers& buffers)
+{
+   glDeleteVertexArrays(1, &buffers.vao_);
+   glDeleteBuffers(static_cast<GLsizei>(buffers.vbo_.size()),
+                   buffers.vbo_.data());
+
+   buffers.vao_         = GL_INVALID_INDEX;
+   buffers.vbo_         = {GL_INVALID_INDEX};
+   buffers.numVertices_ = 0;
+   buffers.size_        = 0;
+}
+
 bool RadarProductLayer::RunMousePicking(
    const std::shared_ptr<MapContext>& mapContext,
    const QMapLibre::CustomLayerRenderParameters& /* params */,
@@ -10,6 +10,10 @@
 #include <scwx/util/strings.hpp>
 #include <scwx/util/time.hpp>
 
+#include <algorithm>
+#include <limits>
+#include <vector>
+
 #include <QApplication>
 #include <QFontMetrics>
 
@@ -33,6 +37,7 @@ public:
    bool                       GetObserved(const types::TextEventKey& key);
    awips::ibw::ThreatCategory GetThreatCategory(const types::TextEventKey& key);
    bool GetTornadoPossible(const types::TextEventKey& key);
+   bool UpdateAlert(const types::TextEventKey& key);
 
    static std::string GetCounties(const types::TextEventKey& key);
    static std::string GetState(const types::TextEventKey& key);
@@ -322,90 +327,72 @@ AlertModel::headerData(int section, Qt::Orientation orientation, int role) const
    return QVariant();
 }
 
-void AlertModel::HandleAlert(const types::TextEventKey& alertKey,
-                             std::size_t                messageIndex,
-                             boost::uuids::uuid         uuid)
+void AlertModel::HandleAlerts(
+   const std::unordered_set<types::TextEventKey,
+                            types::TextEventHash<types::TextEventKey>>&
+      alertKeys)
 {
-   logger_->trace("Handle alert: {}", alertKey.ToString());
+   logger_->trace("Handle alerts: {} keys", alertKeys.size());
 
-   double distanceInMeters;
-
-   const auto& alertMessages = p->textEventManager_->message_list(alertKey);
-
-   // Find message by UUID instead of index, as the message index could have
-   // changed between the signal being emitted and the handler being called
-   auto messageIt = std::find_if(alertMessages.cbegin(),
-                                 alertMessages.cend(),
-                                 [&uuid](const auto& message)
-                                 { return uuid == message->uuid(); });
+   std::vector<types::TextEventKey> newKeys {};
+   std::unordered_set<types::TextEventKey,
+                      types::TextEventHash<types::TextEventKey>>
+      updatedKeys {};
 
-   if (messageIt == alertMessages.cend())
+   for (const auto& alertKey : alertKeys)
    {
-      logger_->warn("Could not find alert uuid: {} ({})",
-                    alertKey.ToString(),
-                    messageIndex);
-      return;
-   }
-
-   auto& message = *messageIt;
+      // A row exists for each alert with a centroid
+      const bool rowExists = p->centroidMap_.contains(alertKey);
 
-   // Store the current message index
-   messageIndex = static_cast<std::size_t>(
-      std::distance(alertMessages.cbegin(), messageIt));
+      if (!p->UpdateAlert(alertKey))
+      {
+         continue;
+      }
 
-   // Skip alert if this is not the most recent message
-   if (messageIndex + 1 < alertMessages.size())
-   {
-      return;
+      if (rowExists)
+      {
+         updatedKeys.insert(alertKey);
+      }
+      else
+      {
+         newKeys.push_back(alertKey);
+      }
    }
 
-   // Get the most recent segment for the event
-   const std::shared_ptr<const awips::Segment> alertSegment =
-      message->segments().back();
-
-   p->observedMap_.insert_or_assign(alertKey, alertSegment->observed_);
-   p->threatCategoryMap_.insert_or_assign(alertKey,
-                                          alertSegment->threatCategory_);
-   p->tornadoPossibleMap_.insert_or_assign(alertKey,
-                                           alertSegment->tornadoPossible_);
-
-   if (alertSegment->codedLocation_.has_value())
+   // Update the span of existing rows with a single signal
+   if (!updatedKeys.empty())
    {
-      // Update centroid and distance
-      common::Coordinate centroid =
-         common::GetCentroid(alertSegment->codedLocation_->coordinates());
+      int firstRow = std::numeric_limits<int>::max();
+      int lastRow  = -1;
 
-      p->geodesic_.Inverse(p->previousPosition_.latitude_,
-                           p->previousPosition_.longitude_,
-                           centroid.latitude_,
-                           centroid.longitude_,
-                           distanceInMeters);
+      for (int row = 0; row < p->textEventKeys_.size(); ++row)
+      {
+         if (updatedKeys.contains(p->textEventKeys_.at(row)))
+         {
+            firstRow = std::min(firstRow, row);
+            lastRow  = std::max(lastRow, row);
+         }
+      }
 
-      p->centroidMap_.insert_or_assign(alertKey, centroid);
-      p->distanceMap_.insert_or_assign(alertKey, distanceInMeters);
-   }
-   else if (!p->centroidMap_.contains(alertKey))
-   {
-      // The alert has no location, so provide a default
-      p->centroidMap_.insert_or_assign(alertKey, common::Coordinate {0.0, 0.0});
-      p->distanceMap_.insert_or_assign(alertKey, 0.0);
-   }
+      if (lastRow >= 0)
+      {
+         QModelIndex topLeft     = createIndex(firstRow, kFirstColumn);
+         QModelIndex bottomRight = createIndex(lastRow, kLastColumn);
 
-   // Update row
-   if (!p->textEventKeys_.contains(alertKey))
-   {
-      int newIndex = p->textEventKeys_.size();
-      beginInsertRows(QModelIndex(), newIndex, newIndex);
-      p->textEventKeys_.push_back(alertKey);
-      endInsertRows();
+         Q_EMIT dataChanged(topLeft, bottomRight);
+      }
    }
-   else
+
+   // Insert new rows in a single block
+   if (!newKeys.empty())
    {
-      const int   row         = p->textEventKeys_.indexOf(alertKey);
-      QModelIndex topLeft     = createIndex(row, kFirstColumn);
-      QModelIndex bottomRight = createIndex(row, kLastColumn);
+      const auto firstRow = static_cast<int>(p->textEventKeys_.size());
+      const auto lastRow  = firstRow + static_cast<int>(newKeys.size()) - 1;
 
-      Q_EMIT dataChanged(topLeft, bottomRight);
+      beginInsertRows(QModelIndex(), firstRow, lastRow);
+      p->textEventKeys_.append(QList<types::TextEventKey>(newKeys.cbegin(),
+                                                          newKeys.cend()));
+      endInsertRows();
    }
 }
 
@@ -518,6 +505,50 @@ bool AlertModelImpl::GetTornadoPossible(const types::TextEventKey& key)
    return tornadoPossible;
 }
 
+bool AlertModelImpl::UpdateAlert(const types::TextEventKey& key)
+{
+   double distanceInMeters;
+
+   const auto alertMessages = textEventManager_->message_list(key);
+
+   if (alertMessages.empty())
+   {
+      return false;
+   }
+
+   // Get the most recent segment for the event
+   const std::shared_ptr<const awips::Segment> alertSegment =
+      alertMessages.back()->segments().back();
+
+   observedMap_.insert_or_assign(key, alertSegment->observed_);
+   threatCategoryMap_.insert_or_assign(key, alertSegment->threatCategory_);
+   tornadoPossibleMap_.insert_or_assign(key, alertSegment->tornadoPossible_);
+
+   if (alertSegment->codedLocation_.has_value())
+   {
+      // Update centroid and distance
+      common::Coordinate centroid =
+         common::GetCentroid(alertSegment->codedLocation_->coordinates());
+
+      geodesic_.Inverse(previousPosition_.latitude_,
+                        previousPosition_.longitude_,
+                        centroid.latitude_,
+                        centroid.longitude_,
+                        distanceInMeters);
+
+      centroidMap_.insert_or_assign(key, centroid);
+      distanceMap_.insert_or_assign(key, distanceInMeters);
+   }
+   else if (!centroidMap_.contains(key))
+   {
+      // The alert has no location, so provide a default
+      centroidMap_.insert_or_assign(key, common::Coordinate {0.0, 0.0});
+      distanceMap_.insert_or_assign(key, 0.0);
+   }
+
+   return true;
+}
+
 std::string AlertModelImpl::GetCounties(const types::TextEventKey& key)
 {
    auto messageList = manager::TextEventManager::Instance()->message_list(key);
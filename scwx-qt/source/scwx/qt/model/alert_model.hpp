@@ -6,7 +6,6 @@
 #include <memory>
 #include <unordered_set>
 
-#include <boost/uuid/uuid.hpp>
 #include <QAbstractTableModel>
 
 namespace scwx
@@ -52,9 +51,10 @@ public:
                        int             role = Qt::DisplayRole) const override;
 
 public slots:
-   void HandleAlert(const types::TextEventKey& alertKey,
-                    std::size_t                messageIndex,
-                    boost::uuids::uuid         uuid);
+   void HandleAlerts(
+      const std::unordered_set<types::TextEventKey,
+                               types::TextEventHash<types::TextEventKey>>&
+         alertKeys);
    void HandleAlertsRemoved(
       const std::unordered_set<types::TextEventKey,
                                types::TextEventHash<types::TextEventKey>>&
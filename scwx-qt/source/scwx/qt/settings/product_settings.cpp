@@ -15,6 +15,8 @@ public:
    {
       // SetDefault, SetMinimum and SetMaximum are descriptive
       // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers)
+      frameCacheEnabled_.SetDefault(false);
+      polarTextureEnabled_.SetDefault(false);
       showSmoothedRangeFolding_.SetDefault(false);
       stiForecastEnabled_.SetDefault(true);
       stiPastEnabled_.SetDefault(true);
@@ -27,6 +29,8 @@ public:
    Impl(const Impl&&)            = delete;
    Impl& operator=(const Impl&&) = delete;
 
+   SettingsVariable<bool> frameCacheEnabled_ {"frame_cache_enabled"};
+   SettingsVariable<bool> polarTextureEnabled_ {"polar_texture_enabled"};
    SettingsVariable<bool> showSmoothedRangeFolding_ {
       "show_smoothed_range_folding"};
    SettingsVariable<bool> stiForecastEnabled_ {"sti_forecast_enabled"};
@@ -36,7 +40,9 @@ public:
 ProductSettings::ProductSettings() :
     SettingsCategory("product"), p(std::make_unique<Impl>())
 {
-   RegisterVariables({&p->showSmoothedRangeFolding_,
+   RegisterVariables({&p->frameCacheEnabled_,
+                      &p->polarTextureEnabled_,
+                      &p->showSmoothedRangeFolding_,
                       &p->stiForecastEnabled_,
                       &p->stiPastEnabled_});
    SetDefaults();
@@ -47,6 +53,16 @@ ProductSettings::ProductSettings(ProductSettings&&) noexcept = default;
 ProductSettings&
 ProductSettings::operator=(ProductSettings&&) noexcept = default;
 
+SettingsVariable<bool>& ProductSettings::frame_cache_enabled()
+{
+   return p->frameCacheEnabled_;
+}
+
+SettingsVariable<bool>& ProductSettings::polar_texture_enabled()
+{
+   return p->polarTextureEnabled_;
+}
+
 SettingsVariable<bool>& ProductSettings::show_smoothed_range_folding()
 {
    return p->showSmoothedRangeFolding_;
@@ -81,7 +97,9 @@ ProductSettings& ProductSettings::Instance()
 
 bool operator==(const ProductSettings& lhs, const ProductSettings& rhs)
 {
-   return (lhs.p->showSmoothedRangeFolding_ ==
+   return (lhs.p->frameCacheEnabled_ == rhs.p->frameCacheEnabled_ &&
+           lhs.p->polarTextureEnabled_ == rhs.p->polarTextureEnabled_ &&
+           lhs.p->showSmoothedRangeFolding_ ==
               rhs.p->showSmoothedRangeFolding_ &&
            lhs.p->stiForecastEnabled_ == rhs.p->stiForecastEnabled_ &&
            lhs.p->stiPastEnabled_ == rhs.p->stiPastEnabled_);
@@ -20,6 +20,8 @@ public:
    ProductSettings(ProductSettings&&) noexcept;
    ProductSettings& operator=(ProductSettings&&) noexcept;
 
+   SettingsVariable<bool>& frame_cache_enabled();
+   SettingsVariable<bool>& polar_texture_enabled();
    SettingsVariable<bool>& show_smoothed_range_folding();
    SettingsVariable<bool>& sti_forecast_enabled();
    SettingsVariable<bool>& sti_past_enabled();
@@ -103,6 +103,11 @@ std::shared_ptr<wsr88d::NexradFile> RadarProductRecord::nexrad_file() const
    return p->nexradFile_;
 }
 
+std::size_t RadarProductRecord::memory_usage() const
+{
+   return (p->nexradFile_ != nullptr) ? p->nexradFile_->memory_usage() : 0u;
+}
+
 int16_t RadarProductRecord::product_code() const
 {
    return p->productCode_;
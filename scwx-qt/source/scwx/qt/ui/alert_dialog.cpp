@@ -78,11 +78,14 @@ void AlertDialogImpl::ConnectSignals()
 {
    connect(
       textEventManager_.get(),
-      &manager::TextEventManager::AlertUpdated,
+      &manager::TextEventManager::AlertsUpdated,
       this,
-      [this](const types::TextEventKey& key)
+      [this](
+         const std::unordered_set<types::TextEventKey,
+                                  types::TextEventHash<types::TextEventKey>>&
+            keys)
       {
-         if (key == key_)
+         if (keys.contains(key_))
          {
             UpdateAlertInfo();
          }
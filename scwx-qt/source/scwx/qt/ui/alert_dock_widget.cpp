@@ -137,9 +137,9 @@ void AlertDockWidgetImpl::ConnectSignals()
            &model::AlertModel::HandleAlertsRemoved,
            Qt::QueuedConnection);
    connect(textEventManager_.get(),
-           &manager::TextEventManager::AlertUpdated,
+           &manager::TextEventManager::AlertsUpdated,
            alertModel_.get(),
-           &model::AlertModel::HandleAlert,
+           &model::AlertModel::HandleAlerts,
            Qt::QueuedConnection);
    connect(
       self_->ui->alertView->selectionModel(),
@@ -149,6 +149,8 @@ public:
           &antiAliasingEnabled_,
           &autoNavigateToWsr88dOnly_,
           &centerOnRadarSelection_,
+          &frameCacheEnabled_,
+          &polarTextureEnabled_,
           &screenCaptureOnRefresh_,
           &showMapAttribution_,
           &showMapCenter_,
@@ -278,6 +280,8 @@ public:
    settings::SettingsInterface<bool>         antiAliasingEnabled_ {};
    settings::SettingsInterface<bool>         autoNavigateToWsr88dOnly_ {};
    settings::SettingsInterface<bool>         centerOnRadarSelection_ {};
+   settings::SettingsInterface<bool>         frameCacheEnabled_ {};
+   settings::SettingsInterface<bool>         polarTextureEnabled_ {};
    settings::SettingsInterface<bool>         screenCaptureOnRefresh_ {};
    settings::SettingsInterface<bool>         showMapAttribution_ {};
    settings::SettingsInterface<bool>         showMapCenter_ {};
@@ -911,6 +915,14 @@ void SettingsDialogImpl::SetupGeneralTab()
    centerOnRadarSelection_.SetEditWidget(
       self_->ui->centerOnRadarSelectionCheckBox);
 
+   frameCacheEnabled_.SetSettingsVariable(
+      productSettings.frame_cache_enabled());
+   frameCacheEnabled_.SetEditWidget(self_->ui->frameCacheEnabledCheckBox);
+
+   polarTextureEnabled_.SetSettingsVariable(
+      productSettings.polar_texture_enabled());
+   polarTextureEnabled_.SetEditWidget(self_->ui->polarTextureEnabledCheckBox);
+
    screenCaptureOnRefresh_.SetSettingsVariable(
       generalSettings.screen_capture_on_refresh());
    screenCaptureOnRefresh_.SetEditWidget(
@@ -0,0 +1,426 @@
+#include <scwx/qt/util/geographic_area_index.hpp>
+#include <scwx/qt/util/geographic_lib.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <unordered_map>
+
+#include <GeographicLib/Gnomonic.hpp>
+#include <geos/algorithm/PointLocation.h>
+#include <geos/geom/CoordinateSequence.h>
+
+namespace scwx::qt::util
+{
+
+static constexpr double kDegreesPerRevolution_ = 360.0;
+static constexpr double kHalfRevolution_       = 180.0;
+static constexpr double kRadiansPerDegree_ =
+   std::numbers::pi / kHalfRevolution_;
+
+// The bounding box lower bound is computed on a sphere with the minimum radius
+// of curvature of the WGS84 ellipsoid, and reduced by a margin to allow for
+// the remaining difference between the sphere and the ellipsoid
+static const double kMinRadius_ =
+   ::GeographicLib::Constants::WGS84_a() *
+   (1.0 - ::GeographicLib::Constants::WGS84_f()) *
+   (1.0 - ::GeographicLib::Constants::WGS84_f());
+static constexpr double kLowerBoundMargin_ = 0.98;
+
+class GeographicAreaIndex::Impl
+{
+public:
+   struct Area
+   {
+      std::size_t                     id_ {};
+      std::vector<common::Coordinate> coordinates_ {};
+
+      // Bounding box in degrees, including the geodesic edges. Longitudes span
+      // from minLongitude_ eastward by longitudeSpan_, and may cross the
+      // antimeridian.
+      double minLatitude_ {};
+      double maxLatitude_ {};
+      double maxAbsLatitude_ {};
+      double minLongitude_ {};
+      double longitudeSpan_ {};
+      bool   allLongitudes_ {};
+
+      // Ring projected using a gnomonic projection centered on the centroid
+      common::Coordinate             center_ {};
+      geos::geom::CoordinateSequence ring_ {};
+      bool                           projected_ {};
+   };
+
+   explicit Impl() = default;
+   ~Impl()         = default;
+
+   Impl(const Impl&)             = delete;
+   Impl& operator=(const Impl&)  = delete;
+   Impl(const Impl&&)            = delete;
+   Impl& operator=(const Impl&&) = delete;
+
+   static Area CreateArea(std::size_t                            id,
+                          const std::vector<common::Coordinate>& coordinates);
+   static units::length::meters<double>
+               LowerBoundDistance(const Area&               area,
+                                  const common::Coordinate& point);
+   static bool ProjectedContains(const Area&               area,
+                                 const common::Coordinate& point);
+   static bool AreaInRange(const Area&                   area,
+                           const common::Coordinate&     point,
+                           units::length::meters<double> distance);
+
+   std::vector<Area>                            areas_ {};
+   std::unordered_map<std::size_t, std::size_t> indices_ {};
+};
+
+GeographicAreaIndex::GeographicAreaIndex() : p(std::make_unique<Impl>()) {}
+GeographicAreaIndex::~GeographicAreaIndex() = default;
+
+GeographicAreaIndex::GeographicAreaIndex(GeographicAreaIndex&&) noexcept =
+   default;
+GeographicAreaIndex&
+GeographicAreaIndex::operator=(GeographicAreaIndex&&) noexcept = default;
+
+bool GeographicAreaIndex::empty() const
+{
+   return p->areas_.empty();
+}
+
+std::size_t GeographicAreaIndex::size() const
+{
+   return p->areas_.size();
+}
+
+void GeographicAreaIndex::Insert(std::size_t                            id,
+                                 const std::vector<common::Coordinate>& area)
+{
+   auto it = p->indices_.find(id);
+   if (it != p->indices_.cend())
+   {
+      p->areas_[it->second] = Impl::CreateArea(id, area);
+   }
+   else
+   {
+      p->indices_.emplace(id, p->areas_.size());
+      p->areas_.push_back(Impl::CreateArea(id, area));
+   }
+}
+
+void GeographicAreaIndex::Remove(std::size_t id)
+{
+   auto it = p->indices_.find(id);
+   if (it == p->indices_.cend())
+   {
+      return;
+   }
+
+   // Move the last area into the removed slot
+   const std::size_t index = it->second;
+   p->indices_.erase(it);
+
+   if (index != p->areas_.size() - 1)
+   {
+      p->areas_[index]                  = std::move(p->areas_.back());
+      p->indices_[p->areas_[index].id_] = index;
+   }
+
+   p->areas_.pop_back();
+}
+
+void GeographicAreaIndex::Clear()
+{
+   p->areas_.clear();
+   p->indices_.clear();
+}
+
+bool GeographicAreaIndex::InRange(std::size_t                   id,
+                                  const common::Coordinate&     point,
+                                  units::length::meters<double> distance) const
+{
+   auto it = p->indices_.find(id);
+   if (it == p->indices_.cend())
+   {
+      return false;
+   }
+
+   return Impl::AreaInRange(p->areas_[it->second], point, distance);
+}
+
+void GeographicAreaIndex::Query(const common::Coordinate&     point,
+                                units::length::meters<double> distance,
+                                std::vector<std::size_t>&     ids) const
+{
+   ids.clear();
+
+   for (auto& area : p->areas_)
+   {
+      if (Impl::AreaInRange(area, point, distance))
+      {
+         ids.push_back(area.id_);
+      }
+   }
+
+   std::sort(ids.begin(), ids.end());
+}
+
+GeographicAreaIndex::Impl::Area GeographicAreaIndex::Impl::CreateArea(
+   std::size_t id, const std::vector<common::Coordinate>& coordinates)
+{
+   Area area {};
+   area.id_          = id;
+   area.coordinates_ = coordinates;
+
+   if (coordinates.empty())
+   {
+      return area;
+   }
+
+   // Unwrap longitudes relative to the first coordinate, to find the smallest
+   // longitude span when the area crosses the antimeridian
+   const double firstLongitude = coordinates.front().longitude_;
+   double       minLongitude   = firstLongitude;
+   double       maxLongitude   = firstLongitude;
+
+   area.minLatitude_ = coordinates.front().latitude_;
+   area.maxLatitude_ = coordinates.front().latitude_;
+
+   for (auto& coordinate : coordinates)
+   {
+      const double longitude =
+         firstLongitude + std::remainder(coordinate.longitude_ - firstLongitude,
+                                         kDegreesPerRevolution_);
+
+      area.minLatitude_ = std::min(area.minLatitude_, coordinate.latitude_);
+      area.maxLatitude_ = std::max(area.maxLatitude_, coordinate.latitude_);
+      minLongitude      = std::min(minLongitude, longitude);
+      maxLongitude      = std::max(maxLongitude, longitude);
+   }
+
+   // Geodesic edges bulge poleward of their endpoints. If an edge turns from
+   // northward to southward (or southward to northward), it passes through a
+   // geodesic vertex, and the latitude bounds are expanded to include it.
+   const ::GeographicLib::Geodesic& geodesic = GeographicLib::DefaultGeodesic();
+   const double                     flattening =
+      ::GeographicLib::Constants::WGS84_f();
+
+   for (std::size_t i = 0; i < coordinates.size(); ++i)
+   {
+      const common::Coordinate& start = coordinates[i];
+      const common::Coordinate& end =
+         coordinates[(i + 1) % coordinates.size()];
+
+      double startAzimuth;
+      double endAzimuth;
+
+      geodesic.Inverse(start.latitude_,
+                       start.longitude_,
+                       end.latitude_,
+                       end.longitude_,
+                       startAzimuth,
+                       endAzimuth);
+
+      const double startCosAzimuth =
+         std::cos(startAzimuth * kRadiansPerDegree_);
+      const double endCosAzimuth = std::cos(endAzimuth * kRadiansPerDegree_);
+
+      if (!(startCosAzimuth > 0.0 && endCosAzimuth < 0.0) &&
+          !(startCosAzimuth < 0.0 && endCosAzimuth > 0.0))
+      {
+         continue;
+      }
+
+      // By Clairaut's relation, the reduced latitude of the vertex is the
+      // complement of the azimuth at the equator
+      const double reducedLatitude = std::atan(
+         (1.0 - flattening) * std::tan(start.latitude_ * kRadiansPerDegree_));
+      const double sinEquatorialAzimuth =
+         std::sin(startAzimuth * kRadiansPerDegree_) *
+         std::cos(reducedLatitude);
+      const double vertexReducedLatitude =
+         std::acos(std::min(1.0, std::abs(sinEquatorialAzimuth)));
+      const double vertexLatitude =
+         std::atan(std::tan(vertexReducedLatitude) / (1.0 - flattening)) /
+         kRadiansPerDegree_;
+
+      if (startCosAzimuth > 0.0)
+      {
+         area.maxLatitude_ = std::max(area.maxLatitude_, vertexLatitude);
+      }
+      else
+      {
+         area.minLatitude_ = std::min(area.minLatitude_, -vertexLatitude);
+      }
+   }
+
+   area.maxAbsLatitude_ =
+      std::max(std::abs(area.minLatitude_), std::abs(area.maxLatitude_));
+   area.minLongitude_  = minLongitude;
+   area.longitudeSpan_ = maxLongitude - minLongitude;
+   area.allLongitudes_ = area.longitudeSpan_ >= kHalfRevolution_;
+
+   // Cannot have an area with just two points
+   if (coordinates.size() <= 2 ||
+       (coordinates.size() == 3 && coordinates.front() == coordinates.back()))
+   {
+      return area;
+   }
+
+   // Project the ring about its centroid. If the ring cannot be projected,
+   // points are only tested using the unprojected area.
+   const ::GeographicLib::Gnomonic gnomonic {GeographicLib::DefaultGeodesic()};
+   geos::geom::CoordinateSequence  ring {};
+
+   area.center_ = common::GetCentroid(coordinates);
+
+   for (auto& coordinate : coordinates)
+   {
+      double x;
+      double y;
+
+      gnomonic.Forward(area.center_.latitude_,
+                       area.center_.longitude_,
+                       coordinate.latitude_,
+                       coordinate.longitude_,
+                       x,
+                       y);
+
+      if (std::isnan(x) || std::isnan(y))
+      {
+         return area;
+      }
+
+      ring.add(x, y);
+   }
+
+   // Close the ring
+   if (!ring.isRing())
+   {
+      ring.add(ring.front(), false);
+   }
+
+   if (!ring.isRing())
+   {
+      return area;
+   }
+
+   try
+   {
+      // Validate the ring once, rather than on each query
+      geos::algorithm::PointLocation::isInRing(geos::geom::CoordinateXY {},
+                                               &ring);
+   }
+   catch (const std::exception&)
+   {
+      return area;
+   }
+
+   area.ring_      = std::move(ring);
+   area.projected_ = true;
+
+   return area;
+}
+
+units::length::meters<double> GeographicAreaIndex::Impl::LowerBoundDistance(
+   const Area& area, const common::Coordinate& point)
+{
+   // Latitude difference from the bounding box
+   double deltaLatitude = 0.0;
+   if (point.latitude_ < area.minLatitude_)
+   {
+      deltaLatitude = area.minLatitude_ - point.latitude_;
+   }
+   else if (point.latitude_ > area.maxLatitude_)
+   {
+      deltaLatitude = point.latitude_ - area.maxLatitude_;
+   }
+
+   // Longitude difference from the bounding box, in either direction
+   double deltaLongitude = 0.0;
+   if (!area.allLongitudes_)
+   {
+      double offset = std::fmod(point.longitude_ - area.minLongitude_,
+                                kDegreesPerRevolution_);
+      if (offset < 0.0)
+      {
+         offset += kDegreesPerRevolution_;
+      }
+
+      if (offset > area.longitudeSpan_)
+      {
+         deltaLongitude = std::min(offset - area.longitudeSpan_,
+                                   kDegreesPerRevolution_ - offset);
+      }
+   }
+
+   // Haversine formula, using the latitude nearest a pole to minimize the
+   // contribution of the longitude difference
+   const double maxAbsLatitude =
+      std::max(std::abs(point.latitude_), area.maxAbsLatitude_);
+   const double cosLatitude = std::cos(maxAbsLatitude * kRadiansPerDegree_);
+   const double sinHalfLatitude =
+      std::sin(deltaLatitude / 2.0 * kRadiansPerDegree_);
+   const double sinHalfLongitude =
+      std::sin(deltaLongitude / 2.0 * kRadiansPerDegree_);
+
+   const double haversine =
+      std::min(1.0,
+               sinHalfLatitude * sinHalfLatitude + cosLatitude * cosLatitude *
+                                                      sinHalfLongitude *
+                                                      sinHalfLongitude);
+   const double centralAngle = 2.0 * std::asin(std::sqrt(haversine));
+
+   return units::length::meters<double>(centralAngle * kMinRadius_ *
+                                        kLowerBoundMargin_);
+}
+
+bool GeographicAreaIndex::Impl::ProjectedContains(
+   const Area& area, const common::Coordinate& point)
+{
+   const ::GeographicLib::Gnomonic gnomonic {GeographicLib::DefaultGeodesic()};
+
+   double x;
+   double y;
+
+   gnomonic.Forward(area.center_.latitude_,
+                    area.center_.longitude_,
+                    point.latitude_,
+                    point.longitude_,
+                    x,
+                    y);
+
+   if (std::isnan(x) || std::isnan(y))
+   {
+      // The point is not on the hemisphere centered on the area
+      return false;
+   }
+
+   return geos::algorithm::PointLocation::isInRing(
+      geos::geom::CoordinateXY {x, y}, &area.ring_);
+}
+
+bool GeographicAreaIndex::Impl::AreaInRange(
+   const Area&                   area,
+   const common::Coordinate&     point,
+   units::length::meters<double> distance)
+{
+   if (area.coordinates_.empty() || LowerBoundDistance(area, point) > distance)
+   {
+      return false;
+   }
+
+   if (area.projected_)
+   {
+      // Points inside the area are always in range. If the distance is 0, no
+      // other points are in range.
+      const bool contains = ProjectedContains(area, point);
+      if (contains || distance.value() <= 0.0)
+      {
+         return contains;
+      }
+   }
+
+   return GeographicLib::AreaInRangeOfPoint(area.coordinates_, point, distance);
+}
+
+} // namespace scwx::qt::util
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <scwx/common/geographic.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <units/length.h>
+
+namespace scwx::qt::util
+{
+
+/**
+ * Index of geographic areas, used to find the areas within a distance of a
+ * point without a full distance computation against every area. Areas are
+ * identified by a caller provided ID.
+ *
+ * Each area caches its bounding box, used to reject distant areas using a
+ * lower bound of the distance to the point, and its ring projected about its
+ * centroid, used to accept points inside the area. Remaining areas are tested
+ * using GeographicLib::AreaInRangeOfPoint.
+ */
+class GeographicAreaIndex
+{
+public:
+   explicit GeographicAreaIndex();
+   ~GeographicAreaIndex();
+
+   GeographicAreaIndex(const GeographicAreaIndex&)            = delete;
+   GeographicAreaIndex& operator=(const GeographicAreaIndex&) = delete;
+
+   GeographicAreaIndex(GeographicAreaIndex&&) noexcept;
+   GeographicAreaIndex& operator=(GeographicAreaIndex&&) noexcept;
+
+   [[nodiscard]] bool        empty() const;
+   [[nodiscard]] std::size_t size() const;
+
+   /**
+    * Add an area to the index, replacing any area with the same ID.
+    *
+    * @param [in] id Area ID
+    * @param [in] area A vector of Coordinates representing the area
+    */
+   void Insert(std::size_t id, const std::vector<common::Coordinate>& area);
+
+   /**
+    * Remove an area from the index.
+    *
+    * @param [in] id Area ID
+    */
+   void Remove(std::size_t id);
+
+   /**
+    * Remove all areas from the index.
+    */
+   void Clear();
+
+   /**
+    * Determine if an area is within a distance of a point. Equivalent to
+    * GeographicLib::AreaInRangeOfPoint.
+    *
+    * @param [in] id Area ID
+    * @param [in] point The point to check against the area
+    * @param [in] distance The max distance in meters
+    *
+    * @return true if the area is in the index, and inside the radius of the
+    * point
+    */
+   [[nodiscard]] bool InRange(std::size_t                   id,
+                              const common::Coordinate&     point,
+                              units::length::meters<double> distance) const;
+
+   /**
+    * Find the areas within a distance of a point.
+    *
+    * @param [in] point The point to check against each area
+    * @param [in] distance The max distance in meters
+    * @param [out] ids Area IDs inside the radius of the point, in ascending
+    * order
+    */
+   void Query(const common::Coordinate&     point,
+              units::length::meters<double> distance,
+              std::vector<std::size_t>&     ids) const;
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace scwx::qt::util
@@ -0,0 +1,86 @@
+#include <scwx/qt/util/loop_prefetch.hpp>
+#include <scwx/util/map.hpp>
+
+#include <atomic>
+#include <mutex>
+
+namespace scwx::qt::util
+{
+
+class LoopPrefetch::Impl
+{
+public:
+   explicit Impl() = default;
+
+   std::mutex mutex_ {};
+   bool       active_ {false};
+   bool       reverse_ {false};
+
+   // Volume scans in the loop being prefetched
+   std::vector<std::chrono::system_clock::time_point> volumeTimes_ {};
+
+   std::atomic<std::size_t> generation_ {0u};
+};
+
+LoopPrefetch::LoopPrefetch() : p {std::make_unique<Impl>()} {}
+LoopPrefetch::~LoopPrefetch() = default;
+
+std::optional<std::size_t> LoopPrefetch::Start(
+   const Loop&                                            loop,
+   const std::set<std::chrono::system_clock::time_point>& volumeTimes,
+   bool                                                   timeSelected)
+{
+   // Find the volume scans in the loop, including the volume scan in effect at
+   // the start of the loop
+   std::vector<std::chrono::system_clock::time_point> loopVolumeTimes {};
+   for (auto it = scwx::util::GetBoundedElementIterator(volumeTimes,
+                                                        loop.startTime_);
+        it != volumeTimes.cend() && *it <= loop.endTime_;
+        ++it)
+   {
+      loopVolumeTimes.push_back(*it);
+   }
+
+   const std::unique_lock lock {p->mutex_};
+
+   if (!timeSelected && p->active_ && p->reverse_ == loop.reverse_ &&
+       p->volumeTimes_ == loopVolumeTimes)
+   {
+      return std::nullopt;
+   }
+
+   p->active_      = true;
+   p->reverse_     = loop.reverse_;
+   p->volumeTimes_ = std::move(loopVolumeTimes);
+
+   return ++p->generation_;
+}
+
+void LoopPrefetch::Cancel()
+{
+   const std::unique_lock lock {p->mutex_};
+
+   p->active_ = false;
+   p->volumeTimes_.clear();
+   ++p->generation_;
+}
+
+bool LoopPrefetch::IsCancelled(std::size_t generation) const
+{
+   return generation != p->generation_;
+}
+
+std::chrono::system_clock::duration
+LoopPrefetch::PlayOffset(const Loop&                           loop,
+                         std::chrono::system_clock::time_point currentTime,
+                         std::chrono::system_clock::time_point time)
+{
+   auto offset = loop.reverse_ ? currentTime - time : time - currentTime;
+   if (offset < std::chrono::system_clock::duration::zero())
+   {
+      offset += loop.endTime_ - loop.startTime_;
+   }
+   return offset;
+}
+
+} // namespace scwx::qt::util
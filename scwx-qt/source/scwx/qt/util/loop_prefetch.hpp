@@ -0,0 +1,115 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <set>
+#include <vector>
+
+namespace scwx::qt::util
+{
+
+class LoopPrefetch
+{
+public:
+   /**
+    * Tracks the prefetch of the products in an animation loop. Each prefetch
+    * is identified by a generation, and starting or cancelling a prefetch
+    * cancels the prefetch in progress. A prefetch is only restarted when the
+    * volume scans in the loop or the loop direction change, or when a time is
+    * selected other than by playing the loop.
+    */
+
+   struct Loop
+   {
+      std::chrono::system_clock::time_point startTime_ {};
+      std::chrono::system_clock::time_point endTime_ {};
+      bool                                  reverse_ {};
+   };
+
+   explicit LoopPrefetch();
+   ~LoopPrefetch();
+
+   LoopPrefetch(const LoopPrefetch&)            = delete;
+   LoopPrefetch(LoopPrefetch&&)                 = delete;
+   LoopPrefetch& operator=(const LoopPrefetch&) = delete;
+   LoopPrefetch& operator=(LoopPrefetch&&)      = delete;
+
+   /**
+    * Starts a prefetch of a loop, cancelling the prefetch in progress. If the
+    * volume scans in the loop and the loop direction are unchanged, and a time
+    * has not been selected, the previous prefetch is retained. In live mode,
+    * the loop window advances each minute without new volume scans.
+    *
+    * @param [in] loop Loop to prefetch
+    * @param [in] volumeTimes Available volume scan times
+    * @param [in] timeSelected Whether the time was selected, rather than
+    * advanced by playing the loop
+    *
+    * @return Generation of the prefetch if one was started, or std::nullopt
+    * if the previous prefetch was retained
+    */
+   std::optional<std::size_t>
+   Start(const Loop&                                            loop,
+         const std::set<std::chrono::system_clock::time_point>& volumeTimes,
+         bool                                                   timeSelected);
+
+   /**
+    * Cancels the prefetch in progress. The next prefetch is always started.
+    */
+   void Cancel();
+
+   /**
+    * Determines if a prefetch has been replaced or cancelled.
+    *
+    * @param [in] generation Prefetch generation
+    *
+    * @return true if the prefetch is no longer current
+    */
+   [[nodiscard]] bool IsCancelled(std::size_t generation) const;
+
+   /**
+    * Gets the time until a product is played, wrapping at the end of the loop.
+    *
+    * @param [in] loop Loop being played
+    * @param [in] currentTime Current time in the loop
+    * @param [in] time Product time
+    *
+    * @return Time until the product is played
+    */
+   static std::chrono::system_clock::duration
+   PlayOffset(const Loop&                           loop,
+              std::chrono::system_clock::time_point currentTime,
+              std::chrono::system_clock::time_point time);
+
+   /**
+    * Orders items by the time until they are played, wrapping at the end of
+    * the loop. Items played at the same time retain their order.
+    *
+    * @param [in,out] items Items to order
+    * @param [in] loop Loop being played
+    * @param [in] currentTime Current time in the loop
+    * @param [in] time Projection of an item to its product time
+    */
+   template<typename T, typename Projection>
+   static void
+   SortByPlayOrder(std::vector<T>&                       items,
+                   const Loop&                           loop,
+                   std::chrono::system_clock::time_point currentTime,
+                   Projection                            time)
+   {
+      std::ranges::stable_sort(
+         items,
+         {},
+         [&](const T& item)
+         { return PlayOffset(loop, currentTime, std::invoke(time, item)); });
+   }
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace scwx::qt::util
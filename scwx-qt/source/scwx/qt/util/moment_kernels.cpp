@@ -0,0 +1,665 @@
+#include <scwx/qt/util/moment_kernels.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <array>
+#include <limits>
+#include <string>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) ||            \
+   defined(_M_IX86)
+#   define SCWX_MOMENT_KERNELS_X86
+#   include <immintrin.h>
+#   if defined(_MSC_VER)
+#      include <intrin.h>
+#   endif
+#endif
+
+#if defined(SCWX_MOMENT_KERNELS_X86) && !defined(_MSC_VER)
+#   define SCWX_TARGET_SSE4_1 __attribute__((target("sse4.1")))
+#   define SCWX_TARGET_AVX2   __attribute__((target("avx2")))
+#else
+#   define SCWX_TARGET_SSE4_1
+#   define SCWX_TARGET_AVX2
+#endif
+
+namespace scwx::qt::util::MomentKernels
+{
+
+static const std::string logPrefix_ = "scwx::qt::util::moment_kernels";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+static constexpr std::uint16_t kRangeFolded_ = 1u;
+
+// Vectorized loops operate on blocks of this many bytes. The remaining values
+// are processed by the scalar kernel.
+static constexpr std::size_t kSse4_1BlockSize_ = 16u;
+static constexpr std::size_t kAvx2BlockSize_   = 32u;
+
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+// NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+
+static InstructionSet DetectInstructionSet()
+{
+   InstructionSet instructionSet = InstructionSet::Scalar;
+
+#if defined(SCWX_MOMENT_KERNELS_X86)
+#   if defined(_MSC_VER)
+   // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers)
+   std::array<int, 4> cpuInfo {};
+
+   __cpuid(cpuInfo.data(), 0);
+   const int maxLeaf = cpuInfo[0];
+
+   __cpuid(cpuInfo.data(), 1);
+   const bool sse4_1  = (cpuInfo[2] & (1 << 19)) != 0;
+   const bool osxsave = (cpuInfo[2] & (1 << 27)) != 0;
+   const bool avx     = (cpuInfo[2] & (1 << 28)) != 0;
+
+   bool avx2 = false;
+   if (maxLeaf >= 7 && osxsave && avx)
+   {
+      // Verify the operating system saves the AVX register state
+      const unsigned long long xcr0 = _xgetbv(0);
+      if ((xcr0 & 0x6) == 0x6)
+      {
+         __cpuidex(cpuInfo.data(), 7, 0);
+         avx2 = (cpuInfo[1] & (1 << 5)) != 0;
+      }
+   }
+   // NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
+#   else
+   __builtin_cpu_init();
+   const bool sse4_1 = __builtin_cpu_supports("sse4.1");
+   const bool avx2   = __builtin_cpu_supports("avx2");
+#   endif
+
+   if (avx2)
+   {
+      instructionSet = InstructionSet::Avx2;
+   }
+   else if (sse4_1)
+   {
+      instructionSet = InstructionSet::Sse4_1;
+   }
+#endif
+
+   return instructionSet;
+}
+
+InstructionSet SupportedInstructionSet()
+{
+   static const InstructionSet instructionSet_ = []()
+   {
+      const InstructionSet instructionSet = DetectInstructionSet();
+      logger_->debug("Using {} data moment kernels",
+                     (instructionSet == InstructionSet::Avx2)   ? "AVX2" :
+                     (instructionSet == InstructionSet::Sse4_1) ? "SSE4.1" :
+                                                                  "scalar");
+      return instructionSet;
+   }();
+
+   return instructionSet_;
+}
+
+static InstructionSet SelectInstructionSet(InstructionSet instructionSet)
+{
+   const InstructionSet supportedInstructionSet = SupportedInstructionSet();
+
+   // Never use an instruction set the processor does not support
+   if (instructionSet == InstructionSet::Auto ||
+       static_cast<int>(instructionSet) >
+          static_cast<int>(supportedInstructionSet))
+   {
+      instructionSet = supportedInstructionSet;
+   }
+
+   return instructionSet;
+}
+
+template<typename T>
+static void ThresholdMaskScalar(const T*      moments,
+                                std::size_t   count,
+                                std::uint16_t threshold,
+                                bool          includeRangeFolded,
+                                std::uint8_t* mask)
+{
+   for (std::size_t i = 0; i < count; ++i)
+   {
+      const T value = moments[i];
+      mask[i] =
+         (value == kRangeFolded_) ? includeRangeFolded : (value >= threshold);
+   }
+}
+
+static void QuadMaskScalar(const std::uint8_t* mask0,
+                           const std::uint8_t* mask1,
+                           std::size_t         count,
+                           std::uint8_t*       quadMask)
+{
+   for (std::size_t i = 0; i < count; ++i)
+   {
+      quadMask[i] = mask0[i] | mask0[i + 1] | mask1[i] | mask1[i + 1];
+   }
+}
+
+template<typename T>
+static void RemapScalar(const T*    moments,
+                        std::size_t count,
+                        T           edgeValue,
+                        bool        showRangeFolding,
+                        T*          output)
+{
+   for (std::size_t i = 0; i < count; ++i)
+   {
+      const T value = moments[i];
+      output[i] =
+         (value != 0 && (value != kRangeFolded_ || showRangeFolding)) ?
+            value :
+            edgeValue;
+   }
+}
+
+#if defined(SCWX_MOMENT_KERNELS_X86)
+
+SCWX_TARGET_SSE4_1 static inline __m128i
+Visible16Sse4_1(const __m128i& v,
+                const __m128i& threshold,
+                const __m128i& rangeFolded,
+                const __m128i& include)
+{
+   const __m128i ge = _mm_cmpeq_epi16(_mm_max_epu16(v, threshold), v);
+   const __m128i rf = _mm_cmpeq_epi16(v, rangeFolded);
+   return _mm_or_si128(_mm_andnot_si128(rf, ge), _mm_and_si128(rf, include));
+}
+
+SCWX_TARGET_AVX2 static inline __m256i Visible16Avx2(const __m256i& v,
+                                                     const __m256i& threshold,
+                                                     const __m256i& rangeFolded,
+                                                     const __m256i& include)
+{
+   const __m256i ge = _mm256_cmpeq_epi16(_mm256_max_epu16(v, threshold), v);
+   const __m256i rf = _mm256_cmpeq_epi16(v, rangeFolded);
+   return _mm256_or_si256(_mm256_andnot_si256(rf, ge),
+                          _mm256_and_si256(rf, include));
+}
+
+SCWX_TARGET_SSE4_1 static std::size_t
+ThresholdMaskSse4_1(const std::uint8_t* moments,
+                    std::size_t         count,
+                    std::uint8_t        threshold,
+                    bool                includeRangeFolded,
+                    std::uint8_t*       mask)
+{
+   const __m128i vThreshold   = _mm_set1_epi8(static_cast<char>(threshold));
+   const __m128i vRangeFolded = _mm_set1_epi8(kRangeFolded_);
+   const __m128i vInclude =
+      _mm_set1_epi8(static_cast<char>(includeRangeFolded ? 0xff : 0x00));
+   const __m128i vOne = _mm_set1_epi8(1);
+
+   std::size_t i = 0;
+   for (; i + kSse4_1BlockSize_ <= count; i += kSse4_1BlockSize_)
+   {
+      const __m128i v =
+         _mm_loadu_si128(reinterpret_cast<const __m128i*>(moments + i));
+
+      const __m128i ge = _mm_cmpeq_epi8(_mm_max_epu8(v, vThreshold), v);
+      const __m128i rf = _mm_cmpeq_epi8(v, vRangeFolded);
+      const __m128i visible =
+         _mm_or_si128(_mm_andnot_si128(rf, ge), _mm_and_si128(rf, vInclude));
+
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(mask + i),
+                       _mm_and_si128(visible, vOne));
+   }
+
+   return i;
+}
+
+SCWX_TARGET_SSE4_1 static std::size_t
+ThresholdMaskSse4_1(const std::uint16_t* moments,
+                    std::size_t          count,
+                    std::uint16_t        threshold,
+                    bool                 includeRangeFolded,
+                    std::uint8_t*        mask)
+{
+   constexpr std::size_t kValuesPerBlock = kSse4_1BlockSize_ / 2;
+
+   const __m128i vThreshold   = _mm_set1_epi16(static_cast<short>(threshold));
+   const __m128i vRangeFolded = _mm_set1_epi16(kRangeFolded_);
+   const __m128i vInclude =
+      _mm_set1_epi16(static_cast<short>(includeRangeFolded ? 0xffff : 0x0000));
+   const __m128i vOne = _mm_set1_epi8(1);
+
+   std::size_t i = 0;
+   for (; i + kValuesPerBlock * 2 <= count; i += kValuesPerBlock * 2)
+   {
+      const __m128i v0 =
+         _mm_loadu_si128(reinterpret_cast<const __m128i*>(moments + i));
+      const __m128i v1 = _mm_loadu_si128(
+         reinterpret_cast<const __m128i*>(moments + i + kValuesPerBlock));
+
+      // Narrow the 16-bit masks to 8-bit masks
+      const __m128i packed = _mm_packs_epi16(
+         Visible16Sse4_1(v0, vThreshold, vRangeFolded, vInclude),
+         Visible16Sse4_1(v1, vThreshold, vRangeFolded, vInclude));
+
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(mask + i),
+                       _mm_and_si128(packed, vOne));
+   }
+
+   return i;
+}
+
+SCWX_TARGET_SSE4_1 static std::size_t
+QuadMaskSse4_1(const std::uint8_t* mask0,
+               const std::uint8_t* mask1,
+               std::size_t         count,
+               std::uint8_t*       quadMask)
+{
+   std::size_t i = 0;
+   for (; i + kSse4_1BlockSize_ <= count; i += kSse4_1BlockSize_)
+   {
+      const __m128i m0 =
+         _mm_loadu_si128(reinterpret_cast<const __m128i*>(mask0 + i));
+      const __m128i m0Next =
+         _mm_loadu_si128(reinterpret_cast<const __m128i*>(mask0 + i + 1));
+      const __m128i m1 =
+         _mm_loadu_si128(reinterpret_cast<const __m128i*>(mask1 + i));
+      const __m128i m1Next =
+         _mm_loadu_si128(reinterpret_cast<const __m128i*>(mask1 + i + 1));
+
+      _mm_storeu_si128(
+         reinterpret_cast<__m128i*>(quadMask + i),
+         _mm_or_si128(_mm_or_si128(m0, m0Next), _mm_or_si128(m1, m1Next)));
+   }
+
+   return i;
+}
+
+SCWX_TARGET_SSE4_1 static std::size_t
+RemapSse4_1(const std::uint8_t* moments,
+            std::size_t         count,
+            std::uint8_t        edgeValue,
+            bool                showRangeFolding,
+            std::uint8_t*       output)
+{
+   const __m128i vEdge        = _mm_set1_epi8(static_cast<char>(edgeValue));
+   const __m128i vZero        = _mm_setzero_si128();
+   const __m128i vRangeFolded = _mm_set1_epi8(kRangeFolded_);
+
+   std::size_t i = 0;
+   for (; i + kSse4_1BlockSize_ <= count; i += kSse4_1BlockSize_)
+   {
+      const __m128i v =
+         _mm_loadu_si128(reinterpret_cast<const __m128i*>(moments + i));
+
+      __m128i edge = _mm_cmpeq_epi8(v, vZero);
+      if (!showRangeFolding)
+      {
+         edge = _mm_or_si128(edge, _mm_cmpeq_epi8(v, vRangeFolded));
+      }
+
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i),
+                       _mm_blendv_epi8(v, vEdge, edge));
+   }
+
+   return i;
+}
+
+SCWX_TARGET_SSE4_1 static std::size_t
+RemapSse4_1(const std::uint16_t* moments,
+            std::size_t          count,
+            std::uint16_t        edgeValue,
+            bool                 showRangeFolding,
+            std::uint16_t*       output)
+{
+   constexpr std::size_t kValuesPerBlock = kSse4_1BlockSize_ / 2;
+
+   const __m128i vEdge        = _mm_set1_epi16(static_cast<short>(edgeValue));
+   const __m128i vZero        = _mm_setzero_si128();
+   const __m128i vRangeFolded = _mm_set1_epi16(kRangeFolded_);
+
+   std::size_t i = 0;
+   for (; i + kValuesPerBlock <= count; i += kValuesPerBlock)
+   {
+      const __m128i v =
+         _mm_loadu_si128(reinterpret_cast<const __m128i*>(moments + i));
+
+      __m128i edge = _mm_cmpeq_epi16(v, vZero);
+      if (!showRangeFolding)
+      {
+         edge = _mm_or_si128(edge, _mm_cmpeq_epi16(v, vRangeFolded));
+      }
+
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i),
+                       _mm_blendv_epi8(v, vEdge, edge));
+   }
+
+   return i;
+}
+
+SCWX_TARGET_AVX2 static std::size_t
+ThresholdMaskAvx2(const std::uint8_t* moments,
+                  std::size_t         count,
+                  std::uint8_t        threshold,
+                  bool                includeRangeFolded,
+                  std::uint8_t*       mask)
+{
+   const __m256i vThreshold   = _mm256_set1_epi8(static_cast<char>(threshold));
+   const __m256i vRangeFolded = _mm256_set1_epi8(kRangeFolded_);
+   const __m256i vInclude =
+      _mm256_set1_epi8(static_cast<char>(includeRangeFolded ? 0xff : 0x00));
+   const __m256i vOne = _mm256_set1_epi8(1);
+
+   std::size_t i = 0;
+   for (; i + kAvx2BlockSize_ <= count; i += kAvx2BlockSize_)
+   {
+      const __m256i v =
+         _mm256_loadu_si256(reinterpret_cast<const __m256i*>(moments + i));
+
+      const __m256i ge = _mm256_cmpeq_epi8(_mm256_max_epu8(v, vThreshold), v);
+      const __m256i rf = _mm256_cmpeq_epi8(v, vRangeFolded);
+      const __m256i visible = _mm256_or_si256(_mm256_andnot_si256(rf, ge),
+                                              _mm256_and_si256(rf, vInclude));
+
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(mask + i),
+                          _mm256_and_si256(visible, vOne));
+   }
+
+   return i;
+}
+
+SCWX_TARGET_AVX2 static std::size_t
+ThresholdMaskAvx2(const std::uint16_t* moments,
+                  std::size_t          count,
+                  std::uint16_t        threshold,
+                  bool                 includeRangeFolded,
+                  std::uint8_t*        mask)
+{
+   constexpr std::size_t kValuesPerBlock = kAvx2BlockSize_ / 2;
+
+   const __m256i vThreshold = _mm256_set1_epi16(static_cast<short>(threshold));
+   const __m256i vRangeFolded = _mm256_set1_epi16(kRangeFolded_);
+   const __m256i vInclude     = _mm256_set1_epi16(
+      static_cast<short>(includeRangeFolded ? 0xffff : 0x0000));
+   const __m256i vOne = _mm256_set1_epi8(1);
+
+   std::size_t i = 0;
+   for (; i + kValuesPerBlock * 2 <= count; i += kValuesPerBlock * 2)
+   {
+      const __m256i v0 =
+         _mm256_loadu_si256(reinterpret_cast<const __m256i*>(moments + i));
+      const __m256i v1 = _mm256_loadu_si256(
+         reinterpret_cast<const __m256i*>(moments + i + kValuesPerBlock));
+
+      // Narrow the 16-bit masks to 8-bit masks. Packing operates within each
+      // 128-bit lane, so the 64-bit quarters are reordered afterward.
+      const __m256i packed = _mm256_permute4x64_epi64(
+         _mm256_packs_epi16(
+            Visible16Avx2(v0, vThreshold, vRangeFolded, vInclude),
+            Visible16Avx2(v1, vThreshold, vRangeFolded, vInclude)),
+         0xd8); // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(mask + i),
+                          _mm256_and_si256(packed, vOne));
+   }
+
+   return i;
+}
+
+SCWX_TARGET_AVX2 static std::size_t QuadMaskAvx2(const std::uint8_t* mask0,
+                                                 const std::uint8_t* mask1,
+                                                 std::size_t         count,
+                                                 std::uint8_t*       quadMask)
+{
+   std::size_t i = 0;
+   for (; i + kAvx2BlockSize_ <= count; i += kAvx2BlockSize_)
+   {
+      const __m256i m0 =
+         _mm256_loadu_si256(reinterpret_cast<const __m256i*>(mask0 + i));
+      const __m256i m0Next =
+         _mm256_loadu_si256(reinterpret_cast<const __m256i*>(mask0 + i + 1));
+      const __m256i m1 =
+         _mm256_loadu_si256(reinterpret_cast<const __m256i*>(mask1 + i));
+      const __m256i m1Next =
+         _mm256_loadu_si256(reinterpret_cast<const __m256i*>(mask1 + i + 1));
+
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(quadMask + i),
+                          _mm256_or_si256(_mm256_or_si256(m0, m0Next),
+                                          _mm256_or_si256(m1, m1Next)));
+   }
+
+   return i;
+}
+
+SCWX_TARGET_AVX2 static std::size_t
+RemapAvx2(const std::uint8_t* moments,
+          std::size_t         count,
+          std::uint8_t        edgeValue,
+          bool                showRangeFolding,
+          std::uint8_t*       output)
+{
+   const __m256i vEdge        = _mm256_set1_epi8(static_cast<char>(edgeValue));
+   const __m256i vZero        = _mm256_setzero_si256();
+   const __m256i vRangeFolded = _mm256_set1_epi8(kRangeFolded_);
+
+   std::size_t i = 0;
+   for (; i + kAvx2BlockSize_ <= count; i += kAvx2BlockSize_)
+   {
+      const __m256i v =
+         _mm256_loadu_si256(reinterpret_cast<const __m256i*>(moments + i));
+
+      __m256i edge = _mm256_cmpeq_epi8(v, vZero);
+      if (!showRangeFolding)
+      {
+         edge = _mm256_or_si256(edge, _mm256_cmpeq_epi8(v, vRangeFolded));
+      }
+
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i),
+                          _mm256_blendv_epi8(v, vEdge, edge));
+   }
+
+   return i;
+}
+
+SCWX_TARGET_AVX2 static std::size_t
+RemapAvx2(const std::uint16_t* moments,
+          std::size_t          count,
+          std::uint16_t        edgeValue,
+          bool                 showRangeFolding,
+          std::uint16_t*       output)
+{
+   constexpr std::size_t kValuesPerBlock = kAvx2BlockSize_ / 2;
+
+   const __m256i vEdge = _mm256_set1_epi16(static_cast<short>(edgeValue));
+   const __m256i vZero = _mm256_setzero_si256();
+   const __m256i vRangeFolded = _mm256_set1_epi16(kRangeFolded_);
+
+   std::size_t i = 0;
+   for (; i + kValuesPerBlock <= count; i += kValuesPerBlock)
+   {
+      const __m256i v =
+         _mm256_loadu_si256(reinterpret_cast<const __m256i*>(moments + i));
+
+      __m256i edge = _mm256_cmpeq_epi16(v, vZero);
+      if (!showRangeFolding)
+      {
+         edge = _mm256_or_si256(edge, _mm256_cmpeq_epi16(v, vRangeFolded));
+      }
+
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i),
+                          _mm256_blendv_epi8(v, vEdge, edge));
+   }
+
+   return i;
+}
+
+#endif
+
+void ThresholdMask(const std::uint8_t* moments,
+                   std::size_t         count,
+                   std::uint16_t       threshold,
+                   bool                includeRangeFolded,
+                   std::uint8_t*       mask,
+                   InstructionSet      instructionSet)
+{
+   std::size_t i = 0;
+
+#if defined(SCWX_MOMENT_KERNELS_X86)
+   // A threshold above the 8-bit range hides all values other than range
+   // folded, which the vectorized kernels cannot represent
+   if (threshold <= std::numeric_limits<std::uint8_t>::max())
+   {
+      const auto threshold8 = static_cast<std::uint8_t>(threshold);
+
+      switch (SelectInstructionSet(instructionSet))
+      {
+      case InstructionSet::Avx2:
+         i = ThresholdMaskAvx2(
+            moments, count, threshold8, includeRangeFolded, mask);
+         break;
+
+      case InstructionSet::Sse4_1:
+         i = ThresholdMaskSse4_1(
+            moments, count, threshold8, includeRangeFolded, mask);
+         break;
+
+      default:
+         break;
+      }
+   }
+#else
+   (void) instructionSet;
+#endif
+
+   ThresholdMaskScalar(
+      moments + i, count - i, threshold, includeRangeFolded, mask + i);
+}
+
+void ThresholdMask(const std::uint16_t* moments,
+                   std::size_t          count,
+                   std::uint16_t        threshold,
+                   bool                 includeRangeFolded,
+                   std::uint8_t*        mask,
+                   InstructionSet       instructionSet)
+{
+   std::size_t i = 0;
+
+#if defined(SCWX_MOMENT_KERNELS_X86)
+   switch (SelectInstructionSet(instructionSet))
+   {
+   case InstructionSet::Avx2:
+      i = ThresholdMaskAvx2(
+         moments, count, threshold, includeRangeFolded, mask);
+      break;
+
+   case InstructionSet::Sse4_1:
+      i = ThresholdMaskSse4_1(
+         moments, count, threshold, includeRangeFolded, mask);
+      break;
+
+   default:
+      break;
+   }
+#else
+   (void) instructionSet;
+#endif
+
+   ThresholdMaskScalar(
+      moments + i, count - i, threshold, includeRangeFolded, mask + i);
+}
+
+void QuadMask(const std::uint8_t* mask0,
+              const std::uint8_t* mask1,
+              std::size_t         count,
+              std::uint8_t*       quadMask,
+              InstructionSet      instructionSet)
+{
+   std::size_t i = 0;
+
+#if defined(SCWX_MOMENT_KERNELS_X86)
+   switch (SelectInstructionSet(instructionSet))
+   {
+   case InstructionSet::Avx2:
+      i = QuadMaskAvx2(mask0, mask1, count, quadMask);
+      break;
+
+   case InstructionSet::Sse4_1:
+      i = QuadMaskSse4_1(mask0, mask1, count, quadMask);
+      break;
+
+   default:
+      break;
+   }
+#else
+   (void) instructionSet;
+#endif
+
+   QuadMaskScalar(mask0 + i, mask1 + i, count - i, quadMask + i);
+}
+
+void Remap(const std::uint8_t* moments,
+           std::size_t         count,
+           std::uint8_t        edgeValue,
+           bool                showRangeFolding,
+           std::uint8_t*       output,
+           InstructionSet      instructionSet)
+{
+   std::size_t i = 0;
+
+#if defined(SCWX_MOMENT_KERNELS_X86)
+   switch (SelectInstructionSet(instructionSet))
+   {
+   case InstructionSet::Avx2:
+      i = RemapAvx2(moments, count, edgeValue, showRangeFolding, output);
+      break;
+
+   case InstructionSet::Sse4_1:
+      i = RemapSse4_1(moments, count, edgeValue, showRangeFolding, output);
+      break;
+
+   default:
+      break;
+   }
+#else
+   (void) instructionSet;
+#endif
+
+   RemapScalar(
+      moments + i, count - i, edgeValue, showRangeFolding, output + i);
+}
+
+void Remap(const std::uint16_t* moments,
+           std::size_t          count,
+           std::uint16_t        edgeValue,
+           bool                 showRangeFolding,
+           std::uint16_t*       output,
+           InstructionSet       instructionSet)
+{
+   std::size_t i = 0;
+
+#if defined(SCWX_MOMENT_KERNELS_X86)
+   switch (SelectInstructionSet(instructionSet))
+   {
+   case InstructionSet::Avx2:
+      i = RemapAvx2(moments, count, edgeValue, showRangeFolding, output);
+      break;
+
+   case InstructionSet::Sse4_1:
+      i = RemapSse4_1(moments, count, edgeValue, showRangeFolding, output);
+      break;
+
+   default:
+      break;
+   }
+#else
+   (void) instructionSet;
+#endif
+
+   RemapScalar(
+      moments + i, count - i, edgeValue, showRangeFolding, output + i);
+}
+
+// NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+} // namespace scwx::qt::util::MomentKernels
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace scwx::qt::util::MomentKernels
+{
+
+/**
+ * Instruction sets available to the data moment kernels. Auto selects the best
+ * instruction set supported by the processor at runtime.
+ */
+enum class InstructionSet
+{
+   Auto,
+   Scalar,
+   Sse4_1,
+   Avx2
+};
+
+/**
+ * Get the best instruction set supported by the processor.
+ *
+ * @return Supported instruction set (never Auto)
+ */
+InstructionSet SupportedInstructionSet();
+
+/**
+ * Determine which data moments are visible. A data moment is visible if it is
+ * at or above the threshold, or, if range folded data moments are included, is
+ * range folded.
+ *
+ * @param [in] moments Data moments
+ * @param [in] count Number of data moments
+ * @param [in] threshold Minimum visible data moment value
+ * @param [in] includeRangeFolded Whether range folded data moments are visible
+ * @param [out] mask Visibility of each data moment (1 if visible, 0 if not),
+ * sized for at least count values
+ * @param [in] instructionSet Instruction set to use
+ */
+void ThresholdMask(const std::uint8_t* moments,
+                   std::size_t         count,
+                   std::uint16_t       threshold,
+                   bool                includeRangeFolded,
+                   std::uint8_t*       mask,
+                   InstructionSet      instructionSet = InstructionSet::Auto);
+void ThresholdMask(const std::uint16_t* moments,
+                   std::size_t          count,
+                   std::uint16_t        threshold,
+                   bool                 includeRangeFolded,
+                   std::uint8_t*        mask,
+                   InstructionSet       instructionSet = InstructionSet::Auto);
+
+/**
+ * Determine which smoothing quads are visible. A quad is formed by two
+ * adjacent gates of two adjacent radials, and is visible if any of its corners
+ * are visible.
+ *
+ * @param [in] mask0 Visibility of the first radial, sized for count + 1 values
+ * @param [in] mask1 Visibility of the second radial, sized for count + 1
+ * values
+ * @param [in] count Number of quads
+ * @param [out] quadMask Visibility of each quad, sized for at least count
+ * values
+ * @param [in] instructionSet Instruction set to use
+ */
+void QuadMask(const std::uint8_t* mask0,
+              const std::uint8_t* mask1,
+              std::size_t         count,
+              std::uint8_t*       quadMask,
+              InstructionSet      instructionSet = InstructionSet::Auto);
+
+/**
+ * Remap data moments at the edge of smoothed data. Data moments without data,
+ * and range folded data moments if they are not shown, are replaced with the
+ * edge value, so that smoothing does not interpolate to the bottom of the color
+ * table.
+ *
+ * @param [in] moments Data moments
+ * @param [in] count Number of data moments
+ * @param [in] edgeValue Value to replace edge data moments
+ * @param [in] showRangeFolding Whether range folded data moments are shown
+ * @param [out] output Remapped data moments, sized for at least count values.
+ * May be the same as moments.
+ * @param [in] instructionSet Instruction set to use
+ */
+void Remap(const std::uint8_t* moments,
+           std::size_t         count,
+           std::uint8_t        edgeValue,
+           bool                showRangeFolding,
+           std::uint8_t*       output,
+           InstructionSet      instructionSet = InstructionSet::Auto);
+void Remap(const std::uint16_t* moments,
+           std::size_t          count,
+           std::uint16_t        edgeValue,
+           bool                 showRangeFolding,
+           std::uint16_t*       output,
+           InstructionSet       instructionSet = InstructionSet::Auto);
+
+} // namespace scwx::qt::util::MomentKernels
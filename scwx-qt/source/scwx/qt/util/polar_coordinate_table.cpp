@@ -0,0 +1,306 @@
+#include <scwx/qt/util/polar_coordinate_table.hpp>
+#include <scwx/qt/util/geographic_lib.hpp>
+#include <scwx/common/constants.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <execution>
+#include <future>
+#include <list>
+#include <mutex>
+#include <utility>
+
+#include <boost/range/irange.hpp>
+#include <boost/timer/timer.hpp>
+
+namespace scwx::qt::util
+{
+
+static const std::string logPrefix_ = "scwx::qt::util::polar_coordinate_table";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+// Number of released tables to retain. This covers the four tables used by a
+// radar site for two recently used sites.
+static constexpr std::size_t kMaxRetainedTables_ = 8u;
+
+static constexpr float kFullCircle_ = 360.0f;
+static constexpr float kHalfCircle_ = 180.0f;
+static constexpr int   kTimerPlaces_ {6};
+
+class PolarCoordinateTable::Impl
+{
+public:
+   explicit Impl(const Parameters& parameters) :
+       parameters_ {parameters},
+       radialCount_ {static_cast<std::size_t>(std::max(
+          1l, std::lroundf(kFullCircle_ / parameters.radialAngle_)))}
+   {
+   }
+   ~Impl() = default;
+
+   Impl(const Impl&)            = delete;
+   Impl& operator=(const Impl&) = delete;
+   Impl(Impl&&)                 = delete;
+   Impl& operator=(Impl&&)      = delete;
+
+   void CalculateCoordinates();
+
+   // Requires cacheMutex_ to be held
+   static void Retain(const std::shared_ptr<const PolarCoordinateTable>& table);
+
+   const Parameters   parameters_;
+   const std::size_t  radialCount_;
+   std::vector<float> coordinates_ {};
+
+   static std::mutex cacheMutex_;
+   static std::list<std::weak_ptr<const PolarCoordinateTable>> tables_;
+   static std::list<std::shared_ptr<const PolarCoordinateTable>>
+      retainedTables_;
+   static std::list<
+      std::pair<Parameters,
+                std::shared_future<std::shared_ptr<const PolarCoordinateTable>>>>
+      pendingTables_;
+};
+
+std::mutex PolarCoordinateTable::Impl::cacheMutex_ {};
+std::list<std::weak_ptr<const PolarCoordinateTable>>
+   PolarCoordinateTable::Impl::tables_ {};
+std::list<std::shared_ptr<const PolarCoordinateTable>>
+   PolarCoordinateTable::Impl::retainedTables_ {};
+std::list<std::pair<
+   PolarCoordinateTable::Parameters,
+   std::shared_future<std::shared_ptr<const PolarCoordinateTable>>>>
+   PolarCoordinateTable::Impl::pendingTables_ {};
+
+PolarCoordinateTable::PolarCoordinateTable(const Parameters& parameters) :
+    p(std::make_unique<Impl>(parameters))
+{
+   p->CalculateCoordinates();
+}
+
+PolarCoordinateTable::~PolarCoordinateTable() = default;
+
+const PolarCoordinateTable::Parameters& PolarCoordinateTable::parameters() const
+{
+   return p->parameters_;
+}
+
+const std::vector<float>& PolarCoordinateTable::coordinates() const
+{
+   return p->coordinates_;
+}
+
+std::size_t PolarCoordinateTable::radial_count() const
+{
+   return p->radialCount_;
+}
+
+std::size_t PolarCoordinateTable::gate_count() const
+{
+   return common::MAX_DATA_MOMENT_GATES;
+}
+
+void PolarCoordinateTable::Impl::CalculateCoordinates()
+{
+   boost::timer::cpu_timer timer;
+
+   const ::GeographicLib::Geodesic& geodesic(
+      GeographicLib::DefaultGeodesic());
+
+   const auto radialGates = boost::irange<std::uint32_t>(
+      0u,
+      static_cast<std::uint32_t>(radialCount_ * common::MAX_DATA_MOMENT_GATES));
+
+   coordinates_.resize(radialGates.size() * 2);
+
+   std::for_each(
+      std::execution::par_unseq,
+      radialGates.begin(),
+      radialGates.end(),
+      [&](std::uint32_t radialGate)
+      {
+         const auto gate = static_cast<std::uint16_t>(
+            radialGate % common::MAX_DATA_MOMENT_GATES);
+         const auto radial = static_cast<std::uint16_t>(
+            radialGate / common::MAX_DATA_MOMENT_GATES);
+
+         const float angle = static_cast<float>(radial) *
+                                parameters_.radialAngle_ +
+                             parameters_.angleOffset_;
+         const float range =
+            (static_cast<float>(gate) + parameters_.gateRangeOffset_) *
+            parameters_.gateSize_;
+         const std::size_t offset = static_cast<std::size_t>(radialGate) * 2;
+
+         double latitude  = 0.0;
+         double longitude = 0.0;
+
+         geodesic.Direct(parameters_.latitude_,
+                         parameters_.longitude_,
+                         angle,
+                         range,
+                         latitude,
+                         longitude);
+
+         coordinates_[offset]     = static_cast<float>(latitude);
+         coordinates_[offset + 1] = static_cast<float>(longitude);
+      });
+
+   timer.stop();
+   logger_->debug("Coordinates ({} degree, {} offset) calculated in {}",
+                  parameters_.radialAngle_,
+                  parameters_.angleOffset_,
+                  timer.format(kTimerPlaces_, "%ws"));
+}
+
+void PolarCoordinateTable::GetRadial(float        azimuth,
+                                     std::size_t  gateCount,
+                                     float* const output) const
+{
+   const auto& parameters = p->parameters_;
+   const auto  radials    = static_cast<std::ptrdiff_t>(p->radialCount_);
+
+   gateCount = std::min<std::size_t>(gateCount, common::MAX_DATA_MOMENT_GATES);
+
+   // Find the table radials bracketing the azimuth
+   const float position =
+      (azimuth - parameters.angleOffset_) / parameters.radialAngle_;
+   const float       radialPosition = std::floor(position);
+   const float       t              = position - radialPosition;
+   const std::size_t radial0 = static_cast<std::size_t>(
+      ((static_cast<std::ptrdiff_t>(radialPosition) % radials) + radials) %
+      radials);
+   const std::size_t radial1 = (radial0 + 1) % p->radialCount_;
+
+   const float* coordinates0 =
+      &p->coordinates_[radial0 * common::MAX_DATA_MOMENT_GATES * 2];
+   const float* coordinates1 =
+      &p->coordinates_[radial1 * common::MAX_DATA_MOMENT_GATES * 2];
+
+   for (std::size_t i = 0; i < gateCount * 2; i += 2)
+   {
+      const float latitude0  = coordinates0[i];
+      const float longitude0 = coordinates0[i + 1];
+
+      float deltaLongitude = coordinates1[i + 1] - longitude0;
+
+      // Interpolate across the antimeridian
+      if (deltaLongitude > kHalfCircle_)
+      {
+         deltaLongitude -= kFullCircle_;
+      }
+      else if (deltaLongitude < -kHalfCircle_)
+      {
+         deltaLongitude += kFullCircle_;
+      }
+
+      float longitude = longitude0 + t * deltaLongitude;
+      if (longitude > kHalfCircle_)
+      {
+         longitude -= kFullCircle_;
+      }
+      else if (longitude < -kHalfCircle_)
+      {
+         longitude += kFullCircle_;
+      }
+
+      output[i]     = latitude0 + t * (coordinates1[i] - latitude0);
+      output[i + 1] = longitude;
+   }
+}
+
+std::shared_ptr<const PolarCoordinateTable>
+PolarCoordinateTable::Get(const Parameters& parameters)
+{
+   std::unique_lock lock {Impl::cacheMutex_};
+
+   auto& tables        = Impl::tables_;
+   auto& pendingTables = Impl::pendingTables_;
+
+   std::shared_ptr<const PolarCoordinateTable> table {};
+
+   // Look for a table which is still in use, pruning released tables
+   for (auto it = tables.begin(); it != tables.end();)
+   {
+      auto candidate = it->lock();
+      if (candidate == nullptr)
+      {
+         it = tables.erase(it);
+         continue;
+      }
+
+      if (table == nullptr && candidate->parameters() == parameters)
+      {
+         table = std::move(candidate);
+      }
+
+      ++it;
+   }
+
+   if (table != nullptr)
+   {
+      Impl::Retain(table);
+      return table;
+   }
+
+   // Wait for a table which is being computed by another caller
+   auto pending = std::find_if(pendingTables.cbegin(),
+                               pendingTables.cend(),
+                               [&parameters](const auto& pendingTable)
+                               { return pendingTable.first == parameters; });
+   if (pending != pendingTables.cend())
+   {
+      auto future = pending->second;
+      lock.unlock();
+      return future.get();
+   }
+
+   // Compute the table outside of the lock, so that other tables may be
+   // requested concurrently
+   std::promise<std::shared_ptr<const PolarCoordinateTable>> promise {};
+   pending = pendingTables.emplace(
+      pendingTables.cend(), parameters, promise.get_future().share());
+   lock.unlock();
+
+   try
+   {
+      table = std::make_shared<const PolarCoordinateTable>(parameters);
+   }
+   catch (...)
+   {
+      lock.lock();
+      pendingTables.erase(pending);
+      lock.unlock();
+
+      promise.set_exception(std::current_exception());
+      throw;
+   }
+
+   lock.lock();
+   pendingTables.erase(pending);
+   tables.push_back(table);
+   Impl::Retain(table);
+   lock.unlock();
+
+   promise.set_value(table);
+
+   return table;
+}
+
+void PolarCoordinateTable::Impl::Retain(
+   const std::shared_ptr<const PolarCoordinateTable>& table)
+{
+   auto& retainedTables = retainedTables_;
+
+   // Move the table to the front of the retained list
+   retainedTables.remove(table);
+   retainedTables.push_front(table);
+
+   if (retainedTables.size() > kMaxRetainedTables_)
+   {
+      retainedTables.pop_back();
+   }
+}
+
+} // namespace scwx::qt::util
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace scwx::qt::util
+{
+
+/**
+ * Geographic coordinates of radar gates along evenly spaced azimuths, solved
+ * once per radar site and gate geometry. Tables are immutable once created, and
+ * are shared between radar product managers and product views through Get().
+ *
+ * Coordinates are stored as latitude/longitude pairs, indexed by
+ * (radial * common::MAX_DATA_MOMENT_GATES + gate) * 2.
+ */
+class PolarCoordinateTable
+{
+public:
+   struct Parameters
+   {
+      double latitude_ {};        // Radar site latitude (degrees)
+      double longitude_ {};       // Radar site longitude (degrees)
+      float  gateSize_ {};        // Distance between gates (meters)
+      float  gateRangeOffset_ {}; // Range of the first gate (gates)
+      float  radialAngle_ {};     // Angle between radials (degrees)
+      float  angleOffset_ {};     // Azimuth of the first radial (degrees)
+
+      bool operator==(const Parameters&) const = default;
+   };
+
+   explicit PolarCoordinateTable(const Parameters& parameters);
+   ~PolarCoordinateTable();
+
+   PolarCoordinateTable(const PolarCoordinateTable&)            = delete;
+   PolarCoordinateTable& operator=(const PolarCoordinateTable&) = delete;
+
+   PolarCoordinateTable(PolarCoordinateTable&&)            = delete;
+   PolarCoordinateTable& operator=(PolarCoordinateTable&&) = delete;
+
+   [[nodiscard]] const Parameters&         parameters() const;
+   [[nodiscard]] const std::vector<float>& coordinates() const;
+   [[nodiscard]] std::size_t               radial_count() const;
+   [[nodiscard]] std::size_t               gate_count() const;
+
+   /**
+    * Get the coordinates of a radial at an arbitrary azimuth. Coordinates are
+    * linearly interpolated between the two table radials bracketing the
+    * azimuth. For a 0.5 degree table, the error against a direct geodesic
+    * solution is under 10 meters at 460 km, well below a single gate.
+    *
+    * @param [in] azimuth Azimuth of the radial (degrees)
+    * @param [in] gateCount Number of gates to output, limited to gate_count()
+    * @param [out] output Latitude/longitude pairs, sized for at least
+    * gateCount * 2 values
+    */
+   void GetRadial(float azimuth, std::size_t gateCount, float* output) const;
+
+   /**
+    * Get a table from the shared cache, computing it if required. Recently
+    * used tables are retained after their last user releases them, so that
+    * switching products or sites does not require the table to be solved
+    * again.
+    *
+    * @param [in] parameters Table parameters
+    *
+    * @return Coordinate table
+    */
+   static std::shared_ptr<const PolarCoordinateTable>
+   Get(const Parameters& parameters);
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace scwx::qt::util
@@ -0,0 +1,280 @@
+#include <scwx/qt/util/spatial_index.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace scwx::qt::util
+{
+
+// Limit the grid size, and the number of cells occupied by a single item.
+// Items occupying more cells are tested on every query.
+static constexpr std::size_t kMaxCellsPerAxis_ = 512u;
+static constexpr std::size_t kMaxItemCells_    = 64u;
+
+class SpatialIndex::Impl
+{
+public:
+   explicit Impl() = default;
+   ~Impl()         = default;
+
+   Impl(const Impl&)             = delete;
+   Impl& operator=(const Impl&)  = delete;
+   Impl(const Impl&&)            = delete;
+   Impl& operator=(const Impl&&) = delete;
+
+   [[nodiscard]] std::size_t CellX(float x) const;
+   [[nodiscard]] std::size_t CellY(float y) const;
+
+   std::vector<Bounds> bounds_ {};
+   float               maxPixelOffset_ {};
+
+   glm::vec2   origin_ {};
+   glm::vec2   cellSize_ {1.0f, 1.0f};
+   std::size_t columns_ {};
+   std::size_t rows_ {};
+
+   // Item indices of each cell, stored contiguously. The items of cell i are
+   // cellItems_[cellStart_[i]] through cellItems_[cellStart_[i + 1] - 1].
+   std::vector<std::size_t> cellStart_ {};
+   std::vector<std::size_t> cellItems_ {};
+   std::vector<std::size_t> largeItems_ {};
+};
+
+SpatialIndex::SpatialIndex() : p(std::make_unique<Impl>()) {}
+SpatialIndex::~SpatialIndex() = default;
+
+SpatialIndex::SpatialIndex(SpatialIndex&&) noexcept            = default;
+SpatialIndex& SpatialIndex::operator=(SpatialIndex&&) noexcept = default;
+
+bool SpatialIndex::empty() const
+{
+   return p->bounds_.empty();
+}
+
+std::size_t SpatialIndex::size() const
+{
+   return p->bounds_.size();
+}
+
+void SpatialIndex::Build(const std::vector<Bounds>& bounds)
+{
+   Clear();
+
+   if (bounds.empty())
+   {
+      return;
+   }
+
+   p->bounds_ = bounds;
+
+   // Determine the extent of all items
+   glm::vec2 extentMin {std::numeric_limits<float>::max()};
+   glm::vec2 extentMax {std::numeric_limits<float>::lowest()};
+
+   for (auto& b : p->bounds_)
+   {
+      extentMin          = glm::min(extentMin, b.min_);
+      extentMax          = glm::max(extentMax, b.max_);
+      p->maxPixelOffset_ = std::max(p->maxPixelOffset_, b.pixelOffset_);
+   }
+
+   // Size the grid for approximately one item per cell
+   const std::size_t cellsPerAxis = std::clamp<std::size_t>(
+      static_cast<std::size_t>(
+         std::ceil(std::sqrt(static_cast<double>(p->bounds_.size())))),
+      1u,
+      kMaxCellsPerAxis_);
+
+   const glm::vec2 extent = extentMax - extentMin;
+
+   p->origin_   = extentMin;
+   p->columns_  = cellsPerAxis;
+   p->rows_     = cellsPerAxis;
+   p->cellSize_ = extent / static_cast<float>(cellsPerAxis);
+
+   // Avoid zero size cells when all items share a coordinate
+   p->cellSize_ = glm::max(p->cellSize_, glm::vec2 {1e-6f});
+
+   // Count the items in each cell
+   std::vector<std::size_t> cellCounts(p->columns_ * p->rows_, 0u);
+
+   for (std::size_t i = 0; i < p->bounds_.size(); ++i)
+   {
+      auto& b = p->bounds_[i];
+
+      const std::size_t x1 = p->CellX(b.min_.x);
+      const std::size_t x2 = p->CellX(b.max_.x);
+      const std::size_t y1 = p->CellY(b.min_.y);
+      const std::size_t y2 = p->CellY(b.max_.y);
+
+      if ((x2 - x1 + 1) * (y2 - y1 + 1) > kMaxItemCells_)
+      {
+         p->largeItems_.push_back(i);
+         continue;
+      }
+
+      for (std::size_t y = y1; y <= y2; ++y)
+      {
+         for (std::size_t x = x1; x <= x2; ++x)
+         {
+            ++cellCounts[y * p->columns_ + x];
+         }
+      }
+   }
+
+   // Calculate the start of each cell
+   p->cellStart_.resize(cellCounts.size() + 1);
+   p->cellStart_[0] = 0u;
+   for (std::size_t i = 0; i < cellCounts.size(); ++i)
+   {
+      p->cellStart_[i + 1] = p->cellStart_[i] + cellCounts[i];
+   }
+
+   // Populate the cells, in ascending item order
+   p->cellItems_.resize(p->cellStart_.back());
+   std::vector<std::size_t> cellPosition(p->cellStart_.cbegin(),
+                                         p->cellStart_.cend() - 1);
+
+   for (std::size_t i = 0; i < p->bounds_.size(); ++i)
+   {
+      auto& b = p->bounds_[i];
+
+      const std::size_t x1 = p->CellX(b.min_.x);
+      const std::size_t x2 = p->CellX(b.max_.x);
+      const std::size_t y1 = p->CellY(b.min_.y);
+      const std::size_t y2 = p->CellY(b.max_.y);
+
+      if ((x2 - x1 + 1) * (y2 - y1 + 1) > kMaxItemCells_)
+      {
+         continue;
+      }
+
+      for (std::size_t y = y1; y <= y2; ++y)
+      {
+         for (std::size_t x = x1; x <= x2; ++x)
+         {
+            p->cellItems_[cellPosition[y * p->columns_ + x]++] = i;
+         }
+      }
+   }
+}
+
+void SpatialIndex::Clear()
+{
+   p->bounds_.clear();
+   p->maxPixelOffset_ = 0.0f;
+   p->columns_        = 0u;
+   p->rows_           = 0u;
+   p->cellStart_.clear();
+   p->cellItems_.clear();
+   p->largeItems_.clear();
+}
+
+void SpatialIndex::Query(const glm::vec2&          point,
+                         float                     pixelScale,
+                         std::vector<std::size_t>& items) const
+{
+   items.clear();
+
+   if (p->bounds_.empty())
+   {
+      return;
+   }
+
+   auto Contains = [this, &point, pixelScale](std::size_t i)
+   {
+      auto&       b      = p->bounds_[i];
+      const float offset = b.pixelOffset_ * pixelScale;
+
+      return point.x >= b.min_.x - offset && point.x <= b.max_.x + offset &&
+             point.y >= b.min_.y - offset && point.y <= b.max_.y + offset;
+   };
+
+   // Search the cells within the maximum offset of the point
+   const float     maxOffset = p->maxPixelOffset_ * pixelScale;
+   const glm::vec2 queryMin  = point - maxOffset;
+   const glm::vec2 queryMax  = point + maxOffset;
+
+   const glm::vec2 gridMax =
+      p->origin_ +
+      p->cellSize_ * glm::vec2 {static_cast<float>(p->columns_),
+                                static_cast<float>(p->rows_)};
+
+   if (queryMax.x >= p->origin_.x && queryMax.y >= p->origin_.y &&
+       queryMin.x <= gridMax.x && queryMin.y <= gridMax.y)
+   {
+      const std::size_t x1 = p->CellX(queryMin.x);
+      const std::size_t x2 = p->CellX(queryMax.x);
+      const std::size_t y1 = p->CellY(queryMin.y);
+      const std::size_t y2 = p->CellY(queryMax.y);
+
+      for (std::size_t y = y1; y <= y2; ++y)
+      {
+         for (std::size_t x = x1; x <= x2; ++x)
+         {
+            const std::size_t cell = y * p->columns_ + x;
+
+            for (std::size_t j = p->cellStart_[cell];
+                 j < p->cellStart_[cell + 1];
+                 ++j)
+            {
+               if (Contains(p->cellItems_[j]))
+               {
+                  items.push_back(p->cellItems_[j]);
+               }
+            }
+         }
+      }
+   }
+
+   for (std::size_t i : p->largeItems_)
+   {
+      if (Contains(i))
+      {
+         items.push_back(i);
+      }
+   }
+
+   // Items occupying multiple cells may be found more than once
+   std::sort(items.begin(), items.end());
+   items.erase(std::unique(items.begin(), items.end()), items.end());
+}
+
+SpatialIndex::Bounds
+SpatialIndex::CreateBounds(std::initializer_list<glm::vec2> points,
+                           std::initializer_list<glm::vec2> pixelOffsets)
+{
+   Bounds bounds {.min_ = glm::vec2 {std::numeric_limits<float>::max()},
+                  .max_ = glm::vec2 {std::numeric_limits<float>::lowest()},
+                  .pixelOffset_ = 0.0f};
+
+   for (auto& point : points)
+   {
+      bounds.min_ = glm::min(bounds.min_, point);
+      bounds.max_ = glm::max(bounds.max_, point);
+   }
+
+   for (auto& offset : pixelOffsets)
+   {
+      bounds.pixelOffset_ = std::max(bounds.pixelOffset_, glm::length(offset));
+   }
+
+   return bounds;
+}
+
+std::size_t SpatialIndex::Impl::CellX(float x) const
+{
+   const float cell = std::floor((x - origin_.x) / cellSize_.x);
+   return static_cast<std::size_t>(
+      std::clamp(cell, 0.0f, static_cast<float>(columns_ - 1)));
+}
+
+std::size_t SpatialIndex::Impl::CellY(float y) const
+{
+   const float cell = std::floor((y - origin_.y) / cellSize_.y);
+   return static_cast<std::size_t>(
+      std::clamp(cell, 0.0f, static_cast<float>(rows_ - 1)));
+}
+
+} // namespace scwx::qt::util
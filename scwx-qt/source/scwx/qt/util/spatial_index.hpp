@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+namespace scwx::qt::util
+{
+
+/**
+ * Uniform grid index of item bounds in map screen coordinates, used to find
+ * the items near the mouse without testing every pickable item. Items are
+ * identified by their index in the list of bounds used to build the index.
+ *
+ * Bounds include a maximum offset in pixels, for items such as lines and icons
+ * which extend a fixed number of pixels from their anchor points regardless of
+ * map zoom. Pixel offsets are converted to map screen coordinates at query
+ * time.
+ */
+class SpatialIndex
+{
+public:
+   struct Bounds
+   {
+      glm::vec2 min_ {};         // Minimum anchor map screen coordinate
+      glm::vec2 max_ {};         // Maximum anchor map screen coordinate
+      float     pixelOffset_ {}; // Maximum vertex offset from anchor (pixels)
+   };
+
+   explicit SpatialIndex();
+   ~SpatialIndex();
+
+   SpatialIndex(const SpatialIndex&)            = delete;
+   SpatialIndex& operator=(const SpatialIndex&) = delete;
+
+   SpatialIndex(SpatialIndex&&) noexcept;
+   SpatialIndex& operator=(SpatialIndex&&) noexcept;
+
+   [[nodiscard]] bool        empty() const;
+   [[nodiscard]] std::size_t size() const;
+
+   /**
+    * Build the index, replacing any existing items.
+    *
+    * @param [in] bounds Bounds of each item
+    */
+   void Build(const std::vector<Bounds>& bounds);
+
+   /**
+    * Remove all items from the index.
+    */
+   void Clear();
+
+   /**
+    * Find the items whose bounds contain a point, after expanding the bounds
+    * by the pixel offset of each item. Candidates must still be tested against
+    * the exact item geometry.
+    *
+    * @param [in] point Map screen coordinate
+    * @param [in] pixelScale Map screen coordinate units per pixel
+    * @param [out] items Candidate item indices, in ascending order
+    */
+   void Query(const glm::vec2&          point,
+              float                     pixelScale,
+              std::vector<std::size_t>& items) const;
+
+   /**
+    * Create item bounds from anchor points, and vertex offsets in pixels.
+    *
+    * @param [in] points Anchor map screen coordinates
+    * @param [in] pixelOffsets Vertex offsets from the anchor points (pixels)
+    *
+    * @return Item bounds
+    */
+   static Bounds CreateBounds(std::initializer_list<glm::vec2> points,
+                              std::initializer_list<glm::vec2> pixelOffsets);
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace scwx::qt::util
@@ -606,14 +606,17 @@ TextureAtlas::Impl::ReadPngFile(const QString& imagePath)
 std::shared_ptr<boost::gil::rgba8_image_t>
 TextureAtlas::Impl::ReadSvgFile(const QString& imagePath, double scale)
 {
+   // Render to a QImage rather than a QPixmap, so textures may be read from
+   // outside of the GUI thread
    QSvgRenderer renderer {imagePath};
-   QPixmap      pixmap {renderer.defaultSize() * scale};
-   pixmap.fill(Qt::GlobalColor::transparent);
+   QImage       qImage {renderer.defaultSize() * scale,
+                        QImage::Format_ARGB32_Premultiplied};
+   qImage.fill(Qt::GlobalColor::transparent);
 
-   QPainter painter {&pixmap};
-   renderer.render(&painter, pixmap.rect());
-
-   QImage qImage = pixmap.toImage();
+   {
+      QPainter painter {&qImage};
+      renderer.render(&painter, qImage.rect());
+   }
 
    std::shared_ptr<boost::gil::rgba8_image_t> image = nullptr;
 
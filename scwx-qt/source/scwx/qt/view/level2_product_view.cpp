@@ -2,6 +2,8 @@
 #include <scwx/qt/settings/unit_settings.hpp>
 #include <scwx/qt/types/unit_types.hpp>
 #include <scwx/qt/util/geographic_lib.hpp>
+#include <scwx/qt/util/moment_kernels.hpp>
+#include <scwx/qt/util/polar_coordinate_table.hpp>
 #include <scwx/common/characters.hpp>
 #include <scwx/common/constants.hpp>
 #include <scwx/util/logger.hpp>
@@ -9,6 +11,7 @@
 #include <scwx/util/time.hpp>
 
 #include <atomic>
+#include <list>
 #include <mutex>
 
 #include <boost/range/irange.hpp>
@@ -29,6 +32,12 @@ static constexpr std::uint8_t kDataWordSize8_ = 8u;
 static constexpr std::size_t kVerticesPerGate_       = 6u;
 static constexpr std::size_t kVerticesPerOriginGate_ = 3u;
 
+// Memory budget for computed sweeps retained by a view when the frame cache is
+// enabled, enough for a typical loop of super resolution sweeps
+static constexpr std::size_t kFrameCacheSize_ = 512u * 1024u * 1024u;
+
+static std::atomic<std::uint64_t> nextFrameId_ {1u};
+
 static constexpr uint16_t RANGE_FOLDED      = 1u;
 static constexpr uint32_t VERTICES_PER_BIN  = 6u;
 static constexpr uint32_t VALUES_PER_VERTEX = 2u;
@@ -63,6 +72,38 @@ static const std::unordered_map<common::Level2Product, std::string>
 class Level2ProductView::Impl
 {
 public:
+   struct Frame
+   {
+      std::uint64_t         id_ {0u};
+      std::vector<float>    vertices_ {};
+      std::vector<uint8_t>  dataMoments8_ {};
+      std::vector<uint16_t> dataMoments16_ {};
+      std::vector<uint8_t>  cfpMoments_ {};
+
+      // When the sweep is computed as a polar texture, data moments are stored
+      // in radial by gate order, and no vertices are computed
+      bool               polar_ {false};
+      std::size_t        radials_ {0u};
+      std::size_t        gates_ {0u};
+      std::vector<float> radialAzimuths_ {};
+      float              azimuthOffset_ {0.0f};
+      float              gateRange_ {0.0f};
+      float              gateInterval_ {0.0f};
+      std::uint16_t      snrThreshold_ {0u};
+
+      std::weak_ptr<wsr88d::rda::ElevationScan> elevationScan_ {};
+      wsr88d::rda::DataBlockType                dataBlockType_ {
+         wsr88d::rda::DataBlockType::Unknown};
+      bool smoothingEnabled_ {false};
+      bool showSmoothedRangeFolding_ {false};
+
+      units::kilometers<float>              range_ {};
+      std::uint16_t                         vcp_ {};
+      std::chrono::system_clock::time_point sweepTime_ {};
+
+      [[nodiscard]] std::size_t memory_usage() const;
+   };
+
    explicit Impl(Level2ProductView* self, common::Level2Product product) :
        self_ {self},
        product_ {product},
@@ -128,9 +169,30 @@ public:
    void UpdateSpeedUnits(const std::string& name);
 
    void ComputeEdgeValue();
-   template<typename T>
-   [[nodiscard]] inline T RemapDataMoment(T dataMoment) const;
-
+   void ComputePolarSweep(
+      const std::shared_ptr<wsr88d::rda::ElevationScan>& radarData,
+      Frame&                                             frame,
+      std::size_t                                        radials,
+      std::size_t                                        vertexRadials,
+      std::uint32_t                                      gates);
+   void CacheFrame(const std::shared_ptr<const Frame>& frame);
+   void StoreFrame(std::shared_ptr<Frame>                             frame,
+                   const std::shared_ptr<wsr88d::rda::ElevationScan>& radarData,
+                   bool smoothingEnabled,
+                   bool showSmoothedRangeFolding,
+                   bool frameCacheEnabled);
+   void ClearFrameCache();
+   std::shared_ptr<const Frame>
+   FindCachedFrame(const std::shared_ptr<wsr88d::rda::ElevationScan>& radarData,
+                   bool smoothingEnabled,
+                   bool showSmoothedRangeFolding,
+                   bool polar);
+
+   static std::optional<units::degrees<float>>
+   GetRadialAngle(const std::shared_ptr<wsr88d::rda::ElevationScan>& radarData,
+                  std::uint32_t                                      radial,
+                  std::uint16_t                                      numRadials,
+                  bool smoothingEnabled);
    static bool IsRadarDataIncomplete(
       const std::shared_ptr<const wsr88d::rda::ElevationScan>& radarData);
    static units::degrees<float> NormalizeAngle(units::degrees<float> angle);
@@ -151,13 +213,15 @@ public:
 
    bool lastShowSmoothedRangeFolding_ {false};
    bool lastSmoothingEnabled_ {false};
+   bool lastPolarSweep_ {false};
 
-   std::vector<float>    coordinates_ {};
-   std::vector<float>    vertices_ {};
-   std::vector<uint8_t>  dataMoments8_ {};
-   std::vector<uint16_t> dataMoments16_ {};
-   std::vector<uint8_t>  cfpMoments_ {};
-   std::uint16_t         edgeValue_ {};
+   std::vector<float>           coordinates_ {};
+   std::shared_ptr<const Frame> frame_ {std::make_shared<Frame>()};
+   std::uint16_t                edgeValue_ {};
+
+   // Recently computed frames, most recently used first
+   std::list<std::shared_ptr<const Frame>> cachedFrames_ {};
+   std::size_t                             cachedFramesSize_ {0u};
 
    bool showSmoothedRangeFolding_ {false};
 
@@ -358,7 +422,46 @@ uint16_t Level2ProductView::vcp() const
 
 const std::vector<float>& Level2ProductView::vertices() const
 {
-   return p->vertices_;
+   return p->frame_->vertices_;
+}
+
+std::optional<RadarProductView::PolarSweep>
+Level2ProductView::GetPolarSweep() const
+{
+   const auto& frame = p->frame_;
+
+   if (!frame->polar_)
+   {
+      return std::nullopt;
+   }
+
+   PolarSweep polarSweep {};
+
+   if (frame->dataMoments8_.size() > 0)
+   {
+      polarSweep.moments_       = frame->dataMoments8_.data();
+      polarSweep.componentSize_ = sizeof(std::uint8_t);
+   }
+   else
+   {
+      polarSweep.moments_       = frame->dataMoments16_.data();
+      polarSweep.componentSize_ = sizeof(std::uint16_t);
+   }
+
+   polarSweep.radials_        = frame->radials_;
+   polarSweep.gates_          = frame->gates_;
+   polarSweep.radialAzimuths_ = frame->radialAzimuths_;
+   polarSweep.azimuthOffset_  = frame->azimuthOffset_;
+   polarSweep.gateRange_      = frame->gateRange_;
+   polarSweep.gateInterval_   = frame->gateInterval_;
+   polarSweep.snrThreshold_   = frame->snrThreshold_;
+
+   return polarSweep;
+}
+
+std::uint64_t Level2ProductView::frame_id() const
+{
+   return p->frame_->id_;
 }
 
 common::RadarProductGroup Level2ProductView::GetRadarProductGroup() const
@@ -383,16 +486,18 @@ std::tuple<const void*, size_t, size_t> Level2ProductView::GetMomentData() const
    size_t      dataSize;
    size_t      componentSize;
 
-   if (p->dataMoments8_.size() > 0)
+   const auto& frame = p->frame_;
+
+   if (frame->dataMoments8_.size() > 0)
    {
-      data          = p->dataMoments8_.data();
-      dataSize      = p->dataMoments8_.size() * sizeof(uint8_t);
+      data          = frame->dataMoments8_.data();
+      dataSize      = frame->dataMoments8_.size() * sizeof(uint8_t);
       componentSize = 1;
    }
    else
    {
-      data          = p->dataMoments16_.data();
-      dataSize      = p->dataMoments16_.size() * sizeof(uint16_t);
+      data          = frame->dataMoments16_.data();
+      dataSize      = frame->dataMoments16_.size() * sizeof(uint16_t);
       componentSize = 2;
    }
 
@@ -406,10 +511,12 @@ Level2ProductView::GetCfpMomentData() const
    size_t      dataSize      = 0;
    size_t      componentSize = 1;
 
-   if (p->cfpMoments_.size() > 0)
+   const auto& cfpMoments = p->frame_->cfpMoments_;
+
+   if (cfpMoments.size() > 0)
    {
-      data     = p->cfpMoments_.data();
-      dataSize = p->cfpMoments_.size() * sizeof(uint8_t);
+      data     = cfpMoments.data();
+      dataSize = cfpMoments.size() * sizeof(uint8_t);
    }
 
    return std::tie(data, dataSize, componentSize);
@@ -568,6 +675,9 @@ void Level2ProductView::ComputeSweep()
    p->showSmoothedRangeFolding_         = show_smoothed_range_folding();
    const bool& showSmoothedRangeFolding = p->showSmoothedRangeFolding_;
 
+   // Smoothed sweeps are always rendered from vertices
+   const bool polarSweep = polar_texture_enabled() && !smoothingEnabled;
+
    std::shared_ptr<wsr88d::rda::ElevationScan> radarData;
    std::chrono::system_clock::time_point       requestedTime {selected_time()};
    types::RadarProductLoadStatus               loadStatus {};
@@ -594,6 +704,7 @@ void Level2ProductView::ComputeSweep()
    }
    if ((radarData == p->elevationScan_) &&
        smoothingEnabled == p->lastSmoothingEnabled_ &&
+       polarSweep == p->lastPolarSweep_ &&
        (showSmoothedRangeFolding == p->lastShowSmoothedRangeFolding_ ||
         !smoothingEnabled))
    {
@@ -603,6 +714,39 @@ void Level2ProductView::ComputeSweep()
 
    p->lastShowSmoothedRangeFolding_ = showSmoothedRangeFolding;
    p->lastSmoothingEnabled_         = smoothingEnabled;
+   p->lastPolarSweep_               = polarSweep;
+
+   const bool frameCacheEnabled = frame_cache_enabled();
+   if (!frameCacheEnabled)
+   {
+      p->ClearFrameCache();
+   }
+   else if (auto cachedFrame = p->FindCachedFrame(radarData,
+                                                  smoothingEnabled,
+                                                  showSmoothedRangeFolding,
+                                                  polarSweep);
+            cachedFrame != nullptr)
+   {
+      logger_->debug("Using cached sweep");
+
+      // Restore the sweep from the frame cache, without recomputing vertices
+      // or data moments
+      auto& radarData0     = (*radarData)[0];
+      auto  radarSite      = radarProductManager->radar_site();
+      p->frame_            = std::move(cachedFrame);
+      p->elevationScan_    = radarData;
+      p->momentDataBlock0_ = radarData0->moment_data_block(p->dataBlockType_);
+      p->latitude_         = radarSite->latitude();
+      p->longitude_        = radarSite->longitude();
+      p->range_            = p->frame_->range_;
+      p->sweepTime_        = p->frame_->sweepTime_;
+      p->vcp_              = p->frame_->vcp_;
+
+      UpdateColorTableLut();
+
+      Q_EMIT SweepComputed();
+      return;
+   }
 
    logger_->debug("Computing Sweep");
 
@@ -622,7 +766,10 @@ void Level2ProductView::ComputeSweep()
    vertexRadials =
       std::min<std::size_t>(vertexRadials, common::MAX_0_5_DEGREE_RADIALS);
 
-   p->ComputeCoordinates(radarData, smoothingEnabled);
+   if (!polarSweep)
+   {
+      p->ComputeCoordinates(radarData, smoothingEnabled);
+   }
 
    const std::vector<float>& coordinates = p->coordinates_;
 
@@ -654,17 +801,42 @@ void Level2ProductView::ComputeSweep()
    // Calculate vertices
    timer.start();
 
+   // Sweep output is written to a new frame, which may be retained by the frame
+   // cache after it has been computed
+   auto frame = std::make_shared<Impl::Frame>();
+
+   if (polarSweep)
+   {
+      // Data moments are copied in radial by gate order, and the renderer
+      // resolves azimuth and range without computing vertices
+      p->ComputePolarSweep(radarData, *frame, radials, vertexRadials, gates);
+
+      timer.stop();
+      logger_->debug("Polar sweep calculated in {}", timer.format(6, "%ws"));
+
+      p->StoreFrame(std::move(frame),
+                    radarData,
+                    smoothingEnabled,
+                    showSmoothedRangeFolding,
+                    frameCacheEnabled);
+
+      UpdateColorTableLut();
+
+      Q_EMIT SweepComputed();
+      return;
+   }
+
    // Setup vertex vector
-   std::vector<float>& vertices = p->vertices_;
+   std::vector<float>& vertices = frame->vertices_;
    size_t              vIndex   = 0;
    vertices.clear();
    vertices.resize(vertexRadials * gates * VERTICES_PER_BIN *
                    VALUES_PER_VERTEX);
 
    // Setup data moment vector
-   std::vector<uint8_t>&  dataMoments8  = p->dataMoments8_;
-   std::vector<uint16_t>& dataMoments16 = p->dataMoments16_;
-   std::vector<uint8_t>&  cfpMoments    = p->cfpMoments_;
+   std::vector<uint8_t>&  dataMoments8  = frame->dataMoments8_;
+   std::vector<uint16_t>& dataMoments16 = frame->dataMoments16_;
+   std::vector<uint8_t>&  cfpMoments    = frame->cfpMoments_;
    size_t                 mIndex        = 0;
 
    if (momentData0->data_word_size() == 8)
@@ -708,6 +880,34 @@ void Level2ProductView::ComputeSweep()
       p->ComputeEdgeValue();
    }
 
+   // Gate visibility and remapped data moments are computed a radial at a time
+   // by the data moment kernels. Smoothing requires these for the next radial
+   // as well.
+   std::vector<std::uint8_t>  gateMask(gates + 1);
+   std::vector<std::uint8_t>  nextGateMask {};
+   std::vector<std::uint8_t>  quadMask {};
+   std::vector<std::uint8_t>  remapped8 {};
+   std::vector<std::uint8_t>  nextRemapped8 {};
+   std::vector<std::uint16_t> remapped16 {};
+   std::vector<std::uint16_t> nextRemapped16 {};
+
+   if (smoothingEnabled)
+   {
+      nextGateMask.resize(gates + 1);
+      quadMask.resize(gates);
+
+      if (momentData0->data_word_size() == kDataWordSize8_)
+      {
+         remapped8.resize(gates);
+         nextRemapped8.resize(gates);
+      }
+      else
+      {
+         remapped16.resize(gates);
+         nextRemapped16.resize(gates);
+      }
+   }
+
    for (auto it = radarData->cbegin(); it != radarData->cend(); ++it)
    {
       const auto&   radialPair = *it;
@@ -816,6 +1016,89 @@ void Level2ProductView::ComputeSweep()
             static_cast<std::int32_t>(gates));
       }
 
+      const auto gateCount = static_cast<std::size_t>(numberOfDataMomentGates);
+      const auto nextGateCount =
+         static_cast<std::size_t>(numberOfNextDataMomentGates);
+
+      if (!smoothingEnabled)
+      {
+         // Range folded data moments are always shown when not smoothing
+         if (dataMomentsArray8 != nullptr)
+         {
+            util::MomentKernels::ThresholdMask(dataMomentsArray8,
+                                               gateCount,
+                                               snrThreshold,
+                                               true,
+                                               gateMask.data());
+         }
+         else
+         {
+            util::MomentKernels::ThresholdMask(dataMomentsArray16,
+                                               gateCount,
+                                               snrThreshold,
+                                               true,
+                                               gateMask.data());
+         }
+      }
+      else
+      {
+         const std::size_t quadCount =
+            std::max<std::size_t>(std::min(gateCount, nextGateCount), 1u) - 1u;
+
+         if (dataMomentsArray8 != nullptr)
+         {
+            const auto edgeValue = static_cast<std::uint8_t>(p->edgeValue_);
+
+            util::MomentKernels::ThresholdMask(dataMomentsArray8,
+                                               gateCount,
+                                               snrThreshold,
+                                               showSmoothedRangeFolding,
+                                               gateMask.data());
+            util::MomentKernels::ThresholdMask(nextDataMomentsArray8,
+                                               nextGateCount,
+                                               snrThreshold,
+                                               showSmoothedRangeFolding,
+                                               nextGateMask.data());
+            util::MomentKernels::Remap(dataMomentsArray8,
+                                       gateCount,
+                                       edgeValue,
+                                       showSmoothedRangeFolding,
+                                       remapped8.data());
+            util::MomentKernels::Remap(nextDataMomentsArray8,
+                                       nextGateCount,
+                                       edgeValue,
+                                       showSmoothedRangeFolding,
+                                       nextRemapped8.data());
+         }
+         else
+         {
+            util::MomentKernels::ThresholdMask(dataMomentsArray16,
+                                               gateCount,
+                                               snrThreshold,
+                                               showSmoothedRangeFolding,
+                                               gateMask.data());
+            util::MomentKernels::ThresholdMask(nextDataMomentsArray16,
+                                               nextGateCount,
+                                               snrThreshold,
+                                               showSmoothedRangeFolding,
+                                               nextGateMask.data());
+            util::MomentKernels::Remap(dataMomentsArray16,
+                                       gateCount,
+                                       p->edgeValue_,
+                                       showSmoothedRangeFolding,
+                                       remapped16.data());
+            util::MomentKernels::Remap(nextDataMomentsArray16,
+                                       nextGateCount,
+                                       p->edgeValue_,
+                                       showSmoothedRangeFolding,
+                                       nextRemapped16.data());
+         }
+
+         // A quad is hidden only if all of its data moments are hidden
+         util::MomentKernels::QuadMask(
+            gateMask.data(), nextGateMask.data(), quadCount, quadMask.data());
+      }
+
       for (std::int32_t gate = startGate, i = 0; gate + gateSize <= endGate;
            gate += gateSize, ++i)
       {
@@ -835,12 +1118,13 @@ void Level2ProductView::ComputeSweep()
          {
             if (!smoothingEnabled)
             {
-               const std::uint8_t& dataValue = dataMomentsArray8[i];
-               if (dataValue < snrThreshold && dataValue != RANGE_FOLDED)
+               if (!gateMask[i])
                {
                   continue;
                }
 
+               const std::uint8_t& dataValue = dataMomentsArray8[i];
+
                for (std::size_t m = 0; m < vertexCount; m++)
                {
                   dataMoments8[mIndex++] = dataValue;
@@ -860,33 +1144,24 @@ void Level2ProductView::ComputeSweep()
                   continue;
                }
 
-               const std::uint8_t& dm1 = dataMomentsArray8[i];
-               const std::uint8_t& dm2 = dataMomentsArray8[i + 1];
-               const std::uint8_t& dm3 = nextDataMomentsArray8[i];
-               const std::uint8_t& dm4 = nextDataMomentsArray8[i + 1];
-
-               if ((!showSmoothedRangeFolding && //
-                    (dm1 < snrThreshold || dm1 == RANGE_FOLDED) &&
-                    (dm2 < snrThreshold || dm2 == RANGE_FOLDED) &&
-                    (dm3 < snrThreshold || dm3 == RANGE_FOLDED) &&
-                    (dm4 < snrThreshold || dm4 == RANGE_FOLDED)) ||
-                   (showSmoothedRangeFolding && //
-                    dm1 < snrThreshold && dm1 != RANGE_FOLDED &&
-                    dm2 < snrThreshold && dm2 != RANGE_FOLDED &&
-                    dm3 < snrThreshold && dm3 != RANGE_FOLDED &&
-                    dm4 < snrThreshold && dm4 != RANGE_FOLDED))
+               if (!quadMask[i])
                {
                   // Skip only if all data moments are hidden
                   continue;
                }
 
+               const std::uint8_t dm1 = remapped8[i];
+               const std::uint8_t dm2 = remapped8[i + 1];
+               const std::uint8_t dm3 = nextRemapped8[i];
+               const std::uint8_t dm4 = nextRemapped8[i + 1];
+
                // The order must match the store vertices section below
-               dataMoments8[mIndex++] = p->RemapDataMoment(dm1);
-               dataMoments8[mIndex++] = p->RemapDataMoment(dm2);
-               dataMoments8[mIndex++] = p->RemapDataMoment(dm4);
-               dataMoments8[mIndex++] = p->RemapDataMoment(dm1);
-               dataMoments8[mIndex++] = p->RemapDataMoment(dm3);
-               dataMoments8[mIndex++] = p->RemapDataMoment(dm4);
+               dataMoments8[mIndex++] = dm1;
+               dataMoments8[mIndex++] = dm2;
+               dataMoments8[mIndex++] = dm4;
+               dataMoments8[mIndex++] = dm1;
+               dataMoments8[mIndex++] = dm3;
+               dataMoments8[mIndex++] = dm4;
 
                // cfpMoments is unused, so not populated here
             }
@@ -903,12 +1178,13 @@ void Level2ProductView::ComputeSweep()
          {
             if (!smoothingEnabled)
             {
-               const std::uint16_t& dataValue = dataMomentsArray16[i];
-               if (dataValue < snrThreshold && dataValue != RANGE_FOLDED)
+               if (!gateMask[i])
                {
                   continue;
                }
 
+               const std::uint16_t& dataValue = dataMomentsArray16[i];
+
                for (std::size_t m = 0; m < vertexCount; m++)
                {
                   dataMoments16[mIndex++] = dataValue;
@@ -923,33 +1199,24 @@ void Level2ProductView::ComputeSweep()
                   continue;
                }
 
-               const std::uint16_t& dm1 = dataMomentsArray16[i];
-               const std::uint16_t& dm2 = dataMomentsArray16[i + 1];
-               const std::uint16_t& dm3 = nextDataMomentsArray16[i];
-               const std::uint16_t& dm4 = nextDataMomentsArray16[i + 1];
-
-               if ((!showSmoothedRangeFolding && //
-                    (dm1 < snrThreshold || dm1 == RANGE_FOLDED) &&
-                    (dm2 < snrThreshold || dm2 == RANGE_FOLDED) &&
-                    (dm3 < snrThreshold || dm3 == RANGE_FOLDED) &&
-                    (dm4 < snrThreshold || dm4 == RANGE_FOLDED)) ||
-                   (showSmoothedRangeFolding && //
-                    dm1 < snrThreshold && dm1 != RANGE_FOLDED &&
-                    dm2 < snrThreshold && dm2 != RANGE_FOLDED &&
-                    dm3 < snrThreshold && dm3 != RANGE_FOLDED &&
-                    dm4 < snrThreshold && dm4 != RANGE_FOLDED))
+               if (!quadMask[i])
                {
                   // Skip only if all data moments are hidden
                   continue;
                }
 
+               const std::uint16_t dm1 = remapped16[i];
+               const std::uint16_t dm2 = remapped16[i + 1];
+               const std::uint16_t dm3 = nextRemapped16[i];
+               const std::uint16_t dm4 = nextRemapped16[i + 1];
+
                // The order must match the store vertices section below
-               dataMoments16[mIndex++] = p->RemapDataMoment(dm1);
-               dataMoments16[mIndex++] = p->RemapDataMoment(dm2);
-               dataMoments16[mIndex++] = p->RemapDataMoment(dm4);
-               dataMoments16[mIndex++] = p->RemapDataMoment(dm1);
-               dataMoments16[mIndex++] = p->RemapDataMoment(dm3);
-               dataMoments16[mIndex++] = p->RemapDataMoment(dm4);
+               dataMoments16[mIndex++] = dm1;
+               dataMoments16[mIndex++] = dm2;
+               dataMoments16[mIndex++] = dm4;
+               dataMoments16[mIndex++] = dm1;
+               dataMoments16[mIndex++] = dm3;
+               dataMoments16[mIndex++] = dm4;
 
                // cfpMoments is unused, so not populated here
             }
@@ -1057,6 +1324,12 @@ void Level2ProductView::ComputeSweep()
    timer.stop();
    logger_->debug("Vertices calculated in {}", timer.format(6, "%ws"));
 
+   p->StoreFrame(std::move(frame),
+                 radarData,
+                 smoothingEnabled,
+                 showSmoothedRangeFolding,
+                 frameCacheEnabled);
+
    UpdateColorTableLut();
 
    Q_EMIT SweepComputed();
@@ -1089,18 +1362,211 @@ void Level2ProductView::Impl::ComputeEdgeValue()
    }
 }
 
-template<typename T>
-T Level2ProductView::Impl::RemapDataMoment(T dataMoment) const
+void Level2ProductView::Impl::ComputePolarSweep(
+   const std::shared_ptr<wsr88d::rda::ElevationScan>& radarData,
+   Frame&                                             frame,
+   std::size_t                                        radials,
+   std::size_t                                        vertexRadials,
+   std::uint32_t                                      gates)
 {
-   if (dataMoment != 0 &&
-       (dataMoment != RANGE_FOLDED || showSmoothedRangeFolding_))
+   constexpr float kFullCircle_ = 360.0f;
+
+   auto&      radarData0  = (*radarData)[0];
+   auto       momentData0 = radarData0->moment_data_block(dataBlockType_);
+   const bool wordSize8   = momentData0->data_word_size() == kDataWordSize8_;
+
+   frame.polar_   = true;
+   frame.radials_ = radials;
+   frame.gates_   = gates;
+
+   if (wordSize8)
    {
-      return dataMoment;
+      frame.dataMoments8_.assign(radials * gates, 0u);
    }
    else
    {
-      return edgeValue_;
+      frame.dataMoments16_.assign(radials * gates, 0u);
+   }
+
+   // Copy data moments, leaving missing radials and gates below threshold
+   for (const auto& [radial, radialData] : *radarData)
+   {
+      const auto momentData = radialData->moment_data_block(dataBlockType_);
+
+      if (radial >= radials || momentData == nullptr ||
+          momentData->data_word_size() != momentData0->data_word_size())
+      {
+         continue;
+      }
+
+      const std::size_t gateCount = std::min<std::size_t>(
+         momentData->number_of_data_moment_gates(), gates);
+      const std::size_t offset = static_cast<std::size_t>(radial) * gates;
+
+      if (wordSize8)
+      {
+         std::copy_n(
+            static_cast<const std::uint8_t*>(momentData->data_moments()),
+            gateCount,
+            frame.dataMoments8_.begin() + static_cast<std::ptrdiff_t>(offset));
+      }
+      else
+      {
+         std::copy_n(
+            static_cast<const std::uint16_t*>(momentData->data_moments()),
+            gateCount,
+            frame.dataMoments16_.begin() + static_cast<std::ptrdiff_t>(offset));
+      }
+   }
+
+   // Radial start azimuths, relative to the first radial. The start of the
+   // extra vertex radial, or a full circle for a complete scan, ends the last
+   // radial.
+   const auto numRadials = static_cast<std::uint16_t>(vertexRadials);
+   const auto firstAngle =
+      GetRadialAngle(radarData, 0u, numRadials, false)
+         .value_or(units::degrees<float> {0.0f});
+
+   std::vector<float>& radialAzimuths = frame.radialAzimuths_;
+   radialAzimuths.resize(radials + 1);
+   radialAzimuths[0] = 0.0f;
+
+   units::degrees<float> previousAngle = firstAngle;
+   for (std::size_t radial = 1; radial < radials + 1; ++radial)
+   {
+      float azimuth = radialAzimuths[radial - 1];
+
+      if (radial == vertexRadials)
+      {
+         azimuth = kFullCircle_;
+      }
+      else if (auto angle = GetRadialAngle(radarData,
+                                           static_cast<std::uint32_t>(radial),
+                                           numRadials,
+                                           false);
+               angle.has_value())
+      {
+         // Accumulate angle deltas, so that azimuths are always increasing
+         const float deltaAngle =
+            NormalizeAngle(*angle - previousAngle).value();
+         azimuth += std::max(0.0f, deltaAngle);
+         previousAngle = *angle;
+      }
+
+      radialAzimuths[radial] = azimuth;
    }
+
+   // Gate geometry is taken from the first radial, matching the vertex sweep
+   const auto gateInterval = static_cast<float>(
+      momentData0->data_moment_range_sample_interval_raw());
+   const float gateIntervalH = gateInterval * 0.5f;
+   const float gateRange     = std::max(
+      static_cast<float>(momentData0->data_moment_range_raw()), gateIntervalH);
+
+   frame.azimuthOffset_ = firstAngle.value();
+   frame.gateRange_     = gateRange - gateIntervalH;
+   frame.gateInterval_  = gateInterval;
+   frame.snrThreshold_  = static_cast<std::uint16_t>(
+      std::max<std::int16_t>(2, momentData0->snr_threshold_raw()));
+}
+
+std::shared_ptr<const Level2ProductView::Impl::Frame>
+Level2ProductView::Impl::FindCachedFrame(
+   const std::shared_ptr<wsr88d::rda::ElevationScan>& radarData,
+   bool                                               smoothingEnabled,
+   bool                                               showSmoothedRangeFolding,
+   bool                                               polar)
+{
+   std::shared_ptr<const Frame> frame {};
+
+   for (auto it = cachedFrames_.begin(); it != cachedFrames_.end();)
+   {
+      const auto& cachedFrame   = *it;
+      const auto  elevationScan = cachedFrame->elevationScan_.lock();
+
+      if (elevationScan == nullptr)
+      {
+         // The radar data is no longer loaded, and will not be requested again
+         cachedFramesSize_ -= cachedFrame->memory_usage();
+         it = cachedFrames_.erase(it);
+         continue;
+      }
+
+      if (frame == nullptr && elevationScan == radarData &&
+          cachedFrame->dataBlockType_ == dataBlockType_ &&
+          cachedFrame->smoothingEnabled_ == smoothingEnabled &&
+          cachedFrame->polar_ == polar &&
+          (cachedFrame->showSmoothedRangeFolding_ == showSmoothedRangeFolding ||
+           !smoothingEnabled))
+      {
+         // Move the frame to the front of the cache
+         frame = cachedFrame;
+         it    = cachedFrames_.erase(it);
+         continue;
+      }
+
+      ++it;
+   }
+
+   if (frame != nullptr)
+   {
+      cachedFrames_.push_front(frame);
+   }
+
+   return frame;
+}
+
+void Level2ProductView::Impl::CacheFrame(
+   const std::shared_ptr<const Frame>& frame)
+{
+   cachedFrames_.push_front(frame);
+   cachedFramesSize_ += frame->memory_usage();
+
+   // Evict least recently used frames, always retaining the newest frame
+   while (cachedFramesSize_ > kFrameCacheSize_ && cachedFrames_.size() > 1)
+   {
+      cachedFramesSize_ -= cachedFrames_.back()->memory_usage();
+      cachedFrames_.pop_back();
+   }
+}
+
+void Level2ProductView::Impl::StoreFrame(
+   std::shared_ptr<Frame>                             frame,
+   const std::shared_ptr<wsr88d::rda::ElevationScan>& radarData,
+   bool                                               smoothingEnabled,
+   bool                                               showSmoothedRangeFolding,
+   bool                                               frameCacheEnabled)
+{
+   frame->elevationScan_            = radarData;
+   frame->dataBlockType_            = dataBlockType_;
+   frame->smoothingEnabled_         = smoothingEnabled;
+   frame->showSmoothedRangeFolding_ = showSmoothedRangeFolding;
+   frame->range_                    = range_;
+   frame->vcp_                      = vcp_;
+   frame->sweepTime_                = sweepTime_;
+
+   if (frameCacheEnabled)
+   {
+      frame->id_ = nextFrameId_++;
+      CacheFrame(frame);
+   }
+
+   frame_ = std::move(frame);
+}
+
+void Level2ProductView::Impl::ClearFrameCache()
+{
+   cachedFrames_.clear();
+   cachedFramesSize_ = 0u;
+}
+
+std::size_t Level2ProductView::Impl::Frame::memory_usage() const
+{
+   return vertices_.size() * sizeof(float) +
+          dataMoments8_.size() * sizeof(std::uint8_t) +
+          dataMoments16_.size() * sizeof(std::uint16_t) +
+          cfpMoments_.size() * sizeof(std::uint8_t) +
+          radialAzimuths_.size() * sizeof(float);
 }
 
 void Level2ProductView::Impl::ComputeCoordinates(
@@ -1111,14 +1577,17 @@ void Level2ProductView::Impl::ComputeCoordinates(
 
    boost::timer::cpu_timer timer;
 
-   const GeographicLib::Geodesic& geodesic(
-      util::GeographicLib::DefaultGeodesic());
+   auto radarProductManager = self_->radar_product_manager();
 
-   auto         radarProductManager = self_->radar_product_manager();
-   auto         radarSite           = radarProductManager->radar_site();
-   const float  gateSize            = radarProductManager->gate_size();
-   const double radarLatitude       = radarSite->latitude();
-   const double radarLongitude      = radarSite->longitude();
+   // Radials are interpolated from the radar site's shared coordinate table,
+   // rather than solving the geodesic for each gate
+   auto coordinateTable = radarProductManager->coordinate_table(
+      common::RadialSize::_0_5Degree, smoothingEnabled);
+   if (coordinateTable == nullptr)
+   {
+      logger_->warn("Coordinate table not available");
+      return;
+   }
 
    // Calculate azimuth coordinates
    timer.start();
@@ -1128,9 +1597,10 @@ void Level2ProductView::Impl::ComputeCoordinates(
 
    std::uint16_t numRadials =
       static_cast<std::uint16_t>(radarData->crbegin()->first + 1);
-   const std::uint16_t numRangeBins =
+   const std::size_t numRangeBins = std::min<std::size_t>(
       std::max(momentData0->number_of_data_moment_gates() + 1u,
-               common::MAX_DATA_MOMENT_GATES);
+               common::MAX_DATA_MOMENT_GATES),
+      coordinateTable->gate_count());
 
    // Add an extra radial when incomplete data exists
    if (IsRadarDataIncomplete(radarData))
@@ -1143,15 +1613,6 @@ void Level2ProductView::Impl::ComputeCoordinates(
       std::min<std::uint16_t>(numRadials, common::MAX_0_5_DEGREE_RADIALS);
 
    auto radials = boost::irange<std::uint32_t>(0u, numRadials);
-   auto gates   = boost::irange<std::uint32_t>(0u, numRangeBins);
-
-   const float gateRangeOffset = (smoothingEnabled) ?
-                                    // Center of the first gate is half the gate
-                                    // size distance from the radar site
-                                    0.5f :
-                                    // Far end of the first gate is the gate
-                                    // size distance from the radar site
-                                    1.0f;
 
    std::for_each(
       std::execution::par_unseq,
@@ -1159,132 +1620,124 @@ void Level2ProductView::Impl::ComputeCoordinates(
       radials.end(),
       [&](std::uint32_t radial)
       {
-         units::degrees<float> angle {};
-
-         auto radialData = radarData->find(radial);
-         if (radialData != radarData->cend() && smoothingEnabled)
+         const std::optional<units::degrees<float>> angle =
+            GetRadialAngle(radarData, radial, numRadials, smoothingEnabled);
+         if (!angle.has_value())
          {
-            angle = radialData->second->azimuth_angle();
+            // Not enough angles present to determine an angle
+            return;
          }
-         else
-         {
-            auto prevRadial1 = radarData->find(
-               (radial >= 1) ? radial - 1 : numRadials - (1 - radial));
-            auto prevRadial2 = radarData->find(
-               (radial >= 2) ? radial - 2 : numRadials - (2 - radial));
 
-            if (radialData != radarData->cend() &&
-                prevRadial1 != radarData->cend() && !smoothingEnabled)
-            {
-               const units::degrees<float> currentAngle =
-                  radialData->second->azimuth_angle();
-               const units::degrees<float> prevAngle =
-                  prevRadial1->second->azimuth_angle();
+         const std::size_t offset = static_cast<std::size_t>(radial) *
+                                    common::MAX_DATA_MOMENT_GATES * 2;
 
-               // Calculate delta angle
-               const units::degrees<float> deltaAngle =
-                  NormalizeAngle(currentAngle - prevAngle);
+         coordinateTable->GetRadial(
+            angle->value(), numRangeBins, &coordinates_[offset]);
+      });
+   timer.stop();
+   logger_->debug("Coordinates calculated in {}", timer.format(6, "%ws"));
+}
 
-               // Delta scale is half the delta angle to reach the end of the
-               // bin, because smoothing is not enabled
-               constexpr float deltaScale = 0.5f;
+std::optional<units::degrees<float>> Level2ProductView::Impl::GetRadialAngle(
+   const std::shared_ptr<wsr88d::rda::ElevationScan>& radarData,
+   std::uint32_t                                      radial,
+   std::uint16_t                                      numRadials,
+   bool                                               smoothingEnabled)
+{
+   auto radialData = radarData->find(radial);
+   if (radialData != radarData->cend() && smoothingEnabled)
+   {
+      return radialData->second->azimuth_angle();
+   }
+   else
+   {
+      auto prevRadial1 = radarData->find(
+         (radial >= 1) ? radial - 1 : numRadials - (1 - radial));
+      auto prevRadial2 = radarData->find(
+         (radial >= 2) ? radial - 2 : numRadials - (2 - radial));
 
-               angle = currentAngle - deltaAngle * deltaScale;
-            }
-            else if (radialData != radarData->cend() && !smoothingEnabled)
-            {
-               const units::degrees<float> currentAngle =
-                  radialData->second->azimuth_angle();
+      if (radialData != radarData->cend() &&
+          prevRadial1 != radarData->cend() && !smoothingEnabled)
+      {
+         const units::degrees<float> currentAngle =
+            radialData->second->azimuth_angle();
+         const units::degrees<float> prevAngle =
+            prevRadial1->second->azimuth_angle();
 
-               // Assume a half degree delta if there aren't enough angles
-               // to determine a delta angle
-               constexpr units::degrees<float> deltaAngle {0.5f};
+         // Calculate delta angle
+         const units::degrees<float> deltaAngle =
+            NormalizeAngle(currentAngle - prevAngle);
 
-               // Delta scale is half the delta angle to reach the edge of the
-               // bin, because smoothing is enabled
-               constexpr float deltaScale = 0.5f;
+         // Delta scale is half the delta angle to reach the end of the
+         // bin, because smoothing is not enabled
+         constexpr float deltaScale = 0.5f;
 
-               angle = currentAngle - deltaAngle * deltaScale;
-            }
-            else if (prevRadial1 != radarData->cend() &&
-                     prevRadial2 != radarData->cend())
-            {
-               const units::degrees<float> prevAngle1 =
-                  prevRadial1->second->azimuth_angle();
-               const units::degrees<float> prevAngle2 =
-                  prevRadial2->second->azimuth_angle();
+         return currentAngle - deltaAngle * deltaScale;
+      }
+      else if (radialData != radarData->cend() && !smoothingEnabled)
+      {
+         const units::degrees<float> currentAngle =
+            radialData->second->azimuth_angle();
 
-               // Calculate delta angle
-               const units::degrees<float> deltaAngle =
-                  NormalizeAngle(prevAngle1 - prevAngle2);
-
-               const float deltaScale =
-                  (smoothingEnabled) ?
-                     // Delta scale is 1.0x the delta angle to reach the center
-                     // of the next bin, because smoothing is enabled
-                     1.0f :
-                     // Delta scale is 0.5x the delta angle to reach the edge of
-                     // the next bin
-                     0.5f;
-
-               angle = prevAngle1 + deltaAngle * deltaScale;
-            }
-            else if (prevRadial1 != radarData->cend())
-            {
-               const units::degrees<float> prevAngle1 =
-                  prevRadial1->second->azimuth_angle();
-
-               // Assume a half degree delta if there aren't enough angles
-               // to determine a delta angle
-               constexpr units::degrees<float> deltaAngle {0.5f};
-
-               const float deltaScale =
-                  (smoothingEnabled) ?
-                     // Delta scale is 1.0x the delta angle to reach the center
-                     // of the next bin, because smoothing is enabled
-                     1.0f :
-                     // Delta scale is 0.5x the delta angle to reach the edge of
-                     // the next bin
-                     0.5f;
-
-               angle = prevAngle1 + deltaAngle * deltaScale;
-            }
-            else
-            {
-               // Not enough angles present to determine an angle
-               return;
-            }
-         }
+         // Assume a half degree delta if there aren't enough angles
+         // to determine a delta angle
+         constexpr units::degrees<float> deltaAngle {0.5f};
 
-         std::for_each(
-            std::execution::par_unseq,
-            gates.begin(),
-            gates.end(),
-            [&](std::uint32_t gate)
-            {
-               const std::uint32_t radialGate =
-                  radial * common::MAX_DATA_MOMENT_GATES + gate;
-               const float range =
-                  (static_cast<float>(gate) + gateRangeOffset) * gateSize;
-               const std::size_t offset =
-                  static_cast<std::size_t>(radialGate) * 2;
-
-               double latitude  = 0.0;
-               double longitude = 0.0;
-
-               geodesic.Direct(radarLatitude,
-                               radarLongitude,
-                               angle.value(),
-                               range,
-                               latitude,
-                               longitude);
-
-               coordinates_[offset]     = static_cast<float>(latitude);
-               coordinates_[offset + 1] = static_cast<float>(longitude);
-            });
-      });
-   timer.stop();
-   logger_->debug("Coordinates calculated in {}", timer.format(6, "%ws"));
+         // Delta scale is half the delta angle to reach the edge of the
+         // bin, because smoothing is enabled
+         constexpr float deltaScale = 0.5f;
+
+         return currentAngle - deltaAngle * deltaScale;
+      }
+      else if (prevRadial1 != radarData->cend() &&
+               prevRadial2 != radarData->cend())
+      {
+         const units::degrees<float> prevAngle1 =
+            prevRadial1->second->azimuth_angle();
+         const units::degrees<float> prevAngle2 =
+            prevRadial2->second->azimuth_angle();
+
+         // Calculate delta angle
+         const units::degrees<float> deltaAngle =
+            NormalizeAngle(prevAngle1 - prevAngle2);
+
+         const float deltaScale =
+            (smoothingEnabled) ?
+               // Delta scale is 1.0x the delta angle to reach the center
+               // of the next bin, because smoothing is enabled
+               1.0f :
+               // Delta scale is 0.5x the delta angle to reach the edge of
+               // the next bin
+               0.5f;
+
+         return prevAngle1 + deltaAngle * deltaScale;
+      }
+      else if (prevRadial1 != radarData->cend())
+      {
+         const units::degrees<float> prevAngle1 =
+            prevRadial1->second->azimuth_angle();
+
+         // Assume a half degree delta if there aren't enough angles
+         // to determine a delta angle
+         constexpr units::degrees<float> deltaAngle {0.5f};
+
+         const float deltaScale =
+            (smoothingEnabled) ?
+               // Delta scale is 1.0x the delta angle to reach the center
+               // of the next bin, because smoothing is enabled
+               1.0f :
+               // Delta scale is 0.5x the delta angle to reach the edge of
+               // the next bin
+               0.5f;
+
+         return prevAngle1 + deltaAngle * deltaScale;
+      }
+      else
+      {
+         // Not enough angles present to determine an angle
+         return std::nullopt;
+      }
+   }
 }
 
 bool Level2ProductView::Impl::IsRadarDataIncomplete(
@@ -40,6 +40,7 @@ public:
    [[nodiscard]] std::string               units() const override;
    [[nodiscard]] std::uint16_t             vcp() const override;
    [[nodiscard]] const std::vector<float>& vertices() const override;
+   [[nodiscard]] std::uint64_t             frame_id() const override;
 
    void LoadColorTable(std::shared_ptr<common::ColorTable> colorTable) override;
    void SelectElevation(float elevation) override;
@@ -53,6 +54,7 @@ public:
    GetMomentData() const override;
    [[nodiscard]] std::tuple<const void*, std::size_t, std::size_t>
    GetCfpMomentData() const override;
+   [[nodiscard]] std::optional<PolarSweep> GetPolarSweep() const override;
 
    [[nodiscard]] std::optional<std::uint16_t>
    GetBinLevel(const common::Coordinate& coordinate) const override;
@@ -1,5 +1,6 @@
 #include <scwx/qt/view/level3_radial_view.hpp>
 #include <scwx/qt/util/geographic_lib.hpp>
+#include <scwx/qt/util/polar_coordinate_table.hpp>
 #include <scwx/common/constants.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/util/threads.hpp>
@@ -548,13 +549,8 @@ void Level3RadialView::Impl::ComputeCoordinates(
 
    boost::timer::cpu_timer timer;
 
-   const GeographicLib::Geodesic& geodesic(
-      util::GeographicLib::DefaultGeodesic());
-
-   auto         radarProductManager = self_->radar_product_manager();
-   auto         radarSite           = radarProductManager->radar_site();
-   const double radarLatitude       = radarSite->latitude();
-   const double radarLongitude      = radarSite->longitude();
+   auto radarProductManager = self_->radar_product_manager();
+   auto radarSite           = radarProductManager->radar_site();
 
    // Calculate azimuth coordinates
    timer.start();
@@ -564,8 +560,9 @@ void Level3RadialView::Impl::ComputeCoordinates(
    const std::uint16_t numRadials   = radialData->number_of_radials();
    const std::uint16_t numRangeBins = radialData->number_of_range_bins();
 
-   auto radials = boost::irange<std::uint32_t>(0u, numRadials);
-   auto gates   = boost::irange<std::uint32_t>(0u, numRangeBins);
+   auto radials = boost::irange<std::uint32_t>(
+      0u,
+      std::min<std::uint32_t>(numRadials, common::MAX_0_5_DEGREE_RADIALS));
 
    const float gateRangeOffset = (smoothingEnabled) ?
                                     // Center of the first gate is half the gate
@@ -575,6 +572,20 @@ void Level3RadialView::Impl::ComputeCoordinates(
                                     // size distance from the radar site
                                     1.0f;
 
+   // Radials are interpolated from a shared coordinate table for this gate
+   // size, rather than solving the geodesic for each gate
+   // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers): Values are given
+   // descriptions
+   auto coordinateTable = util::PolarCoordinateTable::Get(
+      {.latitude_        = radarSite->latitude(),
+       .longitude_       = radarSite->longitude(),
+       .gateSize_        = gateSize,
+       .gateRangeOffset_ = gateRangeOffset,
+       .radialAngle_     = 0.5f, // Radial angle
+       .angleOffset_     = 0.0f  // Angle offset
+      });
+   // NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
+
    std::for_each(
       std::execution::par_unseq,
       radials.begin(),
@@ -589,35 +600,10 @@ void Level3RadialView::Impl::ComputeCoordinates(
             angle += radialData->delta_angle(radial) * kDeltaAngleFactor;
          }
 
-         std::for_each(
-            std::execution::par_unseq,
-            gates.begin(),
-            gates.end(),
-            [&](std::uint32_t gate)
-            {
-               const std::uint32_t radialGate =
-                  radial * common::MAX_DATA_MOMENT_GATES + gate;
-               const float range =
-                  (static_cast<float>(gate) + gateRangeOffset) * gateSize;
-               const std::size_t offset = static_cast<size_t>(radialGate) * 2;
-               if (offset + 1 >= coordinates_.size())
-               {
-                  return;
-               }
-
-               double latitude  = 0.0;
-               double longitude = 0.0;
-
-               geodesic.Direct(radarLatitude,
-                               radarLongitude,
-                               angle,
-                               range,
-                               latitude,
-                               longitude);
-
-               coordinates_[offset]     = static_cast<float>(latitude);
-               coordinates_[offset + 1] = static_cast<float>(longitude);
-            });
+         const std::size_t offset = static_cast<std::size_t>(radial) *
+                                    common::MAX_DATA_MOMENT_GATES * 2;
+
+         coordinateTable->GetRadial(angle, numRangeBins, &coordinates_[offset]);
       });
    timer.stop();
    logger_->debug("Coordinates calculated in {}", timer.format(6, "%ws"));
@@ -728,8 +714,10 @@ Level3RadialView::GetBinLevel(const common::Coordinate& coordinate) const
    }
 
    // Compute threshold at which to display an individual bin
+   // Each radial contains number_of_range_bins() levels, so the gate is in
+   // range
    const std::uint16_t snrThreshold = descriptionBlock->threshold();
-   const std::uint8_t  level        = radialData->level(*radial).at(gate);
+   const std::uint8_t  level        = radialData->level(*radial)[gate];
 
    if (level < snrThreshold && level != RANGE_FOLDED)
    {
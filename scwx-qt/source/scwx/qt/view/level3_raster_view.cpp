@@ -6,6 +6,8 @@
 #include <scwx/util/time.hpp>
 #include <scwx/wsr88d/rpg/raster_data_packet.hpp>
 
+#include <optional>
+
 #include <boost/range/irange.hpp>
 #include <boost/timer/timer.hpp>
 #include <units/angle.h>
@@ -23,6 +25,22 @@ static constexpr uint32_t VALUES_PER_VERTEX = 2u;
 class Level3RasterViewImpl
 {
 public:
+   struct CoordinateParameters
+   {
+      float         latitude_ {};
+      float         longitude_ {};
+      float         range_ {};
+      std::uint16_t xResolution_ {};
+      std::uint16_t yResolution_ {};
+      std::int16_t  iCoordinateStart_ {};
+      std::int16_t  jCoordinateStart_ {};
+      std::size_t   rows_ {};
+      std::size_t   columns_ {};
+      bool          smoothingEnabled_ {};
+
+      bool operator==(const CoordinateParameters&) const = default;
+   };
+
    explicit Level3RasterViewImpl() :
        latitude_ {}, longitude_ {}, range_ {}, vcp_ {}, sweepTime_ {}
    {
@@ -34,6 +52,11 @@ public:
 
    boost::asio::thread_pool threadPool_ {1u};
 
+   // The raster grid is the same for each volume scan of a product, so the
+   // coordinates are retained and only recalculated when the grid changes
+   std::optional<CoordinateParameters> coordinateParameters_ {};
+   std::vector<float>                  coordinates_ {};
+
    std::vector<float>        vertices_ {};
    std::vector<std::uint8_t> dataMoments8_ {};
    std::uint8_t              edgeValue_ {};
@@ -247,60 +270,79 @@ void Level3RasterView::ComputeSweep()
                             descriptionBlock->volume_scan_start_time() * 1000);
    p->vcp_ = descriptionBlock->volume_coverage_pattern();
 
-   const GeographicLib::Geodesic& geodesic =
-      util::GeographicLib::DefaultGeodesic();
-
    const std::uint16_t xResolution = descriptionBlock->x_resolution_raw();
    const std::uint16_t yResolution = descriptionBlock->y_resolution_raw();
-   const double        iCoordinate =
-      (-rasterData->i_coordinate_start() - 1.0 - p->range_) * 1000.0;
-   const double jCoordinate =
-      (rasterData->j_coordinate_start() + 1.0 + p->range_) * 1000.0;
-   const double xOffset = (smoothingEnabled) ? xResolution * 0.5 : 0.0;
-   const double yOffset = (smoothingEnabled) ? yResolution * 0.5 : 0.0;
-
-   const std::size_t numCoordinates =
-      static_cast<size_t>(rows + 1) * static_cast<size_t>(maxColumns + 1);
-   const auto coordinateRange =
-      boost::irange<uint32_t>(0, static_cast<uint32_t>(numCoordinates));
 
-   std::vector<float> coordinates;
-   coordinates.resize(numCoordinates * 2);
+   const Level3RasterViewImpl::CoordinateParameters coordinateParameters {
+      .latitude_         = p->latitude_,
+      .longitude_        = p->longitude_,
+      .range_            = p->range_,
+      .xResolution_      = xResolution,
+      .yResolution_      = yResolution,
+      .iCoordinateStart_ = rasterData->i_coordinate_start(),
+      .jCoordinateStart_ = rasterData->j_coordinate_start(),
+      .rows_             = rows,
+      .columns_          = maxColumns,
+      .smoothingEnabled_ = smoothingEnabled};
+
+   std::vector<float>& coordinates = p->coordinates_;
+
+   if (p->coordinateParameters_ != coordinateParameters)
+   {
+      const GeographicLib::Geodesic& geodesic =
+         util::GeographicLib::DefaultGeodesic();
+
+      const double iCoordinate =
+         (-rasterData->i_coordinate_start() - 1.0 - p->range_) * 1000.0;
+      const double jCoordinate =
+         (rasterData->j_coordinate_start() + 1.0 + p->range_) * 1000.0;
+      const double xOffset = (smoothingEnabled) ? xResolution * 0.5 : 0.0;
+      const double yOffset = (smoothingEnabled) ? yResolution * 0.5 : 0.0;
+
+      const std::size_t numCoordinates =
+         static_cast<size_t>(rows + 1) * static_cast<size_t>(maxColumns + 1);
+      const auto coordinateRange =
+         boost::irange<uint32_t>(0, static_cast<uint32_t>(numCoordinates));
+
+      coordinates.resize(numCoordinates * 2);
+
+      // Calculate coordinates
+      timer.start();
+
+      std::for_each(
+         std::execution::par_unseq,
+         coordinateRange.begin(),
+         coordinateRange.end(),
+         [&](uint32_t index)
+         {
+            // For each row or column, there is one additional coordinate. Each
+            // bin is bounded by 4 coordinates.
+            const uint32_t col = index % (rows + 1);
+            const uint32_t row = index / (rows + 1);
 
-   // Calculate coordinates
-   timer.start();
+            const double i = iCoordinate + xResolution * col + xOffset;
+            const double j = jCoordinate - yResolution * row - yOffset;
 
-   std::for_each(
-      std::execution::par_unseq,
-      coordinateRange.begin(),
-      coordinateRange.end(),
-      [&](uint32_t index)
-      {
-         // For each row or column, there is one additional coordinate. Each bin
-         // is bounded by 4 coordinates.
-         const uint32_t col = index % (rows + 1);
-         const uint32_t row = index / (rows + 1);
+            // Calculate polar coordinates based on i and j
+            const double angle  = std::atan2(i, j) * 180.0 / M_PI;
+            const double range  = std::sqrt(i * i + j * j);
+            const size_t offset = static_cast<size_t>(index) * 2;
 
-         const double i = iCoordinate + xResolution * col + xOffset;
-         const double j = jCoordinate - yResolution * row - yOffset;
+            double latitude;
+            double longitude;
 
-         // Calculate polar coordinates based on i and j
-         const double angle  = std::atan2(i, j) * 180.0 / M_PI;
-         const double range  = std::sqrt(i * i + j * j);
-         const size_t offset = static_cast<size_t>(index) * 2;
+            geodesic.Direct(
+               p->latitude_, p->longitude_, angle, range, latitude, longitude);
 
-         double latitude;
-         double longitude;
+            coordinates[offset]     = latitude;
+            coordinates[offset + 1] = longitude;
+         });
 
-         geodesic.Direct(
-            p->latitude_, p->longitude_, angle, range, latitude, longitude);
+      timer.stop();
+      logger_->debug("Coordinates calculated in {}", timer.format(6, "%ws"));
 
-         coordinates[offset]     = latitude;
-         coordinates[offset + 1] = longitude;
-      });
-
-   timer.stop();
-   logger_->debug("Coordinates calculated in {}", timer.format(6, "%ws"));
+      p->coordinateParameters_ = coordinateParameters;
+   }
 
    // Calculate vertices
    timer.start();
@@ -522,7 +564,8 @@ Level3RasterView::GetBinLevel(const common::Coordinate& coordinate) const
       return std::nullopt;
    }
 
-   auto& momentData = rasterData->level(static_cast<std::uint16_t>(row));
+   const auto momentData =
+      rasterData->level(static_cast<std::uint16_t>(row));
 
    if (col > momentData.size())
    {
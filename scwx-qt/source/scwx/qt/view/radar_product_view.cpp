@@ -3,6 +3,8 @@
 #include <scwx/common/constants.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <atomic>
+
 #include <boost/asio.hpp>
 #include <boost/range/irange.hpp>
 #include <boost/timer/timer.hpp>
@@ -38,12 +40,22 @@ public:
        radarProductManager_ {radarProductManager}
    {
       auto& productSettings = settings::ProductSettings::Instance();
-      connection_           = productSettings.changed_signal().connect(
+
+      frameCacheEnabled_   = productSettings.frame_cache_enabled().GetValue();
+      polarTextureEnabled_ = productSettings.polar_texture_enabled().GetValue();
+
+      connection_ = productSettings.changed_signal().connect(
          [this]()
          {
             showSmoothedRangeFolding_ = settings::ProductSettings::Instance()
                                            .show_smoothed_range_folding()
                                            .GetValue();
+            frameCacheEnabled_ = settings::ProductSettings::Instance()
+                                    .frame_cache_enabled()
+                                    .GetValue();
+            polarTextureEnabled_ = settings::ProductSettings::Instance()
+                                      .polar_texture_enabled()
+                                      .GetValue();
             self_->Update();
          });
       ;
@@ -56,6 +68,8 @@ public:
    std::mutex sweepMutex_;
 
    std::chrono::system_clock::time_point selectedTime_;
+   std::atomic<bool>                     frameCacheEnabled_ {false};
+   std::atomic<bool>                     polarTextureEnabled_ {false};
    bool                                  showSmoothedRangeFolding_ {false};
    bool                                  smoothingEnabled_ {false};
    types::RadarProductLoadStatus         loadStatus_ {
@@ -97,12 +111,27 @@ types::RadarProductLoadStatus RadarProductView::load_status() const
    return p->loadStatus_;
 }
 
+bool RadarProductView::polar_texture_enabled() const
+{
+   return p->polarTextureEnabled_;
+}
+
 std::shared_ptr<manager::RadarProductManager>
 RadarProductView::radar_product_manager() const
 {
    return p->radarProductManager_;
 }
 
+bool RadarProductView::frame_cache_enabled() const
+{
+   return p->frameCacheEnabled_;
+}
+
+std::uint64_t RadarProductView::frame_id() const
+{
+   return 0u;
+}
+
 float RadarProductView::range() const
 {
    return 0.0f;
@@ -201,6 +230,12 @@ RadarProductView::GetCfpMomentData() const
    return std::tie(data, dataSize, componentSize);
 }
 
+std::optional<RadarProductView::PolarSweep>
+RadarProductView::GetPolarSweep() const
+{
+   return std::nullopt;
+}
+
 bool RadarProductView::IgnoreUnits() const
 {
    return false;
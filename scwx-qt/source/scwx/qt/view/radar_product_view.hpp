@@ -11,6 +11,7 @@
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <span>
 #include <vector>
 
 #include <QObject>
@@ -26,6 +27,29 @@ class RadarProductView : public QObject
    Q_OBJECT
 
 public:
+   /**
+    * Data moments of a sweep in radial by gate order, for rendering without
+    * computing geometry for each gate.
+    */
+   struct PolarSweep
+   {
+      // Data moments, indexed by radial * gates_ + gate
+      const void* moments_ {nullptr};
+      std::size_t componentSize_ {1u};
+      std::size_t radials_ {0u};
+      std::size_t gates_ {0u};
+
+      // Start azimuth of each radial relative to the first radial, followed by
+      // the end azimuth of the last radial (degrees)
+      std::span<const float> radialAzimuths_ {};
+      float                  azimuthOffset_ {0.0f}; // First radial (degrees)
+
+      float gateRange_ {0.0f};    // Range to the start of the first gate (m)
+      float gateInterval_ {0.0f}; // Distance between gates (m)
+
+      std::uint16_t snrThreshold_ {0u};
+   };
+
    explicit RadarProductView(
       std::shared_ptr<manager::RadarProductManager> radarProductManager);
    ~RadarProductView() override;
@@ -42,6 +66,7 @@ public:
    [[nodiscard]] virtual std::uint16_t         color_table_min() const;
    [[nodiscard]] virtual std::uint16_t         color_table_max() const;
    [[nodiscard]] virtual std::optional<float>  elevation() const;
+   [[nodiscard]] bool                          frame_cache_enabled() const;
    [[nodiscard]] types::RadarProductLoadStatus load_status() const;
    [[nodiscard]] virtual float                 range() const;
    [[nodiscard]] virtual std::chrono::system_clock::time_point
@@ -51,6 +76,16 @@ public:
    [[nodiscard]] virtual std::uint16_t             vcp() const        = 0;
    [[nodiscard]] virtual const std::vector<float>& vertices() const   = 0;
 
+   /**
+    * Identifies the computed sweep while it is held in the frame cache. A
+    * renderer may retain its buffers for a cached sweep, and reuse them when
+    * the same frame identifier is presented again.
+    *
+    * @return Frame identifier, or 0 if the sweep is not cached
+    */
+   [[nodiscard]] virtual std::uint64_t frame_id() const;
+
+   [[nodiscard]] bool polar_texture_enabled() const;
    [[nodiscard]] std::shared_ptr<manager::RadarProductManager>
    radar_product_manager() const;
    [[nodiscard]] std::chrono::system_clock::time_point selected_time() const;
@@ -81,6 +116,16 @@ public:
    [[nodiscard]] virtual std::tuple<const void*, std::size_t, std::size_t>
    GetCfpMomentData() const;
 
+   /**
+    * Get the current sweep as a polar texture. A view provides a polar sweep
+    * in place of vertices and data moments when polar texture rendering is
+    * enabled and supported for the current sweep.
+    *
+    * @return Polar sweep, or std::nullopt if the sweep is rendered from
+    * vertices
+    */
+   [[nodiscard]] virtual std::optional<PolarSweep> GetPolarSweep() const;
+
    [[nodiscard]] virtual std::optional<std::uint16_t>
    GetBinLevel(const common::Coordinate& coordinate) const = 0;
    [[nodiscard]] virtual std::optional<wsr88d::DataLevelCode>
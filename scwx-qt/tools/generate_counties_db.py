@@ -2,6 +2,15 @@ import argparse
 import geopandas as gpd
 import pathlib
 import sqlite3
+import struct
+
+# Index format (little endian):
+#   Header:  magic (8 bytes), county count, state count, WFO count, string table
+#            size (uint32 each)
+#   Records: counties, states, then WFOs, each table sorted by key. A record is
+#            key offset, value offset (uint32), key size, value size (uint16).
+#   Strings: UTF-8 string table, with each unique string stored once
+INDEX_MAGIC = b"SCWXCTY1"
 
 class DatabaseInfo:
     def __init__(self):
@@ -9,7 +18,7 @@ class DatabaseInfo:
         self.sqlCursor_     = None
 
 def ParseArguments():
-    parser = argparse.ArgumentParser(description='Generate counties SQLite database')
+    parser = argparse.ArgumentParser(description='Generate counties index')
     parser.add_argument("-c", "--county_dbf",
                         metavar = "filename",
                         help    = "input county database",
@@ -42,21 +51,17 @@ def ParseArguments():
                         nargs   = "+",
                         default = [],
                         type    = pathlib.Path)
-    parser.add_argument("-o", "--output_db",
+    parser.add_argument("-o", "--output_index",
                         metavar  = "filename",
-                        help     = "output sqlite database",
-                        dest     = "outputDb_",
+                        help     = "output index",
+                        dest     = "outputIndex_",
                         type     = pathlib.Path,
                         required = True)
     return parser.parse_args()
 
-def Prepare(dbInfo, outputDb):
-    # Truncate existing database
-    file = open(outputDb, 'w')
-    file.close()
-
-    # Establish SQLite database connection
-    dbInfo.sqlConnection_ = sqlite3.connect(outputDb)
+def Prepare(dbInfo):
+    # Establish in-memory SQLite database connection, used to merge the inputs
+    dbInfo.sqlConnection_ = sqlite3.connect(":memory:")
 
     # Set row factory for name-based access to columns
     dbInfo.sqlConnection_.row_factory = sqlite3.Row
@@ -159,14 +164,54 @@ def ProcessWfoDbf(dbInfo, dbfFilename):
         except:
             print("Error inserting WFO:", row.FULLSTAID, row.CITYSTATE)
 
+def WriteIndex(dbInfo, outputIndex):
+    strings      = bytearray()
+    stringOffset = {}
+
+    def InternString(value):
+        if value is None:
+            value = ""
+        data = value.encode("utf-8")
+        if data not in stringOffset:
+            stringOffset[data] = len(strings)
+            strings.extend(data)
+        return (stringOffset[data], len(data))
+
+    def ReadTable(query):
+        # Sort by UTF-8 bytes, matching the byte-wise comparison used for lookup
+        rows = [(InternString(row[0]), InternString(row[1]))
+                for row in dbInfo.sqlCursor_.execute(query)]
+        rows.sort(key = lambda row: bytes(strings[row[0][0]:
+                                                  row[0][0] + row[0][1]]))
+        return rows
+
+    counties = ReadTable("SELECT id, name FROM counties")
+    states   = ReadTable("SELECT state, name FROM states")
+    wfos     = ReadTable("SELECT id, city_state FROM wfos")
+
+    with open(outputIndex, 'wb') as file:
+        file.write(INDEX_MAGIC)
+        file.write(struct.pack("<IIII",
+                               len(counties),
+                               len(states),
+                               len(wfos),
+                               len(strings)))
+        for table in [counties, states, wfos]:
+            for (key, value) in table:
+                file.write(struct.pack("<IIHH",
+                                       key[0],
+                                       value[0],
+                                       key[1],
+                                       value[1]))
+        file.write(strings)
+
 def PostProcess(dbInfo):
-    # Commit changes and close database
-    dbInfo.sqlConnection_.commit()
+    # Close database
     dbInfo.sqlConnection_.close()
 
 dbInfo = DatabaseInfo()
 args   = ParseArguments()
-Prepare(dbInfo, args.outputDb_)
+Prepare(dbInfo)
 
 for countyDb in args.inputCountyDbs_:
     ProcessCountiesDbf(dbInfo, countyDb)
@@ -180,4 +225,5 @@ for stateDb in args.inputStateDbs_:
 for wfoDb in args.inputWfoDbs_:
     ProcessWfoDbf(dbInfo, wfoDb)
 
+WriteIndex(dbInfo, args.outputIndex_)
 PostProcess(dbInfo)
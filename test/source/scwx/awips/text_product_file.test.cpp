@@ -56,5 +56,69 @@ TEST(TextProductFile, Update)
    EXPECT_EQ(file.message_count(), 13);
 }
 
+TEST(TextProductFile, LoadData)
+{
+   static const std::string kMessage1 {
+      "\x01\r\r\n"
+      "123 \r\r\n"
+      "WUUS53 KLSX 042104\r\r\n"
+      "SVRLSX\r\r\n"
+      "\r\r\n"
+      "MOC071-042145-\r\r\n"
+      "/O.NEW.KLSX.SV.W.0123.210604T2104Z-210604T2145Z/\r\r\n"
+      "\r\r\n"
+      "Franklin MO-\r\r\n"
+      "\r\r\n"
+      "LAT...LON 3838 9096 3847 9102 3852 9075\r\r\n"
+      "\r\r\n"
+      "TORNADO...POSSIBLE\r\r\n"
+      "\r\r\n"
+      "$$\r\r\n"
+      "\x03"};
+   static const std::string kMessage2 {
+      "\x01\r\r\n"
+      "124 \r\r\n"
+      "WFUS53 KPAH 061910\r\r\n"
+      "TORPAH\r\r\n"
+      "\r\r\n"
+      "ILC059-062145-\r\r\n"
+      "/O.CON.KPAH.TO.W.0042.000000T0000Z-210606T2145Z/\r\r\n"
+      "\r\r\n"
+      "Gallatin IL-\r\r\n"
+      "\r\r\n"
+      "$$\r\r\n"
+      "\x03"};
+
+   // Duplicate messages and padding between messages are skipped
+   const std::string data = kMessage1 + "\r\n" + kMessage2 + kMessage1 + "\r\n";
+
+   TextProductFile file;
+
+   EXPECT_TRUE(file.LoadData("warnings_20210604_21.txt", data));
+   ASSERT_EQ(file.message_count(), 2);
+
+   auto message1 = file.message(0);
+   auto message2 = file.message(1);
+
+   EXPECT_EQ(message1->wmo_header()->icao(), "KLSX");
+   EXPECT_EQ(message2->wmo_header()->icao(), "KPAH");
+
+   ASSERT_EQ(message1->segment_count(), 1);
+   auto segment = message1->segment(0);
+
+   ASSERT_TRUE(segment->header_.has_value());
+   ASSERT_EQ(segment->header_->vtecString_.size(), 1);
+   EXPECT_TRUE(segment->codedLocation_.has_value());
+   EXPECT_TRUE(segment->tornadoPossible_);
+   EXPECT_EQ(segment->productContent_.front(), "Franklin MO-");
+   EXPECT_EQ(segment->productContent_.back(), "$$");
+
+   // Message content is normalized to LF line endings
+   const std::string content = message2->message_content();
+   EXPECT_TRUE(content.starts_with("124 \nWFUS53 KPAH 061910\nTORPAH\n"));
+   EXPECT_TRUE(content.ends_with("$$"));
+   EXPECT_EQ(content.find('\r'), std::string::npos);
+}
+
 } // namespace awips
 } // namespace scwx
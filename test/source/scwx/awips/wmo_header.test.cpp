@@ -127,4 +127,33 @@ TEST(WmoHeader, EndTimeHintIgnored)
              sys_days {2022y / October / 28d} + 0h + 44min);
 }
 
+TEST(WmoHeader, HeaderSet)
+{
+   std::stringstream ss1 {kWmoHeaderSample_};
+   std::stringstream ss2 {kWmoHeaderSample_};
+   std::stringstream ss3 {"887\n"
+                          "WFUS54 KOUN 280044 CCA\n"
+                          "TOROUN"};
+
+   auto header1 = std::make_shared<WmoHeader>();
+   auto header2 = std::make_shared<WmoHeader>();
+   auto header3 = std::make_shared<WmoHeader>();
+
+   EXPECT_EQ(header1->Parse(ss1), true);
+   EXPECT_EQ(header2->Parse(ss2), true);
+   EXPECT_EQ(header3->Parse(ss3), true);
+
+   // A date hint is not part of the header identity
+   header2->SetDateHint(std::chrono::year {2022} / std::chrono::October);
+
+   EXPECT_EQ(header1->hash(), header2->hash());
+
+   WmoHeaderSet headers {};
+
+   EXPECT_EQ(headers.insert(header1).second, true);
+   EXPECT_EQ(headers.insert(header2).second, false);
+   EXPECT_EQ(headers.insert(header3).second, true);
+   EXPECT_EQ(headers.size(), 2u);
+}
+
 } // namespace scwx::awips
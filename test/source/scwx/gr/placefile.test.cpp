@@ -1,5 +1,9 @@
 #include <scwx/gr/placefile.hpp>
 
+#include <chrono>
+#include <sstream>
+
+#include <fmt/format.h>
 #include <gtest/gtest.h>
 
 namespace scwx
@@ -17,5 +21,147 @@ TEST(PlacefileTest, OldExample)
    EXPECT_EQ(true, true);
 }
 
+TEST(PlacefileTest, LoadLargePlacefile)
+{
+   // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers)
+   static constexpr std::size_t kItemCount_    = 20000u;
+   static constexpr std::size_t kElementCount_ = 10u;
+
+   // Generate a synthetic placefile containing icons, text, lines and polygons
+   std::string data {"Title: Synthetic Placefile\n"
+                     "Refresh: 1\n"
+                     "Threshold: 999\n"
+                     "Color: 255 200 0\n"
+                     "IconFile: 1, 20, 20, 10, 10, \"icons.png\"\n"
+                     "Font: 1, 11, 0, \"Courier New\"\n"};
+
+   for (std::size_t i = 0; i < kItemCount_; ++i)
+   {
+      const double latitude  = 30.0 + static_cast<double>(i % 1000) * 0.01;
+      const double longitude = -100.0 + static_cast<double>(i / 1000) * 0.01;
+
+      fmt::format_to(std::back_inserter(data),
+                     "Icon: {:.4f}, {:.4f}, 45, 1, 2, \"Icon {}\\nHover\"\n"
+                     "Text: {:.4f}, {:.4f}, 1, \"{}\", \"Text, {}\" ; note\n"
+                     "Line: 2, 0, \"Line {}\"\n",
+                     latitude,
+                     longitude,
+                     i,
+                     latitude,
+                     longitude,
+                     i,
+                     i,
+                     i);
+
+      for (std::size_t j = 0; j < kElementCount_; ++j)
+      {
+         fmt::format_to(std::back_inserter(data),
+                        "  {:.4f}, {:.4f}\n",
+                        latitude + static_cast<double>(j) * 0.001,
+                        longitude);
+      }
+
+      fmt::format_to(std::back_inserter(data),
+                     "End:\n"
+                     "Polygon:\n"
+                     "  {0:.4f}, {1:.4f}, 255, 0, 0, 128\n"
+                     "  {0:.4f}, {2:.4f}\n"
+                     "  {3:.4f}, {2:.4f}\n"
+                     "  {0:.4f}, {1:.4f}\n"
+                     "End:\n",
+                     latitude,
+                     longitude,
+                     longitude + 0.005,
+                     latitude + 0.005);
+   }
+
+   std::istringstream is {data};
+
+   auto start = std::chrono::steady_clock::now();
+
+   std::shared_ptr<Placefile> placefile = Placefile::Load("synthetic", is);
+
+   auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now() - start);
+
+   RecordProperty("LoadTimeMs", static_cast<int>(elapsed.count()));
+   RecordProperty("Bytes", static_cast<int>(data.size()));
+
+   ASSERT_NE(placefile, nullptr);
+   EXPECT_EQ(placefile->title(), "Synthetic Placefile");
+   EXPECT_EQ(placefile->icon_files().size(), 1u);
+   EXPECT_EQ(placefile->fonts().size(), 1u);
+
+   auto drawItems = placefile->GetDrawItems();
+   ASSERT_EQ(drawItems.size(), kItemCount_ * 4);
+
+   auto icon = std::static_pointer_cast<Placefile::IconDrawItem>(drawItems[0]);
+   auto text = std::static_pointer_cast<Placefile::TextDrawItem>(drawItems[1]);
+   auto line = std::static_pointer_cast<Placefile::LineDrawItem>(drawItems[2]);
+   auto polygon =
+      std::static_pointer_cast<Placefile::PolygonDrawItem>(drawItems[3]);
+
+   EXPECT_EQ(icon->itemType_, Placefile::ItemType::Icon);
+   EXPECT_DOUBLE_EQ(icon->latitude_, 30.0);
+   EXPECT_DOUBLE_EQ(icon->longitude_, -100.0);
+   EXPECT_DOUBLE_EQ(icon->angle_.value(), 45.0);
+   EXPECT_EQ(icon->iconNumber_, 2u);
+   EXPECT_EQ(icon->hoverText_, "Icon 0\nHover");
+
+   EXPECT_EQ(text->itemType_, Placefile::ItemType::Text);
+   EXPECT_EQ(text->text_, "0");
+   EXPECT_EQ(text->hoverText_, "Text, 0");
+
+   EXPECT_EQ(line->itemType_, Placefile::ItemType::Line);
+   EXPECT_DOUBLE_EQ(line->width_, 2.0);
+   EXPECT_EQ(line->hoverText_, "Line 0");
+   EXPECT_EQ(line->elements_.size(), kElementCount_);
+
+   EXPECT_EQ(polygon->itemType_, Placefile::ItemType::Polygon);
+   ASSERT_EQ(polygon->contours_.size(), 1u);
+   EXPECT_EQ(polygon->contours_[0].size(), 4u);
+   ASSERT_TRUE(polygon->contours_[0][0].color_.has_value());
+   EXPECT_EQ((*polygon->contours_[0][0].color_)[3], 128u);
+   // NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
+}
+
+TEST(PlacefileTest, DrawItemHash)
+{
+   static const std::string kPlacefile_ {"Color: 255 0 0\n"
+                                         "Line: 2, 0\n"
+                                         "  35.0, -97.0\n"
+                                         "  35.1, -97.1\n"
+                                         "End:\n"
+                                         "Polygon:\n"
+                                         "  35.0, -97.0\n"
+                                         "  35.1, -97.0\n"
+                                         "  35.1, -97.1\n"
+                                         "End:\n"};
+
+   std::string modifiedPlacefile {kPlacefile_};
+   modifiedPlacefile.replace(modifiedPlacefile.rfind("-97.1"), 5, "-97.2");
+
+   std::istringstream is1 {kPlacefile_};
+   std::istringstream is2 {kPlacefile_};
+   std::istringstream is3 {modifiedPlacefile};
+
+   auto drawItems1 = Placefile::Load("placefile", is1)->GetDrawItems();
+   auto drawItems2 = Placefile::Load("placefile", is2)->GetDrawItems();
+   auto drawItems3 = Placefile::Load("placefile", is3)->GetDrawItems();
+
+   ASSERT_EQ(drawItems1.size(), 2u);
+   ASSERT_EQ(drawItems2.size(), 2u);
+   ASSERT_EQ(drawItems3.size(), 2u);
+
+   // Identical statements produce identical hashes across loads
+   EXPECT_EQ(drawItems1[0]->hash_, drawItems2[0]->hash_);
+   EXPECT_EQ(drawItems1[1]->hash_, drawItems2[1]->hash_);
+   EXPECT_NE(drawItems1[0]->hash_, drawItems1[1]->hash_);
+
+   // Only the modified polygon has a different hash
+   EXPECT_EQ(drawItems1[0]->hash_, drawItems3[0]->hash_);
+   EXPECT_NE(drawItems1[1]->hash_, drawItems3[1]->hash_);
+}
+
 } // namespace gr
 } // namespace scwx
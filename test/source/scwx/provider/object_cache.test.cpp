@@ -0,0 +1,186 @@
+#include <scwx/provider/object_cache.hpp>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace provider
+{
+
+static const std::string kBucket_ {"unidata-nexrad-level2"};
+
+class ObjectCacheTest : public testing::Test
+{
+protected:
+   void SetUp() override
+   {
+      directory_ = std::filesystem::temp_directory_path() /
+                   ("scwx-object-cache-" +
+                    std::string(testing::UnitTest::GetInstance()
+                                   ->current_test_info()
+                                   ->name()));
+      std::filesystem::remove_all(directory_);
+   }
+
+   void TearDown() override { std::filesystem::remove_all(directory_); }
+
+   std::filesystem::path directory_ {};
+};
+
+TEST_F(ObjectCacheTest, Disabled)
+{
+   ObjectCache cache {};
+
+   cache.Put(kBucket_, "KLSX/object", std::vector<char>(16, 'a'));
+
+   EXPECT_FALSE(cache.enabled());
+   EXPECT_EQ(cache.Get(kBucket_, "KLSX/object"), nullptr);
+}
+
+TEST_F(ObjectCacheTest, PutGet)
+{
+   const std::vector<char> object1(1000, 'a');
+   const std::vector<char> object2(2000, 'b');
+
+   {
+      ObjectCache cache {};
+      cache.Initialize(directory_.string(), 1024 * 1024);
+
+      EXPECT_TRUE(cache.enabled());
+      EXPECT_EQ(cache.Get(kBucket_, "KLSX/object1"), nullptr);
+
+      cache.Put(kBucket_, "KLSX/object1", object1);
+      cache.Put(kBucket_, "KLSX/object2", object2);
+
+      auto data1 = cache.Get(kBucket_, "KLSX/object1");
+      ASSERT_NE(data1, nullptr);
+      EXPECT_EQ(*data1, object1);
+   }
+
+   // Objects persist in a new instance
+   ObjectCache cache {};
+   cache.Initialize(directory_.string(), 1024 * 1024);
+
+   auto data2 = cache.Get(kBucket_, "KLSX/object2");
+   ASSERT_NE(data2, nullptr);
+   EXPECT_EQ(*data2, object2);
+   EXPECT_EQ(cache.Get("other-bucket", "KLSX/object2"), nullptr);
+}
+
+TEST_F(ObjectCacheTest, PutAsync)
+{
+   const auto object = std::make_shared<const std::vector<char>>(1000, 'a');
+
+   ObjectCache cache {};
+   cache.Initialize(directory_.string(), 1024 * 1024);
+
+   cache.PutAsync(kBucket_, "KLSX/object", object);
+
+   // Wait for the background write to complete
+   std::shared_ptr<std::vector<char>> data {};
+   for (int i = 0; i < 100 && data == nullptr; ++i)
+   {
+      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+      data = cache.Get(kBucket_, "KLSX/object");
+   }
+
+   ASSERT_NE(data, nullptr);
+   EXPECT_EQ(*data, *object);
+}
+
+TEST_F(ObjectCacheTest, Integrity)
+{
+   ObjectCache cache {};
+   cache.Initialize(directory_.string(), 1024 * 1024);
+
+   cache.Put(kBucket_, "KLSX/object", std::vector<char>(1000, 'a'));
+
+   // Corrupt the last byte of the object data
+   for (auto& entry : std::filesystem::recursive_directory_iterator(directory_))
+   {
+      if (entry.is_regular_file())
+      {
+         std::fstream fs {entry.path(),
+                          std::ios_base::in | std::ios_base::out |
+                             std::ios_base::binary};
+         fs.seekp(-1, std::ios_base::end);
+         fs.put('b');
+      }
+   }
+
+   EXPECT_EQ(cache.Get(kBucket_, "KLSX/object"), nullptr);
+   EXPECT_EQ(cache.size(), 0u);
+}
+
+TEST_F(ObjectCacheTest, Eviction)
+{
+   ObjectCache cache {};
+   cache.Initialize(directory_.string(), 5000);
+
+   cache.Put(kBucket_, "KLSX/object1", std::vector<char>(1500, 'a'));
+   cache.Put(kBucket_, "KLSX/object2", std::vector<char>(1500, 'b'));
+   cache.Put(kBucket_, "KLSX/object3", std::vector<char>(1500, 'c'));
+
+   // Use object 1, making object 2 the least recently used
+   EXPECT_NE(cache.Get(kBucket_, "KLSX/object1"), nullptr);
+
+   cache.Put(kBucket_, "KLSX/object4", std::vector<char>(1500, 'd'));
+
+   EXPECT_LE(cache.size(), 5000u);
+   EXPECT_NE(cache.Get(kBucket_, "KLSX/object1"), nullptr);
+   EXPECT_EQ(cache.Get(kBucket_, "KLSX/object2"), nullptr);
+   EXPECT_NE(cache.Get(kBucket_, "KLSX/object3"), nullptr);
+   EXPECT_NE(cache.Get(kBucket_, "KLSX/object4"), nullptr);
+}
+
+TEST_F(ObjectCacheTest, Initialize)
+{
+   std::filesystem::create_directories(directory_ / "ab");
+
+   const auto tempPath  = directory_ / "ab" / "object.0.tmp";
+   const auto otherPath = directory_ / "notes.txt";
+
+   std::ofstream {tempPath} << "interrupted";
+   std::ofstream {otherPath} << "other";
+
+   ObjectCache cache {};
+   cache.Initialize(directory_.string(), 1024 * 1024);
+
+   // Interrupted writes are removed, files not created by the cache are kept
+   EXPECT_FALSE(std::filesystem::exists(tempPath));
+   EXPECT_TRUE(std::filesystem::exists(otherPath));
+   EXPECT_EQ(cache.size(), 0u);
+}
+
+TEST_F(ObjectCacheTest, Missing)
+{
+   ObjectCache cache {};
+   cache.Initialize(directory_.string(), 1024 * 1024);
+
+   cache.Put(kBucket_, "KLSX/object", std::vector<char>(1000, 'a'));
+
+   // An object removed from disk is a cache miss
+   for (auto& entry : std::filesystem::recursive_directory_iterator(directory_))
+   {
+      if (entry.is_regular_file())
+      {
+         std::filesystem::remove(entry.path());
+      }
+   }
+
+   EXPECT_EQ(cache.Get(kBucket_, "KLSX/object"), nullptr);
+
+   cache.Put(kBucket_, "KLSX/object", std::vector<char>(1000, 'b'));
+
+   auto data = cache.Get(kBucket_, "KLSX/object");
+   ASSERT_NE(data, nullptr);
+   EXPECT_EQ(*data, std::vector<char>(1000, 'b'));
+}
+
+} // namespace provider
+} // namespace scwx
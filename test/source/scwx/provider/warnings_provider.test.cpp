@@ -1,5 +1,13 @@
 #include <scwx/provider/warnings_provider.hpp>
 
+#include <charconv>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include <boost/algorithm/string.hpp>
+#include <boost/asio.hpp>
+#include <fmt/format.h>
 #include <gtest/gtest.h>
 
 namespace scwx
@@ -40,5 +48,260 @@ INSTANTIATE_TEST_SUITE_P(WarningsProvider,
                          WarningsProviderTest,
                          testing::Values(kDefaultUrl, kAlternateUrl));
 
+static const std::string kMessage1_ {"\x01\r\r\n"
+                                     "123 \r\r\n"
+                                     "WUUS53 KLSX 042104\r\r\n"
+                                     "SVRLSX\r\r\n"
+                                     "\r\r\n"
+                                     "$$\r\r\n"
+                                     "\x03\r\r\n"};
+static const std::string kMessage2_ {"\x01\r\r\n"
+                                     "124 \r\r\n"
+                                     "WFUS53 KPAH 061910\r\r\n"
+                                     "TORPAH\r\r\n"
+                                     "\r\r\n"
+                                     "$$\r\r\n"
+                                     "\x03\r\r\n"};
+static const std::string kMessage3_ {"\x01\r\r\n"
+                                     "125 \r\r\n"
+                                     "WUUS53 KLSX 042130\r\r\n"
+                                     "SVRLSX\r\r\n"
+                                     "\r\r\n"
+                                     "$$\r\r\n"
+                                     "\x03\r\r\n"};
+
+/**
+ * Serves a single warnings file from a local HTTP server. The first file
+ * requested is served, and all other files are not found.
+ */
+class WarningsServer
+{
+public:
+   struct Request
+   {
+      std::string method_ {};
+      std::string range_ {};
+      std::string acceptEncoding_ {};
+   };
+
+   explicit WarningsServer(bool acceptRanges) : acceptRanges_ {acceptRanges}
+   {
+      acceptor_.open(boost::asio::ip::tcp::v4());
+      acceptor_.bind({boost::asio::ip::address_v4::loopback(), 0});
+      acceptor_.listen();
+      Accept();
+
+      thread_ = std::thread {[this]() { context_.run(); }};
+   }
+   ~WarningsServer()
+   {
+      context_.stop();
+      thread_.join();
+   }
+
+   WarningsServer(const WarningsServer&)            = delete;
+   WarningsServer& operator=(const WarningsServer&) = delete;
+   WarningsServer(WarningsServer&&)                 = delete;
+   WarningsServer& operator=(WarningsServer&&)      = delete;
+
+   std::string url() const
+   {
+      return fmt::format("http://127.0.0.1:{}",
+                         acceptor_.local_endpoint().port());
+   }
+
+   void Append(const std::string& data)
+   {
+      const std::unique_lock lock {mutex_};
+      file_ += data;
+   }
+
+   std::vector<Request> TakeRequests()
+   {
+      const std::unique_lock lock {mutex_};
+      return std::exchange(requests_, {});
+   }
+
+private:
+   void Accept()
+   {
+      acceptor_.async_accept(
+         [this](boost::system::error_code    error,
+                boost::asio::ip::tcp::socket socket)
+         {
+            if (!error)
+            {
+               Respond(socket);
+               Accept();
+            }
+         });
+   }
+
+   void Respond(boost::asio::ip::tcp::socket& socket)
+   {
+      boost::system::error_code error;
+      boost::asio::streambuf    buffer;
+      boost::asio::read_until(socket, buffer, "\r\n\r\n", error);
+      if (error)
+      {
+         return;
+      }
+
+      std::istream is {&buffer};
+      std::string  method;
+      std::string  path;
+      std::string  line;
+      Request      request {};
+
+      is >> method >> path;
+      std::getline(is, line);
+
+      while (std::getline(is, line) && line != "\r")
+      {
+         const std::size_t colon = line.find(':');
+         if (colon == std::string::npos)
+         {
+            continue;
+         }
+
+         const std::string name  = line.substr(0, colon);
+         const std::string value = boost::trim_copy(line.substr(colon + 1));
+
+         if (boost::iequals(name, "Range"))
+         {
+            request.range_ = value;
+         }
+         else if (boost::iequals(name, "Accept-Encoding"))
+         {
+            request.acceptEncoding_ = value;
+         }
+      }
+
+      request.method_ = method;
+
+      std::string status {"200 OK"};
+      std::string body {};
+
+      {
+         const std::unique_lock lock {mutex_};
+
+         if (path_.empty())
+         {
+            path_ = path;
+         }
+
+         if (path != path_)
+         {
+            status = "404 Not Found";
+         }
+         else
+         {
+            requests_.push_back(request);
+            body = file_;
+
+            static const std::string kBytes {"bytes="};
+
+            std::size_t offset {};
+            if (acceptRanges_ && request.range_.starts_with(kBytes) &&
+                std::from_chars(request.range_.data() + kBytes.size(),
+                                request.range_.data() + request.range_.size(),
+                                offset)
+                      .ec == std::errc {} &&
+                offset < body.size())
+            {
+               status = "206 Partial Content";
+               body   = body.substr(offset);
+            }
+         }
+      }
+
+      std::string response = fmt::format("HTTP/1.1 {}\r\n"
+                                         "Content-Length: {}\r\n"
+                                         "Connection: close\r\n"
+                                         "\r\n",
+                                         status,
+                                         body.size());
+      if (method != "HEAD")
+      {
+         response += body;
+      }
+
+      boost::asio::write(socket, boost::asio::buffer(response), error);
+      socket.shutdown(boost::asio::ip::tcp::socket::shutdown_both, error);
+   }
+
+   bool acceptRanges_;
+
+   boost::asio::io_context        context_ {};
+   boost::asio::ip::tcp::acceptor acceptor_ {context_};
+   std::thread                    thread_ {};
+
+   std::mutex           mutex_ {};
+   std::string          path_ {};
+   std::string          file_ {};
+   std::vector<Request> requests_ {};
+};
+
+class WarningsProviderRangeTest : public testing::TestWithParam<bool>
+{
+};
+
+TEST_P(WarningsProviderRangeTest, LoadAppendedMessages)
+{
+   const bool acceptRanges = GetParam();
+
+   WarningsServer   server {acceptRanges};
+   WarningsProvider provider {server.url()};
+
+   const std::chrono::sys_time<std::chrono::hours> startTime =
+      std::chrono::floor<std::chrono::hours>(std::chrono::system_clock::now());
+
+   // The first message is complete, the second message is partially written
+   server.Append(kMessage1_ + kMessage2_.substr(0, kMessage2_.size() / 2));
+
+   auto updatedFiles = provider.LoadUpdatedFiles(startTime);
+   ASSERT_EQ(updatedFiles.size(), 1u);
+   EXPECT_EQ(updatedFiles[0]->message_count(), 1u);
+
+   auto requests = server.TakeRequests();
+   ASSERT_EQ(requests.size(), 2u);
+   EXPECT_EQ(requests[0].method_, "HEAD");
+   EXPECT_EQ(requests[0].acceptEncoding_, "identity");
+   EXPECT_EQ(requests[1].method_, "GET");
+   EXPECT_EQ(requests[1].acceptEncoding_, "identity");
+   EXPECT_TRUE(requests[1].range_.empty());
+
+   // The file is unchanged, and is not requested again
+   updatedFiles = provider.LoadUpdatedFiles(startTime);
+   EXPECT_TRUE(updatedFiles.empty());
+
+   requests = server.TakeRequests();
+   ASSERT_EQ(requests.size(), 1u);
+   EXPECT_EQ(requests[0].method_, "HEAD");
+
+   // The second message is completed, and the third message is written. Only
+   // the bytes following the first message are requested, and only the new
+   // messages are loaded, whether or not the server accepts the range.
+   server.Append(kMessage2_.substr(kMessage2_.size() / 2) + kMessage3_);
+
+   updatedFiles = provider.LoadUpdatedFiles(startTime);
+   ASSERT_EQ(updatedFiles.size(), 1u);
+   EXPECT_EQ(updatedFiles[0]->message_count(), 2u);
+
+   requests = server.TakeRequests();
+   ASSERT_EQ(requests.size(), 2u);
+   EXPECT_EQ(requests[1].method_, "GET");
+   EXPECT_EQ(requests[1].acceptEncoding_, "identity");
+   EXPECT_EQ(requests[1].range_, fmt::format("bytes={}-", kMessage1_.size()));
+
+   // All messages have been loaded
+   updatedFiles = provider.LoadUpdatedFiles(startTime);
+   EXPECT_TRUE(updatedFiles.empty());
+}
+
+INSTANTIATE_TEST_SUITE_P(WarningsProvider,
+                         WarningsProviderRangeTest,
+                         testing::Values(true, false));
+
 } // namespace provider
 } // namespace scwx
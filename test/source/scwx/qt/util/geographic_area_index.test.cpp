@@ -0,0 +1,147 @@
+#include <scwx/qt/util/geographic_area_index.hpp>
+#include <scwx/qt/util/geographic_lib.hpp>
+
+#include <random>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static const std::vector<common::Coordinate> kArea_ {
+   common::Coordinate(37.0193692, -91.8778413),
+   common::Coordinate(36.9719180, -91.3006973),
+   common::Coordinate(36.7270831, -91.6815753),
+};
+
+TEST(GeographicAreaIndex, InRange)
+{
+   GeographicAreaIndex index {};
+   index.Insert(7u, kArea_);
+
+   const auto inside = common::Coordinate(36.9241584, -91.6425933);
+   const auto near   = common::Coordinate(36.8009181, -91.3922700);
+   const auto far    = common::Coordinate(37.6481966, -94.2163834);
+
+   EXPECT_TRUE(index.InRange(7u, inside, units::length::meters<double>(0)));
+   EXPECT_FALSE(index.InRange(7u, near, units::length::meters<double>(9000)));
+   EXPECT_TRUE(index.InRange(7u, near, units::length::meters<double>(10100)));
+   EXPECT_FALSE(index.InRange(7u, far, units::length::meters<double>(100e3)));
+   EXPECT_TRUE(index.InRange(7u, far, units::length::meters<double>(300e3)));
+
+   // Unknown and removed areas are never in range
+   EXPECT_FALSE(index.InRange(8u, inside, units::length::meters<double>(0)));
+
+   index.Remove(7u);
+   EXPECT_TRUE(index.empty());
+   EXPECT_FALSE(index.InRange(7u, inside, units::length::meters<double>(0)));
+}
+
+TEST(GeographicAreaIndex, Antimeridian)
+{
+   GeographicAreaIndex      index {};
+   std::vector<std::size_t> ids {};
+
+   index.Insert(1u,
+                {common::Coordinate(51.0, 179.5),
+                 common::Coordinate(51.0, -179.5),
+                 common::Coordinate(52.0, -179.5),
+                 common::Coordinate(52.0, 179.5)});
+
+   index.Query(common::Coordinate(51.5, -179.9),
+               units::length::meters<double>(0),
+               ids);
+   EXPECT_EQ(ids, std::vector<std::size_t> {1u});
+
+   index.Query(common::Coordinate(51.5, 178.0),
+               units::length::meters<double>(0),
+               ids);
+   EXPECT_TRUE(ids.empty());
+}
+
+TEST(GeographicAreaIndex, GeodesicEdge)
+{
+   // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers)
+   GeographicAreaIndex index {};
+
+   const std::vector<common::Coordinate> area {common::Coordinate(44.0, 0.0),
+                                               common::Coordinate(44.0, 1.0),
+                                               common::Coordinate(45.0, 1.0),
+                                               common::Coordinate(45.0, 0.0)};
+   index.Insert(1u, area);
+
+   // The northern edge peaks near 45.0011 degrees, north of its endpoints
+   const auto point = common::Coordinate(45.0005, 0.5);
+
+   EXPECT_TRUE(GeographicLib::AreaInRangeOfPoint(
+      area, point, units::length::meters<double>(0)));
+   EXPECT_TRUE(index.InRange(1u, point, units::length::meters<double>(0)));
+   // NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
+}
+
+TEST(GeographicAreaIndex, MatchesLinearSearch)
+{
+   // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers)
+   std::mt19937                           generator {1234u};
+   std::uniform_real_distribution<double> latitude {25.0, 49.0};
+   std::uniform_real_distribution<double> longitude {-125.0, -67.0};
+   std::uniform_real_distribution<double> offset {-0.5, 0.5};
+   std::uniform_real_distribution<double> radius {0.0, 50e3};
+
+   GeographicAreaIndex                          index {};
+   std::vector<std::vector<common::Coordinate>> areas {};
+
+   for (std::size_t i = 0; i < 200; ++i)
+   {
+      const common::Coordinate center {latitude(generator),
+                                       longitude(generator)};
+
+      std::vector<common::Coordinate> area {};
+      for (std::size_t j = 0; j < 5; ++j)
+      {
+         area.emplace_back(center.latitude_ + offset(generator),
+                           center.longitude_ + offset(generator));
+      }
+
+      index.Insert(i, area);
+      areas.push_back(std::move(area));
+   }
+
+   // Replace one area, and remove another
+   index.Insert(0u, areas[1]);
+   areas[0] = areas[1];
+   index.Remove(2u);
+
+   EXPECT_EQ(index.size(), 199u);
+
+   std::vector<std::size_t> ids {};
+
+   for (std::size_t i = 0; i < 100; ++i)
+   {
+      const common::Coordinate point {latitude(generator),
+                                      longitude(generator)};
+      const units::length::meters<double> distance {radius(generator)};
+
+      std::vector<std::size_t> expected {};
+      for (std::size_t j = 0; j < areas.size(); ++j)
+      {
+         if (j != 2u && GeographicLib::AreaInRangeOfPoint(
+                           areas[j], point, distance))
+         {
+            expected.push_back(j);
+         }
+      }
+
+      index.Query(point, distance, ids);
+      EXPECT_EQ(ids, expected);
+   }
+   // NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
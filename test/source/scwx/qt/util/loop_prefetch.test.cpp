@@ -0,0 +1,130 @@
+#include <scwx/qt/util/loop_prefetch.hpp>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+using namespace std::chrono_literals;
+
+static const std::chrono::system_clock::time_point kStartTime_ {
+   std::chrono::sys_days {std::chrono::year {2024} / 5 / 7} + 20h};
+static const LoopPrefetch::Loop kLoop_ {kStartTime_, kStartTime_ + 30min};
+
+TEST(LoopPrefetch, PlayOrder)
+{
+   std::vector<std::chrono::system_clock::time_point> times {};
+   for (auto time = kStartTime_; time <= kLoop_.endTime_; time += 5min)
+   {
+      times.push_back(time);
+   }
+
+   // Products following the current time are played first, and products
+   // preceding the current time are played after the loop wraps. The start
+   // and end of the loop are played at the same offset, and retain their
+   // order.
+   auto forward = times;
+   LoopPrefetch::SortByPlayOrder(
+      forward, kLoop_, kStartTime_ + 12min, std::identity {});
+
+   EXPECT_EQ(forward,
+             (std::vector<std::chrono::system_clock::time_point> {
+                kStartTime_ + 15min,
+                kStartTime_ + 20min,
+                kStartTime_ + 25min,
+                kStartTime_,
+                kStartTime_ + 30min,
+                kStartTime_ + 5min,
+                kStartTime_ + 10min}));
+
+   // In reverse, products preceding the current time are played first
+   const LoopPrefetch::Loop reverseLoop {
+      kLoop_.startTime_, kLoop_.endTime_, true};
+
+   auto reverse = times;
+   LoopPrefetch::SortByPlayOrder(
+      reverse, reverseLoop, kStartTime_ + 12min, std::identity {});
+
+   EXPECT_EQ(reverse,
+             (std::vector<std::chrono::system_clock::time_point> {
+                kStartTime_ + 10min,
+                kStartTime_ + 5min,
+                kStartTime_,
+                kStartTime_ + 30min,
+                kStartTime_ + 25min,
+                kStartTime_ + 20min,
+                kStartTime_ + 15min}));
+}
+
+TEST(LoopPrefetch, Restart)
+{
+   LoopPrefetch prefetch {};
+
+   std::set<std::chrono::system_clock::time_point> volumeTimes {
+      kStartTime_ - 3min, kStartTime_ + 7min, kStartTime_ + 17min};
+
+   auto generation1 = prefetch.Start(kLoop_, volumeTimes, false);
+   ASSERT_TRUE(generation1.has_value());
+   EXPECT_FALSE(prefetch.IsCancelled(generation1.value()));
+
+   // Playing the same loop retains the prefetch in progress
+   EXPECT_FALSE(prefetch.Start(kLoop_, volumeTimes, false).has_value());
+   EXPECT_FALSE(prefetch.IsCancelled(generation1.value()));
+
+   // Selecting a time restarts the prefetch
+   auto generation2 = prefetch.Start(kLoop_, volumeTimes, true);
+   ASSERT_TRUE(generation2.has_value());
+   EXPECT_TRUE(prefetch.IsCancelled(generation1.value()));
+   EXPECT_FALSE(prefetch.IsCancelled(generation2.value()));
+
+   // Advancing the loop window without a change in volume scans retains the
+   // prefetch in progress
+   const LoopPrefetch::Loop movedLoop {
+      kLoop_.startTime_ + 1min, kLoop_.endTime_ + 1min, false};
+
+   EXPECT_FALSE(prefetch.Start(movedLoop, volumeTimes, false).has_value());
+   EXPECT_FALSE(prefetch.IsCancelled(generation2.value()));
+
+   // A new volume scan in the loop restarts the prefetch
+   volumeTimes.insert(kStartTime_ + 27min);
+
+   auto generation3 = prefetch.Start(movedLoop, volumeTimes, false);
+   ASSERT_TRUE(generation3.has_value());
+   EXPECT_TRUE(prefetch.IsCancelled(generation2.value()));
+
+   // Changing direction restarts the prefetch
+   const LoopPrefetch::Loop reverseLoop {
+      movedLoop.startTime_, movedLoop.endTime_, true};
+
+   auto generation4 = prefetch.Start(reverseLoop, volumeTimes, false);
+   ASSERT_TRUE(generation4.has_value());
+   EXPECT_TRUE(prefetch.IsCancelled(generation3.value()));
+   EXPECT_FALSE(prefetch.IsCancelled(generation4.value()));
+}
+
+TEST(LoopPrefetch, Cancel)
+{
+   LoopPrefetch prefetch {};
+
+   const std::set<std::chrono::system_clock::time_point> volumeTimes {
+      kStartTime_, kStartTime_ + 10min};
+
+   auto generation1 = prefetch.Start(kLoop_, volumeTimes, false);
+   ASSERT_TRUE(generation1.has_value());
+
+   prefetch.Cancel();
+   EXPECT_TRUE(prefetch.IsCancelled(generation1.value()));
+
+   // A cancelled prefetch is restarted, even if the loop is unchanged
+   auto generation2 = prefetch.Start(kLoop_, volumeTimes, false);
+   ASSERT_TRUE(generation2.has_value());
+   EXPECT_FALSE(prefetch.IsCancelled(generation2.value()));
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,159 @@
+#include <scwx/qt/util/moment_kernels.hpp>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+namespace MomentKernels
+{
+
+// Odd length, to exercise both the vectorized and scalar tail loops
+static constexpr std::size_t kCount_ = 1839u;
+
+static const std::vector<InstructionSet> kInstructionSets_ {
+   InstructionSet::Scalar, InstructionSet::Sse4_1, InstructionSet::Avx2};
+
+template<typename T>
+static std::vector<T> GenerateMoments(T maxValue)
+{
+   std::mt19937                                 generator {1234u};
+   std::uniform_int_distribution<std::uint32_t> distribution {0u, maxValue};
+
+   std::vector<T> moments(kCount_ + 1);
+   for (auto& moment : moments)
+   {
+      moment = static_cast<T>(distribution(generator));
+   }
+
+   // Ensure the special values are present
+   moments[0] = 0;
+   moments[1] = 1;
+   moments[2] = 2;
+
+   return moments;
+}
+
+template<typename T>
+static void TestThresholdMask(T maxValue, std::uint16_t threshold)
+{
+   const std::vector<T> moments = GenerateMoments<T>(maxValue);
+
+   for (bool includeRangeFolded : {false, true})
+   {
+      std::vector<std::uint8_t> expected(kCount_);
+      ThresholdMask(moments.data(),
+                    kCount_,
+                    threshold,
+                    includeRangeFolded,
+                    expected.data(),
+                    InstructionSet::Scalar);
+
+      for (std::size_t i = 0; i < kCount_; ++i)
+      {
+         const bool visible = (moments[i] == 1) ? includeRangeFolded :
+                                                  (moments[i] >= threshold);
+         ASSERT_EQ(expected[i], visible ? 1u : 0u) << "index " << i;
+      }
+
+      for (InstructionSet instructionSet : kInstructionSets_)
+      {
+         std::vector<std::uint8_t> mask(kCount_);
+         ThresholdMask(moments.data(),
+                       kCount_,
+                       threshold,
+                       includeRangeFolded,
+                       mask.data(),
+                       instructionSet);
+
+         EXPECT_EQ(mask, expected);
+      }
+   }
+}
+
+template<typename T>
+static void TestRemap(T maxValue, T edgeValue)
+{
+   const std::vector<T> moments = GenerateMoments<T>(maxValue);
+
+   for (bool showRangeFolding : {false, true})
+   {
+      std::vector<T> expected(kCount_);
+      for (std::size_t i = 0; i < kCount_; ++i)
+      {
+         const T    value = moments[i];
+         const bool edge  = value == 0 || (value == 1 && !showRangeFolding);
+         expected[i]      = edge ? edgeValue : value;
+      }
+
+      for (InstructionSet instructionSet : kInstructionSets_)
+      {
+         std::vector<T> output(kCount_);
+         Remap(moments.data(),
+               kCount_,
+               edgeValue,
+               showRangeFolding,
+               output.data(),
+               instructionSet);
+
+         EXPECT_EQ(output, expected);
+      }
+   }
+}
+
+TEST(MomentKernels, ThresholdMask8)
+{
+   TestThresholdMask<std::uint8_t>(255u, 2u);
+   TestThresholdMask<std::uint8_t>(255u, 130u);
+   TestThresholdMask<std::uint8_t>(255u, 300u);
+}
+
+TEST(MomentKernels, ThresholdMask16)
+{
+   TestThresholdMask<std::uint16_t>(1023u, 2u);
+   TestThresholdMask<std::uint16_t>(65535u, 40000u);
+}
+
+TEST(MomentKernels, QuadMask)
+{
+   const std::vector<std::uint8_t> moments0 = GenerateMoments<std::uint8_t>(1u);
+   std::vector<std::uint8_t>       moments1 = moments0;
+   std::reverse(moments1.begin(), moments1.end());
+
+   std::vector<std::uint8_t> expected(kCount_);
+   for (std::size_t i = 0; i < kCount_; ++i)
+   {
+      expected[i] =
+         moments0[i] | moments0[i + 1] | moments1[i] | moments1[i + 1];
+   }
+
+   for (InstructionSet instructionSet : kInstructionSets_)
+   {
+      std::vector<std::uint8_t> quadMask(kCount_);
+      QuadMask(moments0.data(),
+               moments1.data(),
+               kCount_,
+               quadMask.data(),
+               instructionSet);
+
+      EXPECT_EQ(quadMask, expected);
+   }
+}
+
+TEST(MomentKernels, Remap)
+{
+   TestRemap<std::uint8_t>(255u, 7u);
+   TestRemap<std::uint16_t>(65535u, 300u);
+}
+
+} // namespace MomentKernels
+} // namespace util
+} // namespace qt
+} // namespace scwx
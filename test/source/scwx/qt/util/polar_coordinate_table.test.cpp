@@ -0,0 +1,134 @@
+#include <scwx/qt/util/polar_coordinate_table.hpp>
+#include <scwx/qt/util/geographic_lib.hpp>
+#include <scwx/common/constants.hpp>
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static const PolarCoordinateTable::Parameters kParameters_ {
+   .latitude_        = 38.8102,
+   .longitude_       = -90.6823,
+   .gateSize_        = 250.0f,
+   .gateRangeOffset_ = 1.0f,
+   .radialAngle_     = 0.5f,
+   .angleOffset_     = 0.0f};
+
+TEST(PolarCoordinateTable, Shared)
+{
+   auto table1 = PolarCoordinateTable::Get(kParameters_);
+   auto table2 = PolarCoordinateTable::Get(kParameters_);
+
+   EXPECT_EQ(table1, table2);
+   EXPECT_EQ(table1->radial_count(), common::MAX_0_5_DEGREE_RADIALS);
+   EXPECT_EQ(table1->coordinates().size(),
+             table1->radial_count() * table1->gate_count() * 2);
+}
+
+TEST(PolarCoordinateTable, Concurrent)
+{
+   // Use a different site, so the table is not already cached
+   PolarCoordinateTable::Parameters parameters = kParameters_;
+   parameters.longitude_ += 1.0;
+
+   std::vector<std::shared_ptr<const PolarCoordinateTable>> tables(4u);
+   std::vector<std::thread>                                 threads {};
+
+   for (auto& table : tables)
+   {
+      threads.emplace_back([&table, &parameters]()
+                           { table = PolarCoordinateTable::Get(parameters); });
+   }
+   for (auto& thread : threads)
+   {
+      thread.join();
+   }
+
+   // Concurrent requests share a single table
+   for (auto& table : tables)
+   {
+      EXPECT_EQ(table, tables.front());
+   }
+   EXPECT_NE(tables.front(), PolarCoordinateTable::Get(kParameters_));
+}
+
+TEST(PolarCoordinateTable, TableRadial)
+{
+   auto               table = PolarCoordinateTable::Get(kParameters_);
+   std::vector<float> radial(table->gate_count() * 2);
+
+   // An azimuth on a table radial returns the table values
+   table->GetRadial(90.0f, table->gate_count(), radial.data());
+
+   const std::size_t offset = 180u * table->gate_count() * 2;
+   for (std::size_t i = 0; i < radial.size(); ++i)
+   {
+      EXPECT_FLOAT_EQ(radial[i], table->coordinates()[offset + i]);
+   }
+}
+
+TEST(PolarCoordinateTable, InterpolatedRadial)
+{
+   auto               table = PolarCoordinateTable::Get(kParameters_);
+   std::vector<float> radial(table->gate_count() * 2);
+
+   const auto& geodesic = GeographicLib::DefaultGeodesic();
+
+   // Check the worst case, midway between two table radials, including the
+   // radial wrapping from 359.5 to 0 degrees
+   for (float azimuth : {45.25f, 359.75f, -0.25f})
+   {
+      table->GetRadial(azimuth, table->gate_count(), radial.data());
+
+      for (std::size_t gate = 0; gate < table->gate_count(); ++gate)
+      {
+         const double range = (gate + kParameters_.gateRangeOffset_) *
+                              kParameters_.gateSize_;
+
+         double latitude;
+         double longitude;
+         double distance;
+
+         geodesic.Direct(kParameters_.latitude_,
+                         kParameters_.longitude_,
+                         azimuth,
+                         range,
+                         latitude,
+                         longitude);
+         geodesic.Inverse(latitude,
+                          longitude,
+                          radial[gate * 2],
+                          radial[gate * 2 + 1],
+                          distance);
+
+         EXPECT_LT(distance, 10.0) << "azimuth: " << azimuth
+                                  << ", gate: " << gate;
+      }
+   }
+}
+
+TEST(PolarCoordinateTable, RequestedGateCount)
+{
+   auto table = PolarCoordinateTable::Get(kParameters_);
+
+   const float        kSentinel = -999.0f;
+   std::vector<float> radial(table->gate_count() * 2 + 2, kSentinel);
+
+   // Gate count is limited to the table gate count
+   table->GetRadial(10.0f, table->gate_count() + 1, radial.data());
+
+   EXPECT_NE(radial[radial.size() - 3], kSentinel);
+   EXPECT_EQ(radial[radial.size() - 2], kSentinel);
+   EXPECT_EQ(radial[radial.size() - 1], kSentinel);
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,111 @@
+#include <scwx/qt/util/spatial_index.hpp>
+
+#include <random>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+TEST(SpatialIndex, Empty)
+{
+   SpatialIndex             index {};
+   std::vector<std::size_t> items {1u};
+
+   index.Query({0.0f, 0.0f}, 1.0f, items);
+
+   EXPECT_TRUE(index.empty());
+   EXPECT_TRUE(items.empty());
+}
+
+TEST(SpatialIndex, PixelOffset)
+{
+   SpatialIndex             index {};
+   std::vector<std::size_t> items {};
+
+   index.Build({SpatialIndex::CreateBounds({{10.0f, 10.0f}}, {{3.0f, 4.0f}}),
+                SpatialIndex::CreateBounds({{20.0f, 20.0f}, {30.0f, 25.0f}},
+                                           {{1.0f, 0.0f}})});
+
+   EXPECT_EQ(index.size(), 2u);
+
+   // The icon extends 5 pixels from its anchor
+   index.Query({12.0f, 10.0f}, 0.5f, items);
+   EXPECT_EQ(items, std::vector<std::size_t> {0u});
+
+   index.Query({12.0f, 10.0f}, 0.25f, items);
+   EXPECT_TRUE(items.empty());
+
+   // The line bounds include both end points
+   index.Query({25.0f, 22.0f}, 0.0f, items);
+   EXPECT_EQ(items, std::vector<std::size_t> {1u});
+
+   index.Query({31.0f, 25.0f}, 1.0f, items);
+   EXPECT_EQ(items, std::vector<std::size_t> {1u});
+
+   index.Clear();
+   index.Query({25.0f, 22.0f}, 0.0f, items);
+   EXPECT_TRUE(index.empty());
+   EXPECT_TRUE(items.empty());
+}
+
+TEST(SpatialIndex, MatchesLinearSearch)
+{
+   // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers)
+   std::mt19937                          generator {1234u};
+   std::uniform_real_distribution<float> position {0.0f, 360.0f};
+   std::uniform_real_distribution<float> length {0.0f, 5.0f};
+   std::uniform_real_distribution<float> offset {0.0f, 20.0f};
+
+   std::vector<SpatialIndex::Bounds> bounds {};
+
+   for (std::size_t i = 0; i < 1000u; ++i)
+   {
+      const glm::vec2 p1 {position(generator), position(generator)};
+      const glm::vec2 p2 {p1.x + length(generator), p1.y + length(generator)};
+
+      // Include a few very large items
+      const glm::vec2 p3 =
+         (i % 100u == 0u) ? glm::vec2 {p1.x + 200.0f, p1.y + 200.0f} : p2;
+
+      bounds.push_back(SpatialIndex::CreateBounds(
+         {p1, p3}, {{offset(generator), offset(generator)}}));
+   }
+
+   SpatialIndex index {};
+   index.Build(bounds);
+
+   std::vector<std::size_t> items {};
+   std::vector<std::size_t> expected {};
+   const float              pixelScale = 0.05f;
+
+   for (std::size_t i = 0; i < 1000u; ++i)
+   {
+      const glm::vec2 point {position(generator), position(generator)};
+
+      expected.clear();
+      for (std::size_t j = 0; j < bounds.size(); ++j)
+      {
+         const auto& b  = bounds[j];
+         const float bo = b.pixelOffset_ * pixelScale;
+
+         if (point.x >= b.min_.x - bo && point.x <= b.max_.x + bo &&
+             point.y >= b.min_.y - bo && point.y <= b.max_.y + bo)
+         {
+            expected.push_back(j);
+         }
+      }
+
+      index.Query(point, pixelScale, items);
+      EXPECT_EQ(items, expected);
+   }
+   // NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
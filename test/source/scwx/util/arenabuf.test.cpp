@@ -0,0 +1,96 @@
+#include <scwx/util/arenabuf.hpp>
+
+#include <cstring>
+#include <istream>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace util
+{
+
+class arenabuf_test : public ::testing::Test
+{
+protected:
+   arenabuf_test() :
+       arena_ {std::make_shared<std::vector<char>>(
+          std::initializer_list<char> {
+             'x', 's', 'm', 'i', 'l', 'e', 's', '\0', 'y'})},
+       ab_(arena_, 1, 7),
+       is_(&ab_),
+       Test()
+   {
+   }
+   ~arenabuf_test() = default;
+
+   std::shared_ptr<std::vector<char>> arena_;
+   arenabuf                           ab_;
+   std::istream                       is_;
+};
+
+TEST_F(arenabuf_test, smiles)
+{
+   char data[7];
+   is_.read(data, 7);
+
+   EXPECT_EQ(std::string(data), std::string("smiles"));
+   EXPECT_EQ(is_.eof(), false);
+   EXPECT_EQ(is_.fail(), false);
+
+   is_.read(data, 1);
+
+   EXPECT_EQ(is_.eof(), true);
+   EXPECT_EQ(is_.fail(), true);
+}
+
+TEST_F(arenabuf_test, seekg_begin)
+{
+   is_.seekg(1, std::ios_base::beg);
+
+   char data[7] = {0};
+   is_.read(data, 6);
+
+   EXPECT_EQ(std::string(data), std::string("miles"));
+   EXPECT_EQ(is_.fail(), false);
+}
+
+TEST_F(arenabuf_test, seekg_cur)
+{
+   char data[4] = {0};
+   is_.read(data, 1);
+   is_.seekg(2, std::ios_base::cur);
+   is_.read(data, 3);
+
+   EXPECT_EQ(std::string(data), std::string("les"));
+   EXPECT_EQ(is_.fail(), false);
+}
+
+TEST_F(arenabuf_test, seekg_end)
+{
+   is_.seekg(-4, std::ios_base::end);
+
+   char data[4] = {0};
+   is_.read(data, 3);
+
+   EXPECT_EQ(std::string(data), std::string("les"));
+   EXPECT_EQ(is_.fail(), false);
+}
+
+TEST_F(arenabuf_test, seekg_out_of_range)
+{
+   is_.seekg(8, std::ios_base::beg);
+
+   EXPECT_EQ(is_.fail(), true);
+}
+
+TEST_F(arenabuf_test, current)
+{
+   is_.seekg(2, std::ios_base::beg);
+
+   EXPECT_EQ(ab_.current(), arena_->data() + 3);
+   EXPECT_EQ(ab_.arena(), arena_);
+}
+
+} // namespace util
+} // namespace scwx
@@ -1,5 +1,7 @@
 #include <scwx/util/strings.hpp>
 
+#include <array>
+
 #include <gtest/gtest.h>
 
 namespace scwx
@@ -87,5 +89,47 @@ TEST(StringsTest, ParseTokensText)
    EXPECT_EQ(tokens[6], "discarded");
 }
 
+TEST(StringsTest, ParseTokensView)
+{
+   static const std::string line {
+      "Text: lat, lon, fontNumber, \"string, string\", \"hover, hover\", "
+      "remainder, remainder"};
+   static const std::size_t offset = std::string {"Text:"}.size();
+
+   std::array<std::string_view, 6> tokens {};
+   std::size_t                     tokenCount =
+      ParseTokens(line, ",", tokens, offset);
+
+   ASSERT_EQ(tokenCount, 6);
+   EXPECT_EQ(tokens[0], "lat");
+   EXPECT_EQ(tokens[1], "lon");
+   EXPECT_EQ(tokens[2], "fontNumber");
+   EXPECT_EQ(tokens[3], "\"string, string\"");
+   EXPECT_EQ(tokens[4], "\"hover, hover\"");
+   EXPECT_EQ(tokens[5], "remainder, remainder");
+
+   // Tokens are views into the input string
+   EXPECT_EQ(tokens[0].data(), line.data() + line.find("lat"));
+
+   tokenCount = ParseTokens("  1.5 ,  -2.5  ", ",", tokens);
+
+   ASSERT_EQ(tokenCount, 2);
+   EXPECT_EQ(tokens[0], "1.5");
+   EXPECT_EQ(tokens[1], "-2.5");
+}
+
+TEST(StringsTest, ParseNumeric)
+{
+   EXPECT_EQ(ParseNumeric<double>("35.25"), 35.25);
+   EXPECT_EQ(ParseNumeric<double>(" +35.25"), 35.25);
+   EXPECT_EQ(ParseNumeric<double>("-97.5 trailing"), -97.5);
+   EXPECT_EQ(ParseNumeric<std::int32_t>("-12"), -12);
+   EXPECT_EQ(ParseNumeric<std::size_t>("12.5"), 12u);
+
+   EXPECT_THROW(ParseNumeric<double>(""), std::invalid_argument);
+   EXPECT_THROW(ParseNumeric<double>("lat"), std::invalid_argument);
+   EXPECT_THROW(ParseNumeric<std::int32_t>("99999999999"), std::out_of_range);
+}
+
 } // namespace util
 } // namespace scwx
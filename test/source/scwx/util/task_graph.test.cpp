@@ -0,0 +1,99 @@
+#include <scwx/util/task_graph.hpp>
+
+#include <latch>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace util
+{
+
+TEST(TaskGraphTest, DependencyOrder)
+{
+   boost::asio::thread_pool threadPool {4};
+   TaskGraph                graph {"Test"};
+
+   std::mutex               mutex {};
+   std::vector<std::string> order {};
+   std::thread::id          callerThreadId {};
+
+   auto Record = [&](const std::string& name)
+   {
+      return [&, name]()
+      {
+         const std::unique_lock lock {mutex};
+         order.push_back(name);
+      };
+   };
+
+   graph.AddTask("a", Record("a"));
+   graph.AddTask("b", Record("b"), {"a"});
+   graph.AddTask(
+      "c",
+      [&]()
+      {
+         callerThreadId = std::this_thread::get_id();
+         Record("c")();
+      },
+      {"a"},
+      TaskGraph::Thread::Caller);
+   graph.AddTask("d", Record("d"), {"b", "c"});
+
+   graph.Run(threadPool);
+
+   ASSERT_EQ(order.size(), 4u);
+   EXPECT_EQ(order.front(), "a");
+   EXPECT_EQ(order.back(), "d");
+   EXPECT_EQ(callerThreadId, std::this_thread::get_id());
+
+   auto timings = graph.timings();
+   ASSERT_EQ(timings.size(), 4u);
+   EXPECT_EQ(timings[0].name_, "a");
+   EXPECT_GE(timings[3].start_, timings[1].start_ + timings[1].duration_);
+
+   threadPool.join();
+}
+
+TEST(TaskGraphTest, Parallel)
+{
+   boost::asio::thread_pool threadPool {2};
+   TaskGraph                graph {"Test"};
+
+   // Each task waits for the other to start, and would never complete if the
+   // tasks were run one at a time
+   std::latch latch {2};
+
+   graph.AddTask("a", [&]() { latch.arrive_and_wait(); });
+   graph.AddTask("b", [&]() { latch.arrive_and_wait(); });
+
+   graph.Run(threadPool);
+
+   threadPool.join();
+}
+
+TEST(TaskGraphTest, Exception)
+{
+   boost::asio::thread_pool threadPool {2};
+   TaskGraph                graph {"Test"};
+
+   bool dependentRun = false;
+
+   graph.AddTask("a", []() { throw std::runtime_error("Test"); });
+   graph.AddTask("b", [&]() { dependentRun = true; }, {"a"});
+
+   EXPECT_THROW(graph.Run(threadPool), std::runtime_error);
+   EXPECT_TRUE(dependentRun);
+
+   EXPECT_THROW(graph.AddTask("c", []() {}, {"unknown"}),
+                std::invalid_argument);
+   EXPECT_THROW(graph.AddTask("a", []() {}), std::invalid_argument);
+
+   threadPool.join();
+}
+
+} // namespace util
+} // namespace scwx
@@ -1,4 +1,10 @@
 #include <scwx/wsr88d/level3_file.hpp>
+#include <scwx/wsr88d/rpg/generic_radial_data_packet.hpp>
+#include <scwx/wsr88d/rpg/graphic_product_message.hpp>
+
+#include <chrono>
+#include <fstream>
+#include <sstream>
 
 #include <gtest/gtest.h>
 
@@ -91,5 +97,84 @@ INSTANTIATE_TEST_SUITE_P(
       std::pair<int16_t, std::string> {186,
                                        "Level3_STL_TZL_20211211_0200.nids"}));
 
+class Level3ParseBenchmarkTest : public testing::TestWithParam<std::string>
+{
+};
+
+TEST_P(Level3ParseBenchmarkTest, ParseTime)
+{
+   static constexpr int kIterations_ = 20;
+
+   const std::string filename {GetParam()};
+
+   // Read the file once, so only parsing is measured
+   std::ifstream f(std::string(SCWX_TEST_DATA_DIR) + "/nexrad/level3/" +
+                      filename,
+                   std::ios_base::in | std::ios_base::binary);
+   ASSERT_TRUE(f.good());
+
+   std::stringstream buffer;
+   buffer << f.rdbuf();
+   const std::string data = buffer.str();
+
+   std::shared_ptr<rpg::Level3Message> message {};
+
+   auto start = std::chrono::steady_clock::now();
+
+   for (int i = 0; i < kIterations_; ++i)
+   {
+      Level3File         file;
+      std::istringstream is {data};
+
+      ASSERT_TRUE(file.LoadData(is));
+      message = file.message();
+   }
+
+   auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - start);
+
+   RecordProperty("ParseTimeUs",
+                  static_cast<int>(elapsed.count() / kIterations_));
+   RecordProperty("Bytes", static_cast<int>(data.size()));
+
+   // Radial levels are stored one per range bin
+   auto graphicMessage =
+      std::dynamic_pointer_cast<rpg::GraphicProductMessage>(message);
+   ASSERT_NE(graphicMessage, nullptr);
+
+   auto symbologyBlock = graphicMessage->symbology_block();
+   ASSERT_NE(symbologyBlock, nullptr);
+
+   for (std::uint16_t layer = 0; layer < symbologyBlock->number_of_layers();
+        ++layer)
+   {
+      for (auto& packet : symbologyBlock->packet_list(layer))
+      {
+         auto radialData =
+            std::dynamic_pointer_cast<rpg::GenericRadialDataPacket>(packet);
+
+         if (radialData == nullptr)
+         {
+            continue;
+         }
+
+         for (std::uint16_t r = 0; r < radialData->number_of_radials(); ++r)
+         {
+            EXPECT_EQ(radialData->level(r).size(),
+                      radialData->number_of_range_bins());
+         }
+      }
+   }
+}
+
+INSTANTIATE_TEST_SUITE_P(Level3File,
+                         Level3ParseBenchmarkTest,
+                         testing::Values("LSX_N0B_2022_03_30_15_40_41",
+                                         "LSX_N0G_2022_03_30_15_40_41",
+                                         "KLSX_SDUS53_DHRLSX_202112110215",
+                                         "KLSX_SDUS53_DSPLSX_202112110109",
+                                         "KLSX_SDUS33_NSTLSX_202112110215",
+                                         "KLSX_SDUS83_HHCLSX_202112110140"));
+
 } // namespace wsr88d
 } // namespace scwx
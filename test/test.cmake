@@ -23,6 +23,7 @@ set(SRC_PROVIDER_TESTS source/scwx/provider/aws_level2_data_provider.test.cpp
                        source/scwx/provider/aws_level3_data_provider.test.cpp
                        source/scwx/provider/iem_api_provider.test.cpp
                        source/scwx/provider/nws_api_provider.test.cpp
+                       source/scwx/provider/object_cache.test.cpp
                        source/scwx/provider/warnings_provider.test.cpp)
 set(SRC_QT_CONFIG_TESTS source/scwx/qt/config/county_database.test.cpp
                         source/scwx/qt/config/radar_site.test.cpp)
@@ -34,12 +35,19 @@ set(SRC_QT_MODEL_TESTS source/scwx/qt/model/imgui_context_model.test.cpp
 set(SRC_QT_SETTINGS_TESTS source/scwx/qt/settings/settings_container.test.cpp
                           source/scwx/qt/settings/settings_variable.test.cpp)
 set(SRC_QT_UTIL_TESTS source/scwx/qt/util/q_file_input_stream.test.cpp
+                      source/scwx/qt/util/geographic_area_index.test.cpp
                       source/scwx/qt/util/geographic_lib.test.cpp
-                      source/scwx/qt/util/network.test.cpp)
-set(SRC_UTIL_TESTS source/scwx/util/float.test.cpp
+                      source/scwx/qt/util/loop_prefetch.test.cpp
+                      source/scwx/qt/util/moment_kernels.test.cpp
+                      source/scwx/qt/util/network.test.cpp
+                      source/scwx/qt/util/polar_coordinate_table.test.cpp
+                      source/scwx/qt/util/spatial_index.test.cpp)
+set(SRC_UTIL_TESTS source/scwx/util/arenabuf.test.cpp
+                   source/scwx/util/float.test.cpp
                    source/scwx/util/rangebuf.test.cpp
                    source/scwx/util/streams.test.cpp
                    source/scwx/util/strings.test.cpp
+                   source/scwx/util/task_graph.test.cpp
                    source/scwx/util/vectorbuf.test.cpp)
 set(SRC_WSR88D_TESTS source/scwx/wsr88d/ar2v_file.test.cpp
                      source/scwx/wsr88d/level3_file.test.cpp
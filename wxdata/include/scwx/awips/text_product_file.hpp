@@ -4,6 +4,7 @@
 
 #include <memory>
 #include <string>
+#include <string_view>
 
 namespace scwx::awips
 {
@@ -30,6 +31,18 @@ public:
    bool LoadFile(const std::string& filename);
    bool LoadData(const std::string& filename, std::istream& is);
 
+   /**
+    * @brief Loads messages from a contiguous buffer. The buffer is split into
+    * messages on end of text boundaries, and messages are parsed concurrently.
+    * Messages with a WMO header previously loaded are skipped.
+    *
+    * @param [in] filename Filename used to provide a date hint
+    * @param [in] data Text product data
+    *
+    * @return Whether the file contains any messages
+    */
+   bool LoadData(const std::string& filename, std::string_view data);
+
 private:
    class Impl;
    std::unique_ptr<Impl> p;
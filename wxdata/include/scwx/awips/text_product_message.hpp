@@ -12,6 +12,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <string_view>
 
 #include <boost/uuid/uuid.hpp>
 
@@ -62,7 +63,11 @@ struct Segment
 {
    std::shared_ptr<WmoHeader>             wmoHeader_ {};
    std::optional<SegmentHeader>           header_ {};
-   std::vector<std::string>               productContent_ {};
+
+   // Product content lines are views into the shared message buffer
+   std::shared_ptr<const std::string>     messageBuffer_ {};
+   std::vector<std::string_view>          productContent_ {};
+
    std::optional<CodedLocation>           codedLocation_ {};
    std::optional<CodedTimeMotionLocation> codedMotion_ {};
 
@@ -112,7 +117,20 @@ public:
 
    bool Parse(std::istream& is) override;
 
+   /**
+    * @brief Parses a single message from a contiguous buffer. The message is
+    * copied into a buffer owned by the message, and segment product content
+    * references lines in this buffer.
+    *
+    * @param [in] data Message data, from the start of the WMO header through
+    * the end of text
+    *
+    * @return Whether the message was valid
+    */
+   bool Parse(std::string_view data);
+
    static std::shared_ptr<TextProductMessage> Create(std::istream& is);
+   static std::shared_ptr<TextProductMessage> Create(std::string_view data);
 
 private:
    std::unique_ptr<TextProductMessageImpl> p;
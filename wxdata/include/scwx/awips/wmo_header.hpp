@@ -4,6 +4,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <unordered_set>
 
 namespace scwx::awips
 {
@@ -35,6 +36,12 @@ public:
 
    bool operator==(const WmoHeader& o) const;
 
+   /**
+    * @brief Get a hash of the WMO header. Headers which compare equal have
+    * equal hashes.
+    */
+   [[nodiscard]] std::size_t hash() const;
+
    [[nodiscard]] std::string sequence_number() const;
    [[nodiscard]] std::string data_type() const;
    [[nodiscard]] std::string geographic_designator() const;
@@ -84,4 +91,27 @@ private:
    std::unique_ptr<WmoHeaderImpl> p;
 };
 
+/**
+ * @brief Hashes WMO headers by value, for use in unordered containers of
+ * shared WMO headers.
+ */
+struct WmoHeaderHash
+{
+   std::size_t operator()(const std::shared_ptr<WmoHeader>& x) const;
+};
+
+/**
+ * @brief Compares WMO headers by value, for use in unordered containers of
+ * shared WMO headers.
+ */
+struct WmoHeaderEqual
+{
+   bool operator()(const std::shared_ptr<WmoHeader>& a,
+                   const std::shared_ptr<WmoHeader>& b) const;
+};
+
+using WmoHeaderSet = std::unordered_set<std::shared_ptr<WmoHeader>,
+                                        WmoHeaderHash,
+                                        WmoHeaderEqual>;
+
 } // namespace scwx::awips
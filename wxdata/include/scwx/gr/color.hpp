@@ -2,8 +2,8 @@
 
 #include <scwx/gr/gr_types.hpp>
 
-#include <string>
-#include <vector>
+#include <span>
+#include <string_view>
 
 #include <boost/gil/typedefs.hpp>
 
@@ -12,10 +12,11 @@ namespace scwx
 namespace gr
 {
 
-boost::gil::rgba8_pixel_t ParseColor(const std::vector<std::string>& tokenList,
-                                     std::size_t                     startIndex,
-                                     ColorMode                       colorMode,
-                                     bool hasAlpha = true);
+boost::gil::rgba8_pixel_t
+ParseColor(std::span<const std::string_view> tokenList,
+           std::size_t                       startIndex,
+           ColorMode                         colorMode,
+           bool                              hasAlpha = true);
 
 } // namespace gr
 } // namespace scwx
@@ -77,6 +77,13 @@ public:
       units::length::nautical_miles<double>       threshold_ {};
       std::chrono::sys_time<std::chrono::seconds> startTime_ {};
       std::chrono::sys_time<std::chrono::seconds> endTime_ {};
+
+      /**
+       * Hash of the statements and parsing state which produced the draw
+       * item. Draw items with equal hashes are identical, and can be matched
+       * across reloads of the placefile.
+       */
+      std::size_t hash_ {};
    };
 
    struct IconDrawItem : DrawItem
@@ -36,8 +36,6 @@ public:
    std::string RotateServer();
    void        RunOnce();
 
-   void WaitForInitialOffset();
-
    static std::shared_ptr<NtpClient> Instance();
 
 private:
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace scwx::provider
+{
+
+/**
+ * @brief Persistent on-disk cache of downloaded objects.
+ *
+ * Objects are stored under a name derived from the SHA-256 digest of their
+ * bucket and key, along with a digest of the object data which is verified on
+ * each read. Once the total size of the cache exceeds its budget, the least
+ * recently used objects are evicted.
+ *
+ * The cache is disabled until initialized with a directory.
+ */
+class ObjectCache
+{
+public:
+   explicit ObjectCache();
+   ~ObjectCache();
+
+   ObjectCache(const ObjectCache&)            = delete;
+   ObjectCache& operator=(const ObjectCache&) = delete;
+
+   ObjectCache(ObjectCache&&) noexcept;
+   ObjectCache& operator=(ObjectCache&&) noexcept;
+
+   /**
+    * @brief Enables the cache. Objects already present in the directory are
+    * indexed, and evicted if the cache exceeds the size budget.
+    *
+    * @param [in] directory Cache directory, created if it does not exist
+    * @param [in] maxSize Size budget in bytes
+    */
+   void Initialize(const std::string& directory, std::uintmax_t maxSize);
+
+   bool           enabled() const;
+   std::uintmax_t size() const;
+
+   /**
+    * @brief Gets an object from the cache. Objects failing the integrity check
+    * are removed from the cache.
+    *
+    * @param [in] bucket Object bucket
+    * @param [in] key Object key
+    *
+    * @return Object data, or nullptr if the object is not cached
+    */
+   std::shared_ptr<std::vector<char>> Get(const std::string& bucket,
+                                          const std::string& key);
+
+   /**
+    * @brief Stores an object in the cache.
+    *
+    * @param [in] bucket Object bucket
+    * @param [in] key Object key
+    * @param [in] data Object data
+    */
+   void Put(const std::string&       bucket,
+            const std::string&       key,
+            const std::vector<char>& data);
+
+   /**
+    * @brief Stores an object in the cache on a background thread. The object
+    * may not be available from the cache until the write completes.
+    *
+    * @param [in] bucket Object bucket
+    * @param [in] key Object key
+    * @param [in] data Object data, which must not be modified
+    */
+   void PutAsync(const std::string&                       bucket,
+                 const std::string&                       key,
+                 std::shared_ptr<const std::vector<char>> data);
+
+   static ObjectCache& Instance();
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace scwx::provider
@@ -20,6 +20,17 @@ public:
    WarningsProvider(WarningsProvider&&) noexcept;
    WarningsProvider& operator=(WarningsProvider&&) noexcept;
 
+   /**
+    * @brief Loads hourly warnings files which have been updated since the
+    * previous call. Warnings files are only appended to, so once a file has
+    * been loaded, only the bytes following the last complete message are
+    * requested, and each returned file contains only new messages.
+    *
+    * @param [in] newerThan First hour to query. If unset, the previous hour is
+    * queried.
+    *
+    * @return Files containing new messages
+    */
    std::vector<std::shared_ptr<awips::TextProductFile>>
    LoadUpdatedFiles(std::chrono::sys_time<std::chrono::hours> newerThan = {});
 
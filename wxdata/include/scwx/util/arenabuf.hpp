@@ -0,0 +1,49 @@
+#pragma once
+
+#include <memory>
+#include <streambuf>
+#include <vector>
+
+namespace scwx
+{
+namespace util
+{
+
+/**
+ * @brief Read-only stream buffer over a range of a shared, contiguous arena.
+ *
+ * Parsers may detect this buffer type to reference arena memory directly
+ * instead of copying it, sharing ownership of the arena to keep the memory
+ * valid for the lifetime of the parsed object.
+ */
+class arenabuf : public std::streambuf
+{
+public:
+   arenabuf(std::shared_ptr<std::vector<char>> arena,
+            std::size_t                        offset,
+            std::size_t                        size);
+   ~arenabuf() = default;
+
+   arenabuf(const arenabuf&)            = delete;
+   arenabuf& operator=(const arenabuf&) = delete;
+
+   const std::shared_ptr<std::vector<char>>& arena() const;
+   char*                                     current() const;
+
+protected:
+   pos_type
+   seekoff(std::streamoff          off,
+           std::ios_base::seekdir  way,
+           std::ios_base::openmode which = std::ios_base::in |
+                                           std::ios_base::out) override;
+   pos_type
+   seekpos(pos_type                pos,
+           std::ios_base::openmode which = std::ios_base::in |
+                                           std::ios_base::out) override;
+
+private:
+   std::shared_ptr<std::vector<char>> arena_;
+};
+
+} // namespace util
+} // namespace scwx
@@ -2,7 +2,9 @@
 
 #include <cstdint>
 #include <optional>
+#include <span>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace scwx
@@ -35,19 +37,69 @@ std::string BytesToString(std::ptrdiff_t bytes);
  *
  * @return Tokenized string
  */
-std::vector<std::string> ParseTokens(const std::string&       s,
-                                     std::vector<std::string> delimiters,
-                                     std::size_t              pos = 0);
+std::vector<std::string> ParseTokens(const std::string&              s,
+                                     const std::vector<std::string>& delimiters,
+                                     std::size_t                     pos = 0);
+
+/**
+ * @brief Parse a list of tokens from a string without allocating
+ *
+ * This function tokenizes the input string in the same manner as the vector
+ * overload, using the same set of delimiters for each token. Up to
+ * tokens.size() tokens are parsed, and the final token contains the remainder
+ * of the string. Tokens are views into the input string, and are trimmed of
+ * any whitespace.
+ *
+ * @param [in] s Input string to tokenize
+ * @param [in] delimiters Delimiters to use for each token
+ * @param [out] tokens Parsed tokens
+ * @param [in] pos Search begin position. Default is 0.
+ *
+ * @return Number of tokens parsed
+ */
+std::size_t ParseTokens(std::string_view            s,
+                        std::string_view            delimiters,
+                        std::span<std::string_view> tokens,
+                        std::size_t                 pos = 0);
+
+/**
+ * @brief Trim leading and trailing whitespace from a string
+ *
+ * @param [in] s Input string
+ *
+ * @return View of the input string without leading and trailing whitespace
+ */
+std::string_view Trim(std::string_view s);
 
 std::string ToString(const std::vector<std::string>& v);
 
 template<typename T>
 std::optional<T> TryParseNumeric(const std::string& str);
 
+/**
+ * @brief Parse a number from the beginning of a string
+ *
+ * Leading whitespace and a leading plus sign are skipped, and characters
+ * following the number are ignored, consistent with std::stod and std::stoi.
+ *
+ * @param [in] str Input string
+ *
+ * @return Parsed number
+ *
+ * @throws std::invalid_argument if no number could be parsed
+ * @throws std::out_of_range if the number is out of range of the type
+ */
+template<typename T>
+T ParseNumeric(std::string_view str);
+
 #if defined(STRINGS_IMPLEMENTATION)
 template std::optional<std::uint16_t> TryParseNumeric(const std::string& str);
 template std::optional<std::uint32_t> TryParseNumeric(const std::string& str);
 template std::optional<float>         TryParseNumeric(const std::string& str);
+
+template std::int32_t ParseNumeric(std::string_view str);
+template std::size_t  ParseNumeric(std::string_view str);
+template double       ParseNumeric(std::string_view str);
 #endif
 
 } // namespace util
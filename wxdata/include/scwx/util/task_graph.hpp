@@ -0,0 +1,87 @@
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/asio/thread_pool.hpp>
+
+namespace scwx
+{
+namespace util
+{
+
+/**
+ * @brief Runs a set of tasks in dependency order. Each task starts once all of
+ * its dependencies have completed, and independent tasks run in parallel.
+ * Tasks run on a thread pool, or on the thread calling Run() if they must run
+ * on that thread (e.g., the Qt GUI thread).
+ */
+class TaskGraph
+{
+public:
+   enum class Thread
+   {
+      Pool,
+      Caller
+   };
+
+   struct TaskTiming
+   {
+      std::string                         name_;
+      std::chrono::steady_clock::duration start_; // Since Run() was called
+      std::chrono::steady_clock::duration duration_;
+   };
+
+   explicit TaskGraph(const std::string& name);
+   ~TaskGraph();
+
+   TaskGraph(const TaskGraph&)            = delete;
+   TaskGraph& operator=(const TaskGraph&) = delete;
+
+   TaskGraph(TaskGraph&&) noexcept;
+   TaskGraph& operator=(TaskGraph&&) noexcept;
+
+   /**
+    * @brief Adds a task to the graph. Dependencies must be added before the
+    * tasks depending on them.
+    *
+    * @param [in] name Unique task name
+    * @param [in] task Task function
+    * @param [in] dependencies Names of tasks which must complete first
+    * @param [in] thread Thread to run the task on
+    *
+    * @throw std::invalid_argument if the name is not unique, or a dependency
+    * has not been added
+    */
+   void AddTask(const std::string&              name,
+                std::function<void()>           task,
+                const std::vector<std::string>& dependencies = {},
+                Thread                          thread       = Thread::Pool);
+
+   /**
+    * @brief Runs all tasks, and waits for them to complete. Tasks depending on
+    * a task which throws an exception still run. The time taken by each task
+    * is logged once all tasks have completed.
+    *
+    * @param [in] threadPool Thread pool to run tasks on
+    *
+    * @throw The first exception thrown by a task
+    */
+   void Run(boost::asio::thread_pool& threadPool);
+
+   /**
+    * @brief Gets the start time and duration of each task from the last run,
+    * in the order the tasks were added.
+    */
+   std::vector<TaskTiming> timings() const;
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace util
+} // namespace scwx
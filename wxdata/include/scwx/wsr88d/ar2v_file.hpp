@@ -32,14 +32,25 @@ public:
    Ar2vFile(Ar2vFile&&) noexcept;
    Ar2vFile& operator=(Ar2vFile&&) noexcept;
 
-   Ar2vFile(const std::shared_ptr<Ar2vFile>& current,
-            const std::shared_ptr<Ar2vFile>& last);
+   /**
+    * @brief Constructs a file indexing the most recent scans of a volume in
+    * progress, with incomplete elevation scans merged with the previous scan.
+    *
+    * @param [in] current Volume scan in progress
+    * @param [in] last Previous volume scan
+    * @param [in] previous A file previously constructed from the same scans.
+    * Merged elevation scans which have not changed since are reused.
+    */
+   Ar2vFile(const std::shared_ptr<Ar2vFile>&       current,
+            const std::shared_ptr<Ar2vFile>&       last,
+            const std::shared_ptr<const Ar2vFile>& previous = nullptr);
 
    std::uint32_t julian_date() const;
    std::uint32_t milliseconds() const;
    std::string   icao() const;
 
    std::size_t message_count() const;
+   std::size_t memory_usage() const override;
 
    std::chrono::system_clock::time_point start_time() const;
    std::chrono::system_clock::time_point end_time() const;
@@ -28,6 +28,7 @@ public:
 
    std::shared_ptr<awips::WmoHeader>   wmo_header() const;
    std::shared_ptr<rpg::Level3Message> message() const;
+   std::size_t                         memory_usage() const override;
 
    bool LoadFile(const std::string& filename);
    bool LoadData(std::istream& is);
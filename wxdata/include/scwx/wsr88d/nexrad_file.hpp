@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <string>
 
@@ -24,6 +25,13 @@ protected:
 public:
    virtual ~NexradFile();
 
+   /**
+    * @brief Estimates the memory used by the loaded data.
+    *
+    * @return Approximate size in bytes
+    */
+   virtual std::size_t memory_usage() const = 0;
+
    virtual bool LoadFile(const std::string& filename) = 0;
    virtual bool LoadData(std::istream& is)            = 0;
 
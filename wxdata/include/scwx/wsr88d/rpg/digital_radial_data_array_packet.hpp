@@ -36,9 +36,9 @@ public:
    float    range_scale_factor() const;
    uint16_t number_of_radials() const override;
 
-   float                       start_angle(uint16_t r) const override;
-   float                       delta_angle(uint16_t r) const override;
-   const std::vector<uint8_t>& level(uint16_t r) const override;
+   float                    start_angle(uint16_t r) const override;
+   float                    delta_angle(uint16_t r) const override;
+   std::span<const uint8_t> level(uint16_t r) const override;
 
    size_t data_size() const override;
 
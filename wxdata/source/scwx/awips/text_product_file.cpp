@@ -1,7 +1,12 @@
 #include <scwx/awips/text_product_file.hpp>
+#include <scwx/common/characters.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <algorithm>
+#include <execution>
 #include <fstream>
+#include <iterator>
+#include <numeric>
 
 #include <re2/re2.h>
 
@@ -11,6 +16,11 @@ namespace scwx::awips
 static const std::string logPrefix_ = "scwx::awips::text_product_file";
 static const auto        logger_    = util::Logger::Create(logPrefix_);
 
+// Padding which may appear between messages
+static constexpr std::string_view kMessagePadding_ {"\0\r\n", 3};
+
+static std::vector<std::string_view> SplitMessages(std::string_view data);
+
 class TextProductFile::Impl
 {
 public:
@@ -24,6 +34,7 @@ public:
    Impl& operator=(Impl&&) = delete;
 
    std::vector<std::shared_ptr<TextProductMessage>> messages_;
+   WmoHeaderSet                                     wmoHeaders_ {};
 };
 
 TextProductFile::TextProductFile() :
@@ -73,6 +84,15 @@ bool TextProductFile::LoadFile(const std::string& filename)
 }
 
 bool TextProductFile::LoadData(const std::string& filename, std::istream& is)
+{
+   const std::string data {std::istreambuf_iterator<char>(is),
+                           std::istreambuf_iterator<char>()};
+
+   return LoadData(filename, data);
+}
+
+bool TextProductFile::LoadData(const std::string& filename,
+                               std::string_view   data)
 {
    static constexpr LazyRE2 kDateTimePattern_ = {
       R"(((?:19|20)\d{2}))"      // Year (YYYY)
@@ -94,40 +114,68 @@ bool TextProductFile::LoadData(const std::string& filename, std::istream& is)
       yearMonth = std::chrono::year {year} / std::chrono::month {month};
    }
 
-   while (!is.eof())
+   const std::vector<std::string_view> messageData = SplitMessages(data);
+   std::vector<std::shared_ptr<TextProductMessage>> messages(
+      messageData.size());
+
+   std::vector<std::size_t> messageIndices(messageData.size());
+   std::iota(messageIndices.begin(), messageIndices.end(), 0u);
+
+   // Messages are independent, parse concurrently
+   std::for_each(std::execution::par,
+                 messageIndices.cbegin(),
+                 messageIndices.cend(),
+                 [&messageData, &messages](std::size_t i)
+                 { messages[i] = TextProductMessage::Create(messageData[i]); });
+
+   // Merge messages in file order
+   for (auto& message : messages)
    {
-      std::shared_ptr<TextProductMessage> message =
-         TextProductMessage::Create(is);
-      bool duplicate = false;
+      if (message == nullptr)
+      {
+         logger_->trace("Skipping invalid message");
+         continue;
+      }
 
-      if (message != nullptr)
+      // Skip messages with a duplicate WMO header
+      if (p->wmoHeaders_.insert(message->wmo_header()).second)
       {
-         for (const auto& m : p->messages_)
+         if (yearMonth.has_value())
          {
-            if (*m->wmo_header().get() == *message->wmo_header().get())
-            {
-               duplicate = true;
-               break;
-            }
+            message->wmo_header()->SetDateHint(yearMonth.value());
          }
 
-         if (!duplicate)
-         {
-            if (yearMonth.has_value())
-            {
-               message->wmo_header()->SetDateHint(yearMonth.value());
-            }
-
-            p->messages_.push_back(message);
-         }
+         p->messages_.push_back(message);
       }
-      else
+   }
+
+   return !p->messages_.empty();
+}
+
+std::vector<std::string_view> SplitMessages(std::string_view data)
+{
+   std::vector<std::string_view> messages {};
+
+   while (!data.empty())
+   {
+      // Skip padding between messages
+      const std::size_t begin = data.find_first_not_of(kMessagePadding_);
+      if (begin == std::string_view::npos)
       {
          break;
       }
+      data.remove_prefix(begin);
+
+      // Each message ends with an end of text, or the end of the data
+      const std::size_t end  = data.find(common::Characters::ETX);
+      const std::size_t size = (end == std::string_view::npos) ? data.size() :
+                                                                  end + 1;
+
+      messages.push_back(data.substr(0, size));
+      data.remove_prefix(size);
    }
 
-   return !p->messages_.empty();
+   return messages;
 }
 
 } // namespace scwx::awips
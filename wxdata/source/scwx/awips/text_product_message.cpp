@@ -1,14 +1,16 @@
 #include <scwx/awips/text_product_message.hpp>
 #include <scwx/common/characters.hpp>
 #include <scwx/util/logger.hpp>
-#include <scwx/util/streams.hpp>
 
 #include <algorithm>
 #include <istream>
 #include <string>
+#include <string_view>
 
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/algorithm/string/trim.hpp>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/stream.hpp>
 #include <boost/uuid/random_generator.hpp>
 #include <re2/re2.h>
 
@@ -26,21 +28,56 @@ static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 // Look for hhmm (xM|UTC) to key the date/time string
 static constexpr LazyRE2 reDateTimeString = {"^[0-9]{3,4} ([AP]M|UTC)"};
 
+/**
+ * Line-oriented cursor over a contiguous message buffer. Lines are returned as
+ * views into the buffer, and are terminated by LF, CR (followed by any number
+ * of CR and an optional LF), or ETX (which is not consumed).
+ */
+class LineCursor
+{
+public:
+   explicit LineCursor(std::string_view data) : data_ {data} {}
+
+   [[nodiscard]] bool        eof() const { return position_ >= data_.size(); }
+   [[nodiscard]] std::size_t tell() const { return position_; }
+
+   void seek(std::size_t position) { position_ = position; }
+
+   [[nodiscard]] int peek() const
+   {
+      return eof() ? EOF : static_cast<unsigned char>(data_[position_]);
+   }
+
+   void get()
+   {
+      if (!eof())
+      {
+         ++position_;
+      }
+   }
+
+   std::string_view getline();
+
+private:
+   std::string_view data_;
+   std::size_t      position_ {0};
+};
+
 static void ParseCodedInformation(const std::shared_ptr<Segment>& segment,
                                   const std::string&              wfo);
-static std::vector<std::string>     ParseProductContent(std::istream& is);
-static void                         SkipBlankLines(std::istream& is);
-static bool                         TryParseEndOfProduct(std::istream& is);
-static std::vector<std::string>     TryParseMndHeader(std::istream& is);
-static std::vector<std::string>     TryParseOverviewBlock(std::istream& is);
-static std::optional<SegmentHeader> TryParseSegmentHeader(std::istream& is);
-static std::optional<Vtec>          TryParseVtecString(std::istream& is);
+static std::vector<std::string_view> ParseProductContent(LineCursor& cursor);
+static void                          SkipBlankLines(LineCursor& cursor);
+static bool                          TryParseEndOfProduct(LineCursor& cursor);
+static std::vector<std::string>      TryParseMndHeader(LineCursor& cursor);
+static std::vector<std::string>      TryParseOverviewBlock(LineCursor& cursor);
+static std::optional<SegmentHeader>  TryParseSegmentHeader(LineCursor& cursor);
+static std::optional<Vtec>           TryParseVtecString(LineCursor& cursor);
 
 class TextProductMessageImpl
 {
 public:
    explicit TextProductMessageImpl() :
-       messageContent_ {},
+       messageBuffer_ {},
        wmoHeader_ {},
        mndHeader_ {},
        overviewBlock_ {},
@@ -54,9 +91,11 @@ public:
    TextProductMessageImpl(const TextProductMessageImpl&&)            = delete;
    TextProductMessageImpl& operator=(const TextProductMessageImpl&&) = delete;
 
+   bool Parse(std::shared_ptr<const std::string> messageBuffer);
+
    boost::uuids::uuid uuid_ {boost::uuids::random_generator()()};
 
-   std::string                           messageContent_;
+   std::shared_ptr<const std::string>    messageBuffer_;
    std::shared_ptr<WmoHeader>            wmoHeader_;
    std::vector<std::string>              mndHeader_;
    std::vector<std::string>              overviewBlock_;
@@ -80,7 +119,29 @@ boost::uuids::uuid TextProductMessage::uuid() const
 
 std::string TextProductMessage::message_content() const
 {
-   return p->messageContent_;
+   if (p->messageBuffer_ == nullptr)
+   {
+      return {};
+   }
+
+   std::string_view content {*p->messageBuffer_};
+
+   // Trim extra characters from raw message
+   if (content.starts_with(common::Characters::SOH))
+   {
+      content.remove_prefix(1);
+   }
+   while (!content.empty() && (content.back() == common::Characters::NUL ||
+                               content.back() == common::Characters::ETX))
+   {
+      content.remove_suffix(1);
+   }
+
+   std::string messageContent {content};
+   boost::replace_all(messageContent, "\r\r\n", "\n");
+   boost::trim(messageContent);
+
+   return messageContent;
 }
 
 std::shared_ptr<WmoHeader> TextProductMessage::wmo_header() const
@@ -164,115 +225,142 @@ size_t TextProductMessage::data_size() const
 
 bool TextProductMessage::Parse(std::istream& is)
 {
-   bool dataValid = true;
+   // Read the remainder of the message, through the end of text
+   std::string data {};
+   std::getline(is, data, common::Characters::ETX);
+   if (!is.eof())
+   {
+      data.push_back(common::Characters::ETX);
+   }
+
+   return p->Parse(std::make_shared<const std::string>(std::move(data)));
+}
+
+bool TextProductMessage::Parse(std::string_view data)
+{
+   return p->Parse(std::make_shared<const std::string>(data));
+}
+
+bool TextProductMessageImpl::Parse(
+   std::shared_ptr<const std::string> messageBuffer)
+{
+   messageBuffer_ = std::move(messageBuffer);
+   mndHeader_.clear();
+   overviewBlock_.clear();
+   segments_.clear();
+
+   const std::string_view data {*messageBuffer_};
+   LineCursor             cursor {data};
 
-   std::streampos messageStart = is.tellg();
+   // Parse the WMO header from a stream over the message buffer
+   boost::iostreams::stream<boost::iostreams::array_source> headerStream {
+      data.data(), data.size()};
 
-   p->wmoHeader_ = std::make_shared<WmoHeader>();
-   dataValid     = p->wmoHeader_->Parse(is);
+   wmoHeader_     = std::make_shared<WmoHeader>();
+   bool dataValid = wmoHeader_->Parse(headerStream);
 
-   for (size_t i = 0; dataValid && !is.eof(); i++)
+   if (dataValid)
    {
-      if (i != 0 && TryParseEndOfProduct(is))
+      cursor.seek(static_cast<std::size_t>(headerStream.tellg()));
+   }
+
+   for (size_t i = 0; dataValid && !cursor.eof(); i++)
+   {
+      if (i != 0 && TryParseEndOfProduct(cursor))
       {
          break;
       }
 
       std::shared_ptr<Segment> segment = std::make_shared<Segment>();
-      segment->wmoHeader_              = p->wmoHeader_;
+      segment->wmoHeader_              = wmoHeader_;
+      segment->messageBuffer_          = messageBuffer_;
 
       if (i == 0)
       {
-         if (is.peek() != '\r' && is.peek() != '\n')
+         if (cursor.peek() != '\r' && cursor.peek() != '\n')
          {
-            segment->header_ = TryParseSegmentHeader(is);
+            segment->header_ = TryParseSegmentHeader(cursor);
          }
 
-         SkipBlankLines(is);
+         SkipBlankLines(cursor);
 
-         p->mndHeader_ = TryParseMndHeader(is);
-         SkipBlankLines(is);
+         mndHeader_ = TryParseMndHeader(cursor);
+         SkipBlankLines(cursor);
 
          // Optional overview block appears between MND and segment header
          if (!segment->header_.has_value())
          {
-            p->overviewBlock_ = TryParseOverviewBlock(is);
-            SkipBlankLines(is);
+            overviewBlock_ = TryParseOverviewBlock(cursor);
+            SkipBlankLines(cursor);
          }
       }
 
       if (!segment->header_.has_value())
       {
-         segment->header_ = TryParseSegmentHeader(is);
-         SkipBlankLines(is);
+         segment->header_ = TryParseSegmentHeader(cursor);
+         SkipBlankLines(cursor);
       }
 
-      segment->productContent_ = ParseProductContent(is);
-      SkipBlankLines(is);
+      segment->productContent_ = ParseProductContent(cursor);
+      SkipBlankLines(cursor);
 
-      ParseCodedInformation(segment, p->wmoHeader_->icao());
+      ParseCodedInformation(segment, wmoHeader_->icao());
 
       if (segment->header_.has_value() || !segment->productContent_.empty())
       {
-         p->segments_.push_back(std::move(segment));
+         segments_.push_back(std::move(segment));
       }
    }
 
-   if (dataValid)
+   if (!dataValid)
    {
-      // Store raw message content
-      if (is.good())
+      messageBuffer_.reset();
+      segments_.clear();
+   }
+
+   return dataValid;
+}
+
+std::string_view LineCursor::getline()
+{
+   const std::size_t begin = position_;
+
+   while (position_ < data_.size())
+   {
+      switch (data_[position_])
       {
-         // Read content equal to the message size
-         std::streampos  messageEnd  = is.tellg();
-         std::streamsize messageSize = messageEnd - messageStart;
-         p->messageContent_.resize(messageEnd - messageStart);
-         is.seekg(messageStart);
-         if (is.peek() == common::Characters::SOH)
-         {
-            is.seekg(std::streamoff {1}, std::ios_base::cur);
-            messageSize--;
-         }
-         is.read(p->messageContent_.data(), messageSize);
-      }
-      else
+      case '\n':
+         return data_.substr(begin, position_++ - begin);
+
+      case '\r':
       {
-         // Read remaining content in the input stream
-         is.clear();
-         is.seekg(messageStart);
-         if (is.peek() == common::Characters::SOH)
+         const std::string_view line = data_.substr(begin, position_ - begin);
+
+         // Consume repeated carriage returns, and an optional line feed
+         while (++position_ < data_.size() && data_[position_] == '\r') {}
+         if (position_ < data_.size() && data_[position_] == '\n')
          {
-            is.seekg(std::streamoff {1}, std::ios_base::cur);
+            ++position_;
          }
 
-         constexpr std::istreambuf_iterator<char> eos;
-         p->messageContent_ = {std::istreambuf_iterator<char>(is), eos};
+         return line;
       }
 
-      // Trim extra characters from raw message
-      while (p->messageContent_.size() > 0 &&
-             (p->messageContent_.back() == common::Characters::NUL ||
-              p->messageContent_.back() == common::Characters::ETX))
-      {
-         p->messageContent_.resize(p->messageContent_.size() - 1);
+      case common::Characters::ETX:
+         return data_.substr(begin, position_ - begin);
+
+      default:
+         ++position_;
       }
-      boost::replace_all(p->messageContent_, "\r\r\n", "\n");
-      boost::trim(p->messageContent_);
-      p->messageContent_.shrink_to_fit();
-   }
-   else
-   {
-      p->messageContent_.resize(0);
-      p->messageContent_.shrink_to_fit();
    }
 
-   return dataValid;
+   return data_.substr(begin);
 }
 
 void ParseCodedInformation(const std::shared_ptr<Segment>& segment,
                            const std::string&              wfo)
 {
-   typedef std::vector<std::string>::const_iterator StringIterator;
+   typedef std::vector<std::string_view>::const_iterator StringIterator;
 
    static constexpr std::size_t kThreatCategoryTagCount = 4;
    static const std::array<std::string, kThreatCategoryTagCount>
@@ -282,7 +370,8 @@ void ParseCodedInformation(const std::shared_ptr<Segment>& segment,
                            "TORNADO DAMAGE THREAT..."};
    std::array<std::string, kThreatCategoryTagCount>::const_iterator threatTagIt;
 
-   std::vector<std::string>& productContent = segment->productContent_;
+   const std::vector<std::string_view>& productContent =
+      segment->productContent_;
 
    StringIterator codedLocationBegin = productContent.cend();
    StringIterator codedLocationEnd   = productContent.cend();
@@ -339,8 +428,8 @@ void ParseCodedInformation(const std::shared_ptr<Segment>& segment,
                it->length() > threatTagIt->length())
       // NOLINTEND(bugprone-assignment-in-if-condition)
       {
-         const std::string threatCategoryName =
-            it->substr(threatTagIt->length());
+         const std::string threatCategoryName {
+            it->substr(threatTagIt->length())};
 
          ibw::ThreatCategory threatCategory =
             ibw::GetThreatCategory(threatCategoryName);
@@ -367,25 +456,27 @@ void ParseCodedInformation(const std::shared_ptr<Segment>& segment,
 
    if (codedLocationBegin != productContent.cend())
    {
-      segment->codedLocation_ =
-         CodedLocation::Create({codedLocationBegin, codedLocationEnd}, wfo);
+      const std::vector<std::string> codedLocation(codedLocationBegin,
+                                                   codedLocationEnd);
+      segment->codedLocation_ = CodedLocation::Create(codedLocation, wfo);
    }
 
    if (codedMotionBegin != productContent.cend())
    {
-      segment->codedMotion_ = CodedTimeMotionLocation::Create(
-         {codedMotionBegin, codedMotionEnd}, wfo);
+      const std::vector<std::string> codedMotion(codedMotionBegin,
+                                                 codedMotionEnd);
+      segment->codedMotion_ = CodedTimeMotionLocation::Create(codedMotion, wfo);
    }
 }
 
-std::vector<std::string> ParseProductContent(std::istream& is)
+std::vector<std::string_view> ParseProductContent(LineCursor& cursor)
 {
-   std::vector<std::string> productContent;
-   std::string              line;
+   std::vector<std::string_view> productContent;
+   std::string_view              line;
 
-   while (!is.eof() && is.peek() != common::Characters::ETX)
+   while (!cursor.eof() && cursor.peek() != common::Characters::ETX)
    {
-      util::getline(is, line);
+      line = cursor.getline();
 
       if (!productContent.empty() || !line.starts_with("$$"))
       {
@@ -407,28 +498,25 @@ std::vector<std::string> ParseProductContent(std::istream& is)
    return productContent;
 }
 
-void SkipBlankLines(std::istream& is)
+void SkipBlankLines(LineCursor& cursor)
 {
-   std::string line;
-
-   while (is.peek() == '\r' || is.peek() == '\n')
+   while (cursor.peek() == '\r' || cursor.peek() == '\n')
    {
-      util::getline(is, line);
+      cursor.getline();
    }
 }
 
-bool TryParseEndOfProduct(std::istream& is)
+bool TryParseEndOfProduct(LineCursor& cursor)
 {
-   std::string    line;
-   std::streampos isBegin     = is.tellg();
-   bool           endOfStream = false;
+   const std::size_t cursorBegin = cursor.tell();
+   bool              endOfStream = false;
 
-   if (is.peek() == common::Characters::ETX)
+   if (cursor.peek() == common::Characters::ETX)
    {
-      is.get();
+      cursor.get();
       endOfStream = true;
    }
-   else if (is.peek() == EOF)
+   else if (cursor.peek() == EOF)
    {
       endOfStream = true;
    }
@@ -436,15 +524,15 @@ bool TryParseEndOfProduct(std::istream& is)
    if (!endOfStream)
    {
       // Optional Forecast Identifier
-      util::getline(is, line);
-      SkipBlankLines(is);
+      cursor.getline();
+      SkipBlankLines(cursor);
 
-      if (is.peek() == common::Characters::ETX)
+      if (cursor.peek() == common::Characters::ETX)
       {
-         is.get();
+         cursor.get();
          endOfStream = true;
       }
-      else if (is.peek() == EOF)
+      else if (cursor.peek() == EOF)
       {
          endOfStream = true;
       }
@@ -452,24 +540,22 @@ bool TryParseEndOfProduct(std::istream& is)
 
    if (!endOfStream)
    {
-      // End of Product was not found, so reset the istream to the original
+      // End of Product was not found, so reset the cursor to the original
       // state
-      is.seekg(isBegin, std::ios_base::beg);
+      cursor.seek(cursorBegin);
    }
 
    return endOfStream;
 }
 
-std::vector<std::string> TryParseMndHeader(std::istream& is)
+std::vector<std::string> TryParseMndHeader(LineCursor& cursor)
 {
    std::vector<std::string> mndHeader;
-   std::string              line;
-   std::streampos           isBegin = is.tellg();
+   const std::size_t        cursorBegin = cursor.tell();
 
-   while (!is.eof() && is.peek() != '\r' && is.peek() != '\n')
+   while (!cursor.eof() && cursor.peek() != '\r' && cursor.peek() != '\n')
    {
-      util::getline(is, line);
-      mndHeader.push_back(line);
+      mndHeader.emplace_back(cursor.getline());
    }
 
    if (!mndHeader.empty() &&
@@ -481,35 +567,33 @@ std::vector<std::string> TryParseMndHeader(std::istream& is)
 
    if (mndHeader.empty())
    {
-      // MND header was not found, so reset the istream to the original state
-      is.seekg(isBegin, std::ios_base::beg);
+      // MND header was not found, so reset the cursor to the original state
+      cursor.seek(cursorBegin);
    }
 
    return mndHeader;
 }
 
-std::vector<std::string> TryParseOverviewBlock(std::istream& is)
+std::vector<std::string> TryParseOverviewBlock(LineCursor& cursor)
 {
    // Optional overview block contains text in the following format:
    // ...OVERVIEW HEADLINE... /OPTIONAL/
    // .OVERVIEW WITH GENERAL INFORMATION / OPTIONAL /
    // Key off the block beginning with .
    std::vector<std::string> overviewBlock;
-   std::string              line;
 
-   if (is.peek() == '.')
+   if (cursor.peek() == '.')
    {
-      while (!is.eof() && is.peek() != '\r' && is.peek() != '\n')
+      while (!cursor.eof() && cursor.peek() != '\r' && cursor.peek() != '\n')
       {
-         util::getline(is, line);
-         overviewBlock.push_back(line);
+         overviewBlock.emplace_back(cursor.getline());
       }
    }
 
    return overviewBlock;
 }
 
-std::optional<SegmentHeader> TryParseSegmentHeader(std::istream& is)
+std::optional<SegmentHeader> TryParseSegmentHeader(LineCursor& cursor)
 {
    // UGC takes the form SSFNNN-NNN>NNN-SSFNNN-DDHHMM- (NWSI 10-1702)
    // Look for SSF(NNN)?[->] to key the UGC string
@@ -517,23 +601,22 @@ std::optional<SegmentHeader> TryParseSegmentHeader(std::istream& is)
    static constexpr LazyRE2 reUgcString     = {"^[A-Z]{2}[CZ]([0-9]{3})?[->]"};
    static constexpr LazyRE2 reUgcExpiration = {"[0-9]{6}-$"};
 
-   std::optional<SegmentHeader> header = std::nullopt;
-   std::string                  line;
-   std::streampos               isBegin = is.tellg();
+   std::optional<SegmentHeader> header      = std::nullopt;
+   const std::size_t            cursorBegin = cursor.tell();
 
-   util::getline(is, line);
+   std::string_view line = cursor.getline();
 
    if (RE2::PartialMatch(line, *reUgcString))
    {
       header = SegmentHeader();
-      header->ugcString_.push_back(line);
+      header->ugcString_.emplace_back(line);
 
       // If UGC is multi-line, continue parsing
-      while (!is.eof() && is.peek() != '\r' && is.peek() != '\n' &&
+      while (!cursor.eof() && cursor.peek() != '\r' && cursor.peek() != '\n' &&
              !RE2::PartialMatch(line, *reUgcExpiration))
       {
-         util::getline(is, line);
-         header->ugcString_.push_back(line);
+         line = cursor.getline();
+         header->ugcString_.emplace_back(line);
       }
 
       // Parse UGC
@@ -543,21 +626,21 @@ std::optional<SegmentHeader> TryParseSegmentHeader(std::istream& is)
    if (header.has_value())
    {
       std::optional<Vtec> vtec;
-      while ((vtec = TryParseVtecString(is)) != std::nullopt)
+      while ((vtec = TryParseVtecString(cursor)) != std::nullopt)
       {
          header->vtecString_.push_back(std::move(*vtec));
       }
 
-      while (!is.eof() && is.peek() != '\r' && is.peek() != '\n')
+      while (!cursor.eof() && cursor.peek() != '\r' && cursor.peek() != '\n')
       {
-         util::getline(is, line);
+         line = cursor.getline();
          if (!RE2::PartialMatch(line, *reDateTimeString))
          {
-            header->ugcNames_.push_back(line);
+            header->ugcNames_.emplace_back(line);
          }
          else
          {
-            header->issuanceDateTime_.swap(line);
+            header->issuanceDateTime_ = line;
             break;
          }
       }
@@ -565,15 +648,15 @@ std::optional<SegmentHeader> TryParseSegmentHeader(std::istream& is)
 
    if (!header.has_value())
    {
-      // We did not find a valid segment header, so we reset the istream to the
+      // We did not find a valid segment header, so we reset the cursor to the
       // original state
-      is.seekg(isBegin, std::ios_base::beg);
+      cursor.seek(cursorBegin);
    }
 
    return header;
 }
 
-std::optional<Vtec> TryParseVtecString(std::istream& is)
+std::optional<Vtec> TryParseVtecString(LineCursor& cursor)
 {
    // P-VTEC takes the form /k.aaa.cccc.pp.s.####.yymmddThhnnZB-yymmddThhnnZE/
    // (NWSI 10-1703)
@@ -585,30 +668,29 @@ std::optional<Vtec> TryParseVtecString(std::istream& is)
    // Look for /nwsli. to key the H-VTEC string
    static constexpr LazyRE2 reHVtecString = {"^/[A-Z0-9]{5}\\."};
 
-   std::optional<Vtec> vtec = std::nullopt;
-   std::string         line;
-   std::streampos      isBegin = is.tellg();
+   std::optional<Vtec> vtec        = std::nullopt;
+   std::size_t         cursorBegin = cursor.tell();
 
-   util::getline(is, line);
+   std::string_view line = cursor.getline();
 
    if (RE2::PartialMatch(line, *rePVtecString))
    {
       vtec                 = Vtec();
-      const bool vtecValid = vtec->pVtec_.Parse(line);
+      const bool vtecValid = vtec->pVtec_.Parse(std::string {line});
 
-      isBegin = is.tellg();
+      cursorBegin = cursor.tell();
 
-      util::getline(is, line);
+      line = cursor.getline();
 
       if (RE2::PartialMatch(line, *reHVtecString))
       {
-         vtec->hVtec_.swap(line);
+         vtec->hVtec_ = line;
       }
       else
       {
-         // H-VTEC was not found, so reset the istream to the beginning of
-         // the line
-         is.seekg(isBegin, std::ios_base::beg);
+         // H-VTEC was not found, so reset the cursor to the beginning of the
+         // line
+         cursor.seek(cursorBegin);
       }
 
       if (!vtecValid)
@@ -618,8 +700,8 @@ std::optional<Vtec> TryParseVtecString(std::istream& is)
    }
    else
    {
-      // P-VTEC was not found, so reset the istream to the original state
-      is.seekg(isBegin, std::ios_base::beg);
+      // P-VTEC was not found, so reset the cursor to the original state
+      cursor.seek(cursorBegin);
    }
 
    return vtec;
@@ -638,4 +720,18 @@ std::shared_ptr<TextProductMessage> TextProductMessage::Create(std::istream& is)
    return message;
 }
 
+std::shared_ptr<TextProductMessage>
+TextProductMessage::Create(std::string_view data)
+{
+   std::shared_ptr<TextProductMessage> message =
+      std::make_shared<TextProductMessage>();
+
+   if (!message->Parse(data))
+   {
+      message.reset();
+   }
+
+   return message;
+}
+
 } // namespace scwx::awips
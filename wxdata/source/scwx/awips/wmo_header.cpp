@@ -12,6 +12,8 @@
 #   include <arpa/inet.h>
 #endif
 
+#include <boost/container_hash/hash.hpp>
+
 namespace scwx::awips
 {
 
@@ -93,6 +95,33 @@ bool WmoHeaderImpl::operator==(const WmoHeaderImpl& o) const
            productDesignator_ == o.productDesignator_);
 }
 
+std::size_t WmoHeader::hash() const
+{
+   std::size_t seed = 0;
+   boost::hash_combine(seed, p->sequenceNumber_);
+   boost::hash_combine(seed, p->dataType_);
+   boost::hash_combine(seed, p->geographicDesignator_);
+   boost::hash_combine(seed, p->bulletinId_);
+   boost::hash_combine(seed, p->icao_);
+   boost::hash_combine(seed, p->dateTime_);
+   boost::hash_combine(seed, p->bbbIndicator_);
+   boost::hash_combine(seed, p->productCategory_);
+   boost::hash_combine(seed, p->productDesignator_);
+   return seed;
+}
+
+std::size_t
+WmoHeaderHash::operator()(const std::shared_ptr<WmoHeader>& x) const
+{
+   return x->hash();
+}
+
+bool WmoHeaderEqual::operator()(const std::shared_ptr<WmoHeader>& a,
+                                const std::shared_ptr<WmoHeader>& b) const
+{
+   return *a == *b;
+}
+
 std::string WmoHeader::sequence_number() const
 {
    return p->sequenceNumber_;
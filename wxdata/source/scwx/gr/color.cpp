@@ -1,4 +1,5 @@
 #include <scwx/gr/color.hpp>
+#include <scwx/util/strings.hpp>
 
 #include <limits>
 
@@ -12,12 +13,13 @@ namespace gr
 template<typename T>
 T RoundChannel(double value);
 template<typename T>
-T StringToDecimal(const std::string& str);
+T StringToDecimal(std::string_view str);
 
-boost::gil::rgba8_pixel_t ParseColor(const std::vector<std::string>& tokenList,
-                                     std::size_t                     startIndex,
-                                     ColorMode                       colorMode,
-                                     bool                            hasAlpha)
+boost::gil::rgba8_pixel_t
+ParseColor(std::span<const std::string_view> tokenList,
+           std::size_t                       startIndex,
+           ColorMode                         colorMode,
+           bool                              hasAlpha)
 {
 
    std::uint8_t r {};
@@ -47,9 +49,9 @@ boost::gil::rgba8_pixel_t ParseColor(const std::vector<std::string>& tokenList,
 
       if (tokenList.size() >= startIndex + 3)
       {
-         h = std::stod(tokenList[startIndex + 0]);
-         s = std::stod(tokenList[startIndex + 1]);
-         l = std::stod(tokenList[startIndex + 2]);
+         h = util::ParseNumeric<double>(tokenList[startIndex + 0]);
+         s = util::ParseNumeric<double>(tokenList[startIndex + 1]);
+         l = util::ParseNumeric<double>(tokenList[startIndex + 2]);
       }
 
       double dr;
@@ -75,11 +77,12 @@ T RoundChannel(double value)
 }
 
 template<typename T>
-T StringToDecimal(const std::string& str)
+T StringToDecimal(std::string_view str)
 {
-   return static_cast<T>(std::clamp<int>(std::stoi(str),
-                                         std::numeric_limits<T>::min(),
-                                         std::numeric_limits<T>::max()));
+   return static_cast<T>(
+      std::clamp<std::int32_t>(util::ParseNumeric<std::int32_t>(str),
+                               std::numeric_limits<T>::min(),
+                               std::numeric_limits<T>::max()));
 }
 
 } // namespace gr
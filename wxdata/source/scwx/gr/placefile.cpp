@@ -14,11 +14,14 @@
 #include <scwx/util/streams.hpp>
 #include <scwx/util/strings.hpp>
 
+#include <array>
 #include <fstream>
 #include <sstream>
+#include <string_view>
 #include <unordered_map>
 
 #include <boost/algorithm/string.hpp>
+#include <boost/container_hash/hash.hpp>
 
 #if (__cpp_lib_chrono < 201907L)
 #   include <date/date.h>
@@ -54,18 +57,20 @@ public:
       double y_ {};
    };
 
-   void ParseLocation(const std::string& latitudeToken,
-                      const std::string& longitudeToken,
-                      double&            latitude,
-                      double&            longitude,
-                      double&            x,
-                      double&            y);
-   void ProcessElement(const std::string& line);
+   void ParseLocation(std::string_view latitudeToken,
+                      std::string_view longitudeToken,
+                      double&          latitude,
+                      double&          longitude,
+                      double&          x,
+                      double&          y);
+   void ProcessElement(std::string_view line);
    void ProcessElementEnd();
-   void ProcessLine(const std::string& line);
+   void ProcessLine(std::string_view line);
 
-   static void ProcessEscapeCharacters(std::string& s);
-   static void TrimQuotes(std::string& s);
+   std::size_t HashStatement(std::string_view line) const;
+
+   static void             ProcessEscapeCharacters(std::string& s);
+   static std::string_view TrimQuotes(std::string_view s);
 
    std::string          name_ {};
    std::string          title_ {};
@@ -176,6 +181,8 @@ std::shared_ptr<Placefile> Placefile::Load(const std::string& name,
    std::string line;
    while (scwx::util::getline(is, line))
    {
+      std::string_view lineView {line};
+
       // Find position of comment (;)
       bool inQuotes = false;
       for (std::size_t i = 0; i < line.size(); ++i)
@@ -183,7 +190,7 @@ std::shared_ptr<Placefile> Placefile::Load(const std::string& name,
          if (!inQuotes && line[i] == ';')
          {
             // Remove comment
-            line.erase(i);
+            lineView = lineView.substr(0, i);
             break;
          }
          else if (line[i] == '"')
@@ -194,16 +201,16 @@ std::shared_ptr<Placefile> Placefile::Load(const std::string& name,
       }
 
       // Remove extra spacing from line
-      boost::trim(line);
+      lineView = util::Trim(lineView);
 
-      if (line.size() >= 1)
+      if (lineView.size() >= 1)
       {
          try
          {
             switch (placefile->p->currentStatement_)
             {
             case DrawingStatement::Standard:
-               placefile->p->ProcessLine(line);
+               placefile->p->ProcessLine(lineView);
                break;
 
             case DrawingStatement::Line:
@@ -211,7 +218,7 @@ std::shared_ptr<Placefile> Placefile::Load(const std::string& name,
             case DrawingStatement::Image:
             case DrawingStatement::ImageXY:
             case DrawingStatement::Polygon:
-               if (boost::istarts_with(line, "End:"))
+               if (boost::istarts_with(lineView, "End:"))
                {
                   placefile->p->ProcessElementEnd();
 
@@ -220,14 +227,14 @@ std::shared_ptr<Placefile> Placefile::Load(const std::string& name,
                }
                else if (placefile->p->currentDrawItem_ != nullptr)
                {
-                  placefile->p->ProcessElement(line);
+                  placefile->p->ProcessElement(lineView);
                }
                break;
             }
          }
          catch (const std::exception&)
          {
-            logger_->warn("Could not parse line: {}", line);
+            logger_->warn("Could not parse line: {}", lineView);
          }
       }
    }
@@ -235,7 +242,7 @@ std::shared_ptr<Placefile> Placefile::Load(const std::string& name,
    return placefile;
 }
 
-void Placefile::Impl::ProcessLine(const std::string& line)
+void Placefile::Impl::ProcessLine(std::string_view line)
 {
    static const std::string titleKey_ {"Title:"};
    static const std::string thresholdKey_ {"Threshold:"};
@@ -267,29 +274,30 @@ void Placefile::Impl::ProcessLine(const std::string& line)
    if (boost::istarts_with(line, titleKey_))
    {
       // Title: title
-      title_ = line.substr(titleKey_.size());
-      boost::trim(title_);
+      title_ = util::Trim(line.substr(titleKey_.size()));
    }
    else if (boost::istarts_with(line, thresholdKey_))
    {
       // Threshold: nautical_miles
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {" "}, thresholdKey_.size());
+      std::array<std::string_view, 2> tokenList {};
+      const std::size_t               tokenCount =
+         util::ParseTokens(line, " ", tokenList, thresholdKey_.size());
 
-      if (tokenList.size() >= 1)
+      if (tokenCount >= 1)
       {
-         threshold_ =
-            units::length::nautical_miles<double>(std::stod(tokenList[0]));
+         threshold_ = units::length::nautical_miles<double>(
+            util::ParseNumeric<double>(tokenList[0]));
       }
    }
    else if (boost::istarts_with(line, timeRangeKey_))
    {
       // TimeRange: start_time end_time
       //   (YYYY-MM-DDThh:mm:ss)
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {" ", " "}, timeRangeKey_.size());
+      std::array<std::string_view, 3> tokenList {};
+      const std::size_t               tokenCount =
+         util::ParseTokens(line, " ", tokenList, timeRangeKey_.size());
 
-      if (tokenList.size() >= 2)
+      if (tokenCount >= 2)
       {
          using namespace std::chrono;
 
@@ -299,8 +307,8 @@ void Placefile::Impl::ProcessLine(const std::string& line)
 
          static const std::string dateTimeFormat {"%Y-%m-%dT%H:%M:%S"};
 
-         std::istringstream ssStartTime {tokenList[0]};
-         std::istringstream ssEndTime {tokenList[1]};
+         std::istringstream ssStartTime {std::string {tokenList[0]}};
+         std::istringstream ssEndTime {std::string {tokenList[1]}};
 
          std::chrono::sys_time<seconds> startTime;
          std::chrono::sys_time<seconds> endTime;
@@ -329,10 +337,11 @@ void Placefile::Impl::ProcessLine(const std::string& line)
    else if (boost::istarts_with(line, hsluvKey_))
    {
       // HSLuv: value
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {" "}, hsluvKey_.size());
+      std::array<std::string_view, 2> tokenList {};
+      const std::size_t               tokenCount =
+         util::ParseTokens(line, " ", tokenList, hsluvKey_.size());
 
-      if (tokenList.size() >= 1)
+      if (tokenCount >= 1)
       {
          if (boost::iequals(tokenList[0], "true"))
          {
@@ -347,55 +356,63 @@ void Placefile::Impl::ProcessLine(const std::string& line)
    else if (boost::istarts_with(line, colorKey_))
    {
       // Color: red green blue [alpha]
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {" ", " ", " ", " "}, colorKey_.size());
+      std::array<std::string_view, 5> tokenList {};
+      const std::size_t               tokenCount =
+         util::ParseTokens(line, " ", tokenList, colorKey_.size());
 
-      if (tokenList.size() >= 3)
+      if (tokenCount >= 3)
       {
-         color_ = ParseColor(tokenList, 0, colorMode_);
+         color_ = ParseColor({tokenList.data(), tokenCount}, 0, colorMode_);
       }
    }
    else if (boost::istarts_with(line, scwxModulateIconKey_))
    {
       // Supercell Wx Extension
       // scwx-ModulateIcon: red green blue [alpha]
-      std::vector<std::string> tokenList = util::ParseTokens(
-         line, {" ", " ", " ", " "}, scwxModulateIconKey_.size());
+      std::array<std::string_view, 5> tokenList {};
+      const std::size_t               tokenCount =
+         util::ParseTokens(line, " ", tokenList, scwxModulateIconKey_.size());
 
-      if (tokenList.size() >= 3)
+      if (tokenCount >= 3)
       {
-         iconModulate_ = ParseColor(tokenList, 0, colorMode_);
+         iconModulate_ =
+            ParseColor({tokenList.data(), tokenCount}, 0, colorMode_);
       }
    }
    else if (boost::istarts_with(line, refreshKey_))
    {
       // Refresh: minutes
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {" "}, refreshKey_.size());
+      std::array<std::string_view, 2> tokenList {};
+      const std::size_t               tokenCount =
+         util::ParseTokens(line, " ", tokenList, refreshKey_.size());
 
-      if (tokenList.size() >= 1)
+      if (tokenCount >= 1)
       {
-         refresh_ = std::chrono::minutes {std::stoi(tokenList[0])};
+         refresh_ = std::chrono::minutes {
+            util::ParseNumeric<std::int32_t>(tokenList[0])};
       }
    }
    else if (boost::istarts_with(line, refreshSecondsKey_))
    {
       // RefreshSeconds: seconds
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {" "}, refreshSecondsKey_.size());
+      std::array<std::string_view, 2> tokenList {};
+      const std::size_t               tokenCount =
+         util::ParseTokens(line, " ", tokenList, refreshSecondsKey_.size());
 
-      if (tokenList.size() >= 1)
+      if (tokenCount >= 1)
       {
-         refresh_ = std::chrono::seconds {std::stoi(tokenList[0])};
+         refresh_ = std::chrono::seconds {
+            util::ParseNumeric<std::int32_t>(tokenList[0])};
       }
    }
    else if (boost::istarts_with(line, placeKey_))
    {
       // Place: latitude, longitude, string with spaces
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {",", ","}, placeKey_.size());
+      std::array<std::string_view, 3> tokenList {};
+      const std::size_t               tokenCount =
+         util::ParseTokens(line, ",", tokenList, placeKey_.size());
 
-      if (tokenList.size() >= 3)
+      if (tokenCount >= 3)
       {
          std::shared_ptr<TextDrawItem> di = std::make_shared<TextDrawItem>();
 
@@ -403,6 +420,7 @@ void Placefile::Impl::ProcessLine(const std::string& line)
          di->color_     = color_;
          di->startTime_ = startTime_;
          di->endTime_   = endTime_;
+         di->hash_      = HashStatement(line);
 
          ParseLocation(tokenList[0],
                        tokenList[1],
@@ -411,8 +429,8 @@ void Placefile::Impl::ProcessLine(const std::string& line)
                        di->x_,
                        di->y_);
 
-         ProcessEscapeCharacters(tokenList[2]);
-         di->text_.swap(tokenList[2]);
+         di->text_ = tokenList[2];
+         ProcessEscapeCharacters(di->text_);
 
          drawItems_.emplace_back(std::move(di));
       }
@@ -424,21 +442,21 @@ void Placefile::Impl::ProcessLine(const std::string& line)
    else if (boost::istarts_with(line, iconFileKey_))
    {
       // IconFile: fileNumber, iconWidth, iconHeight, hotX, hotY, fileName
-      std::vector<std::string> tokenList = util::ParseTokens(
-         line, {",", ",", ",", ",", ","}, iconFileKey_.size());
+      std::array<std::string_view, 6> tokenList {};
+      const std::size_t               tokenCount =
+         util::ParseTokens(line, ",", tokenList, iconFileKey_.size());
 
-      if (tokenList.size() >= 6)
+      if (tokenCount >= 6)
       {
          std::shared_ptr<IconFile> iconFile = std::make_shared<IconFile>();
 
-         iconFile->fileNumber_ = std::stoul(tokenList[0]);
-         iconFile->iconWidth_  = std::stoul(tokenList[1]);
-         iconFile->iconHeight_ = std::stoul(tokenList[2]);
-         iconFile->hotX_       = std::stoul(tokenList[3]);
-         iconFile->hotY_       = std::stoul(tokenList[4]);
+         iconFile->fileNumber_ = util::ParseNumeric<std::size_t>(tokenList[0]);
+         iconFile->iconWidth_  = util::ParseNumeric<std::size_t>(tokenList[1]);
+         iconFile->iconHeight_ = util::ParseNumeric<std::size_t>(tokenList[2]);
+         iconFile->hotX_       = util::ParseNumeric<std::size_t>(tokenList[3]);
+         iconFile->hotY_       = util::ParseNumeric<std::size_t>(tokenList[4]);
 
-         TrimQuotes(tokenList[5]);
-         iconFile->filename_.swap(tokenList[5]);
+         iconFile->filename_ = TrimQuotes(tokenList[5]);
 
          iconFiles_.insert_or_assign(iconFile->fileNumber_, iconFile);
       }
@@ -450,18 +468,20 @@ void Placefile::Impl::ProcessLine(const std::string& line)
    else if (boost::istarts_with(line, iconKey_))
    {
       // Icon: lat, lon, angle, fileNumber, iconNumber, hoverText
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {",", ",", ",", ",", ","}, iconKey_.size());
+      std::array<std::string_view, 6> tokenList {};
+      const std::size_t               tokenCount =
+         util::ParseTokens(line, ",", tokenList, iconKey_.size());
 
       std::shared_ptr<IconDrawItem> di = nullptr;
 
-      if (tokenList.size() >= 5)
+      if (tokenCount >= 5)
       {
          di = std::make_shared<IconDrawItem>();
 
          di->threshold_ = threshold_;
          di->startTime_ = startTime_;
          di->endTime_   = endTime_;
+         di->hash_      = HashStatement(line);
          di->modulate_  = iconModulate_;
 
          ParseLocation(tokenList[0],
@@ -471,16 +491,16 @@ void Placefile::Impl::ProcessLine(const std::string& line)
                        di->x_,
                        di->y_);
 
-         di->angle_ = units::angle::degrees<double>(std::stod(tokenList[2]));
+         di->angle_ = units::angle::degrees<double>(
+            util::ParseNumeric<double>(tokenList[2]));
 
-         di->fileNumber_ = std::stoul(tokenList[3]);
-         di->iconNumber_ = std::stoul(tokenList[4]);
+         di->fileNumber_ = util::ParseNumeric<std::size_t>(tokenList[3]);
+         di->iconNumber_ = util::ParseNumeric<std::size_t>(tokenList[4]);
       }
-      if (tokenList.size() >= 6)
+      if (tokenCount >= 6)
       {
-         ProcessEscapeCharacters(tokenList[5]);
-         TrimQuotes(tokenList[5]);
-         di->hoverText_.swap(tokenList[5]);
+         di->hoverText_ = TrimQuotes(tokenList[5]);
+         ProcessEscapeCharacters(di->hoverText_);
       }
 
       if (di != nullptr)
@@ -495,19 +515,19 @@ void Placefile::Impl::ProcessLine(const std::string& line)
    else if (boost::istarts_with(line, fontKey_))
    {
       // Font: fontNumber, pixels, flags, "face"
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {",", ",", ",", ","}, fontKey_.size());
+      std::array<std::string_view, 5> tokenList {};
+      const std::size_t               tokenCount =
+         util::ParseTokens(line, ",", tokenList, fontKey_.size());
 
-      if (tokenList.size() >= 4)
+      if (tokenCount >= 4)
       {
          std::shared_ptr<Font> font = std::make_shared<Font>();
 
-         font->fontNumber_ = std::stoul(tokenList[0]);
-         font->pixels_     = std::stoul(tokenList[1]);
-         font->flags_      = std::stoi(tokenList[2]);
+         font->fontNumber_ = util::ParseNumeric<std::size_t>(tokenList[0]);
+         font->pixels_     = util::ParseNumeric<std::size_t>(tokenList[1]);
+         font->flags_      = util::ParseNumeric<std::int32_t>(tokenList[2]);
 
-         TrimQuotes(tokenList[3]);
-         font->face_.swap(tokenList[3]);
+         font->face_ = TrimQuotes(tokenList[3]);
 
          fonts_.insert_or_assign(font->fontNumber_, font);
       }
@@ -519,12 +539,13 @@ void Placefile::Impl::ProcessLine(const std::string& line)
    else if (boost::istarts_with(line, textKey_))
    {
       // Text: lat, lon, fontNumber, "string", "hover"
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {",", ",", ",", ",", ","}, textKey_.size());
+      std::array<std::string_view, 6> tokenList {};
+      const std::size_t               tokenCount =
+         util::ParseTokens(line, ",", tokenList, textKey_.size());
 
       std::shared_ptr<TextDrawItem> di = nullptr;
 
-      if (tokenList.size() >= 4)
+      if (tokenCount >= 4)
       {
          di = std::make_shared<TextDrawItem>();
 
@@ -532,6 +553,7 @@ void Placefile::Impl::ProcessLine(const std::string& line)
          di->color_     = color_;
          di->startTime_ = startTime_;
          di->endTime_   = endTime_;
+         di->hash_      = HashStatement(line);
 
          ParseLocation(tokenList[0],
                        tokenList[1],
@@ -540,17 +562,15 @@ void Placefile::Impl::ProcessLine(const std::string& line)
                        di->x_,
                        di->y_);
 
-         di->fontNumber_ = std::stoul(tokenList[2]);
+         di->fontNumber_ = util::ParseNumeric<std::size_t>(tokenList[2]);
 
-         ProcessEscapeCharacters(tokenList[3]);
-         TrimQuotes(tokenList[3]);
-         di->text_.swap(tokenList[3]);
+         di->text_ = TrimQuotes(tokenList[3]);
+         ProcessEscapeCharacters(di->text_);
       }
-      if (tokenList.size() >= 5)
+      if (tokenCount >= 5)
       {
-         ProcessEscapeCharacters(tokenList[4]);
-         TrimQuotes(tokenList[4]);
-         di->hoverText_.swap(tokenList[4]);
+         di->hoverText_ = TrimQuotes(tokenList[4]);
+         ProcessEscapeCharacters(di->hoverText_);
       }
 
       if (di != nullptr)
@@ -567,16 +587,17 @@ void Placefile::Impl::ProcessLine(const std::string& line)
       // Object: lat, lon
       //    ...
       // End:
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {",", ","}, objectKey_.size());
+      std::array<std::string_view, 3> tokenList {};
+      const std::size_t               tokenCount =
+         util::ParseTokens(line, ",", tokenList, objectKey_.size());
 
       double latitude {};
       double longitude {};
 
-      if (tokenList.size() >= 2)
+      if (tokenCount >= 2)
       {
-         latitude  = std::stod(tokenList[0]);
-         longitude = std::stod(tokenList[1]);
+         latitude  = util::ParseNumeric<double>(tokenList[0]);
+         longitude = util::ParseNumeric<double>(tokenList[1]);
       }
       else
       {
@@ -599,14 +620,15 @@ void Placefile::Impl::ProcessLine(const std::string& line)
       //    lat, lon
       //    ...
       // End:
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {",", ","}, lineKey_.size());
+      std::array<std::string_view, 3> tokenList {};
+      const std::size_t               tokenCount =
+         util::ParseTokens(line, ",", tokenList, lineKey_.size());
 
       currentStatement_ = DrawingStatement::Line;
 
       std::shared_ptr<LineDrawItem> di = nullptr;
 
-      if (tokenList.size() >= 2)
+      if (tokenCount >= 2)
       {
          di = std::make_shared<LineDrawItem>();
 
@@ -614,19 +636,19 @@ void Placefile::Impl::ProcessLine(const std::string& line)
          di->color_     = color_;
          di->startTime_ = startTime_;
          di->endTime_   = endTime_;
+         di->hash_      = HashStatement(line);
 
-         di->width_ = std::stoul(tokenList[0]);
+         di->width_ = util::ParseNumeric<std::size_t>(tokenList[0]);
 
          if (!tokenList[1].empty())
          {
-            di->flags_ = std::stoul(tokenList[1]);
+            di->flags_ = util::ParseNumeric<std::int32_t>(tokenList[1]);
          }
       }
-      if (tokenList.size() >= 3)
+      if (tokenCount >= 3)
       {
-         ProcessEscapeCharacters(tokenList[2]);
-         TrimQuotes(tokenList[2]);
-         di->hoverText_.swap(tokenList[2]);
+         di->hoverText_ = TrimQuotes(tokenList[2]);
+         ProcessEscapeCharacters(di->hoverText_);
       }
 
       if (di != nullptr)
@@ -654,6 +676,7 @@ void Placefile::Impl::ProcessLine(const std::string& line)
       di->color_     = color_;
       di->startTime_ = startTime_;
       di->endTime_   = endTime_;
+      di->hash_      = HashStatement(line);
 
       currentDrawItem_ = di;
       drawItems_.emplace_back(std::move(di));
@@ -664,23 +687,24 @@ void Placefile::Impl::ProcessLine(const std::string& line)
       //    lat, lon, Tu [, Tv ]
       //    ...
       // End:
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {" "}, imageKey_.size());
+      std::array<std::string_view, 2> tokenList {};
+      const std::size_t               tokenCount =
+         util::ParseTokens(line, " ", tokenList, imageKey_.size());
 
       currentStatement_ = DrawingStatement::Image;
 
       std::shared_ptr<ImageDrawItem> di = nullptr;
 
-      if (tokenList.size() >= 1)
+      if (tokenCount >= 1)
       {
          di = std::make_shared<ImageDrawItem>();
 
          di->threshold_ = threshold_;
          di->startTime_ = startTime_;
          di->endTime_   = endTime_;
+         di->hash_      = HashStatement(line);
 
-         TrimQuotes(tokenList[0]);
-         di->imageFile_.swap(tokenList[0]);
+         di->imageFile_ = TrimQuotes(tokenList[0]);
 
          currentDrawItem_ = di;
          drawItems_.emplace_back(std::move(di));
@@ -696,23 +720,24 @@ void Placefile::Impl::ProcessLine(const std::string& line)
       //    x, y, ax, ay, Tu [, Tv ]
       //    ...
       // End:
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {" "}, scwxImageXYKey_.size());
+      std::array<std::string_view, 2> tokenList {};
+      const std::size_t               tokenCount =
+         util::ParseTokens(line, " ", tokenList, scwxImageXYKey_.size());
 
       currentStatement_ = DrawingStatement::ImageXY;
 
       std::shared_ptr<ImageXYDrawItem> di = nullptr;
 
-      if (tokenList.size() >= 1)
+      if (tokenCount >= 1)
       {
          di = std::make_shared<ImageXYDrawItem>();
 
          di->threshold_ = threshold_;
          di->startTime_ = startTime_;
          di->endTime_   = endTime_;
+         di->hash_      = HashStatement(line);
 
-         TrimQuotes(tokenList[0]);
-         di->imageFile_.swap(tokenList[0]);
+         di->imageFile_ = TrimQuotes(tokenList[0]);
 
          currentDrawItem_ = di;
          drawItems_.emplace_back(std::move(di));
@@ -742,6 +767,7 @@ void Placefile::Impl::ProcessLine(const std::string& line)
       di->color_     = color_;
       di->startTime_ = startTime_;
       di->endTime_   = endTime_;
+      di->hash_      = HashStatement(line);
 
       currentDrawItem_ = di;
       drawItems_.emplace_back(std::move(di));
@@ -752,8 +778,11 @@ void Placefile::Impl::ProcessLine(const std::string& line)
    }
 }
 
-void Placefile::Impl::ProcessElement(const std::string& line)
+void Placefile::Impl::ProcessElement(std::string_view line)
 {
+   // Each element contributes to the identity of the draw item
+   boost::hash_combine(currentDrawItem_->hash_, line);
+
    // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers)
 
    if (currentStatement_ == DrawingStatement::Line)
@@ -762,9 +791,11 @@ void Placefile::Impl::ProcessElement(const std::string& line)
       //    lat, lon
       //    ...
       // End:
-      std::vector<std::string> tokenList = util::ParseTokens(line, {",", ","});
+      std::array<std::string_view, 3> tokenList {};
+      const std::size_t               tokenCount =
+         util::ParseTokens(line, ",", tokenList);
 
-      if (tokenList.size() >= 2)
+      if (tokenCount >= 2)
       {
          LineDrawItem::Element element;
 
@@ -789,17 +820,19 @@ void Placefile::Impl::ProcessElement(const std::string& line)
       //    lat, lon [, r, g, b [,a]]
       //    ...
       // End:
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {",", ",", ",", ",", ",", ","});
+      std::array<std::string_view, 7> tokenList {};
+      const std::size_t               tokenCount =
+         util::ParseTokens(line, ",", tokenList);
 
       TrianglesDrawItem::Element element;
 
-      if (tokenList.size() >= 5)
+      if (tokenCount >= 5)
       {
-         element.color_ = ParseColor(tokenList, 2, colorMode_);
+         element.color_ =
+            ParseColor({tokenList.data(), tokenCount}, 2, colorMode_);
       }
 
-      if (tokenList.size() >= 2)
+      if (tokenCount >= 2)
       {
          ParseLocation(tokenList[0],
                        tokenList[1],
@@ -822,12 +855,13 @@ void Placefile::Impl::ProcessElement(const std::string& line)
       //    lat, lon, Tu [, Tv ]
       //    ...
       // End:
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {",", ",", ",", ","});
+      std::array<std::string_view, 5> tokenList {};
+      const std::size_t               tokenCount =
+         util::ParseTokens(line, ",", tokenList);
 
       ImageDrawItem::Element element;
 
-      if (tokenList.size() >= 3)
+      if (tokenCount >= 3)
       {
          ParseLocation(tokenList[0],
                        tokenList[1],
@@ -836,19 +870,19 @@ void Placefile::Impl::ProcessElement(const std::string& line)
                        element.x_,
                        element.y_);
 
-         element.tu_ = std::stod(tokenList[2]);
+         element.tu_ = util::ParseNumeric<double>(tokenList[2]);
       }
 
-      if (tokenList.size() >= 4)
+      if (tokenCount >= 4)
       {
-         element.tv_ = std::stod(tokenList[3]);
+         element.tv_ = util::ParseNumeric<double>(tokenList[3]);
       }
       else
       {
          element.tv_ = element.tu_;
       }
 
-      if (tokenList.size() >= 3)
+      if (tokenCount >= 3)
       {
          std::static_pointer_cast<ImageDrawItem>(currentDrawItem_)
             ->elements_.emplace_back(std::move(element));
@@ -864,30 +898,31 @@ void Placefile::Impl::ProcessElement(const std::string& line)
       //    x, y, ax, ay, Tu [, Tv ]
       //    ...
       // End:
-      const std::vector<std::string> tokenList =
-         util::ParseTokens(line, {",", ",", ",", ",", ",", ","});
+      std::array<std::string_view, 7> tokenList {};
+      const std::size_t               tokenCount =
+         util::ParseTokens(line, ",", tokenList);
 
       ImageXYDrawItem::Element element;
 
-      if (tokenList.size() >= 5)
+      if (tokenCount >= 5)
       {
-         element.x_       = std::stod(tokenList[0]);
-         element.y_       = std::stod(tokenList[1]);
-         element.anchorX_ = std::stod(tokenList[2]);
-         element.anchorY_ = std::stod(tokenList[3]);
-         element.tu_      = std::stod(tokenList[4]);
+         element.x_       = util::ParseNumeric<double>(tokenList[0]);
+         element.y_       = util::ParseNumeric<double>(tokenList[1]);
+         element.anchorX_ = util::ParseNumeric<double>(tokenList[2]);
+         element.anchorY_ = util::ParseNumeric<double>(tokenList[3]);
+         element.tu_      = util::ParseNumeric<double>(tokenList[4]);
       }
 
-      if (tokenList.size() >= 6)
+      if (tokenCount >= 6)
       {
-         element.tv_ = std::stod(tokenList[5]);
+         element.tv_ = util::ParseNumeric<double>(tokenList[5]);
       }
       else
       {
          element.tv_ = element.tu_;
       }
 
-      if (tokenList.size() >= 5)
+      if (tokenCount >= 5)
       {
          std::static_pointer_cast<ImageXYDrawItem>(currentDrawItem_)
             ->elements_.emplace_back(element);
@@ -909,17 +944,19 @@ void Placefile::Impl::ProcessElement(const std::string& line)
       //    ...
       //    lat2, lon2                  ; and repeating it ends the contour
       // End:
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {",", ",", ",", ",", ",", ","});
+      std::array<std::string_view, 7> tokenList {};
+      const std::size_t               tokenCount =
+         util::ParseTokens(line, ",", tokenList);
 
       PolygonDrawItem::Element element;
 
-      if (tokenList.size() >= 5)
+      if (tokenCount >= 5)
       {
-         element.color_ = ParseColor(tokenList, 2, colorMode_);
+         element.color_ =
+            ParseColor({tokenList.data(), tokenCount}, 2, colorMode_);
       }
 
-      if (tokenList.size() >= 2)
+      if (tokenCount >= 2)
       {
          ParseLocation(tokenList[0],
                        tokenList[1],
@@ -992,19 +1029,47 @@ void Placefile::Impl::ProcessElementEnd()
    }
 }
 
-void Placefile::Impl::ParseLocation(const std::string& latitudeToken,
-                                    const std::string& longitudeToken,
-                                    double&            latitude,
-                                    double&            longitude,
-                                    double&            x,
-                                    double&            y)
+std::size_t Placefile::Impl::HashStatement(std::string_view line) const
+{
+   std::size_t seed = 0;
+
+   // Combine the statement with the parsing state applied to the draw item
+   boost::hash_combine(seed, line);
+   boost::hash_combine(seed, threshold_.value());
+   boost::hash_combine(seed, static_cast<std::uint32_t>(colorMode_));
+   boost::hash_combine(seed, startTime_.time_since_epoch().count());
+   boost::hash_combine(seed, endTime_.time_since_epoch().count());
+
+   for (auto& color : {color_, iconModulate_})
+   {
+      boost::hash_combine(seed, color[0]);
+      boost::hash_combine(seed, color[1]);
+      boost::hash_combine(seed, color[2]);
+      boost::hash_combine(seed, color[3]);
+   }
+
+   for (auto& object : objectStack_)
+   {
+      boost::hash_combine(seed, object.x_);
+      boost::hash_combine(seed, object.y_);
+   }
+
+   return seed;
+}
+
+void Placefile::Impl::ParseLocation(std::string_view latitudeToken,
+                                    std::string_view longitudeToken,
+                                    double&          latitude,
+                                    double&          longitude,
+                                    double&          x,
+                                    double&          y)
 {
    if (objectStack_.empty())
    {
       // If an Object statement is not currently open, parse latitude and
       // longitude tokens as-is
-      latitude  = std::stod(latitudeToken);
-      longitude = std::stod(longitudeToken);
+      latitude  = util::ParseNumeric<double>(latitudeToken);
+      longitude = util::ParseNumeric<double>(longitudeToken);
    }
    else
    {
@@ -1014,8 +1079,8 @@ void Placefile::Impl::ParseLocation(const std::string& latitudeToken,
       longitude = objectStack_[0].y_;
 
       // The latitude and longitude tokens are interpreted as x, y offsets
-      x = std::stod(latitudeToken);
-      y = std::stod(longitudeToken);
+      x = util::ParseNumeric<double>(latitudeToken);
+      y = util::ParseNumeric<double>(longitudeToken);
 
       // If there are inner Object statements open, treat these as x, y offsets
       for (std::size_t i = 1; i < objectStack_.size(); i++)
@@ -1032,13 +1097,15 @@ void Placefile::Impl::ProcessEscapeCharacters(std::string& s)
    boost::replace_all(s, "\\n", "\n");
 }
 
-void Placefile::Impl::TrimQuotes(std::string& s)
+std::string_view Placefile::Impl::TrimQuotes(std::string_view s)
 {
    if (s.size() >= 2 && s.front() == '"' && s.back() == '"')
    {
-      s.erase(s.size() - 1);
-      s.erase(0, 1);
+      s.remove_suffix(1);
+      s.remove_prefix(1);
    }
+
+   return s;
 }
 
 } // namespace scwx::gr
@@ -3,7 +3,7 @@
 #include <scwx/util/logger.hpp>
 #include <scwx/util/threads.hpp>
 
-#include <condition_variable>
+#include <atomic>
 #include <mutex>
 #include <optional>
 
@@ -116,8 +116,6 @@ public:
    void        Run();
    void        RunOnce();
 
-   void FinishInitialization();
-
    boost::asio::thread_pool threadPool_ {2u};
 
    boost::asio::steady_timer pollTimer_ {threadPool_};
@@ -128,17 +126,15 @@ public:
    bool disableServer_ {false};
    bool rotateServer_ {false};
 
-   std::mutex              initializationMutex_ {};
-   std::condition_variable initializationCondition_ {};
-   std::atomic<bool>       initialized_ {false};
-
    types::ntp::NtpPacket transmitPacket_ {};
 
    boost::asio::ip::udp::socket                  socket_ {threadPool_};
    std::optional<boost::asio::ip::udp::endpoint> serverEndpoint_ {};
    std::array<std::uint8_t, kReceiveBufferSize_> receiveBuffer_ {};
 
-   std::chrono::system_clock::duration timeOffset_ {};
+   // Read by util::time::now() from any thread, and applied as soon as the
+   // first response is received
+   std::atomic<std::chrono::system_clock::duration> timeOffset_ {};
 
    const std::vector<std::string> serverList_ {"time.nist.gov",
                                                "time.cloudflare.com",
@@ -174,14 +170,6 @@ NtpClient::Impl::Impl()
 
    transmitPacket_.fields.vn   = 3; // Version
    transmitPacket_.fields.mode = 3; // Client (3)
-
-   // If the NTP client is enabled, wait until the first refresh to consider
-   // "initialized". Otherwise, mark as initialized immediately to prevent a
-   // deadlock.
-   if (!enabled_)
-   {
-      initialized_ = true;
-   }
 }
 
 NtpClient::Impl::~Impl()
@@ -382,9 +370,11 @@ void NtpClient::Impl::ReceivePacket(std::size_t length)
          const auto& t3 = destinationTime;
 
          // Update time offset
-         timeOffset_ = ((t1 - t0) + (t2 - t3)) / 2;
+         const std::chrono::system_clock::duration timeOffset =
+            ((t1 - t0) + (t2 - t3)) / 2;
+         timeOffset_ = timeOffset;
 
-         logger_->debug("Time offset updated: {:%jd %T}", timeOffset_);
+         logger_->debug("Time offset updated: {:%jd %T}", timeOffset);
       }
    }
    else
@@ -520,34 +510,6 @@ void NtpClient::Impl::RunOnce()
       // Did not poll this frame
       error_ = true;
    }
-
-   FinishInitialization();
-}
-
-void NtpClient::Impl::FinishInitialization()
-{
-   if (!initialized_)
-   {
-      // Set initialized to true
-      std::unique_lock lock(initializationMutex_);
-      initialized_ = true;
-      lock.unlock();
-
-      // Notify any threads waiting for initialization
-      initializationCondition_.notify_all();
-   }
-}
-
-void NtpClient::WaitForInitialOffset()
-{
-   std::unique_lock lock(p->initializationMutex_);
-
-   // While not yet initialized
-   while (!p->initialized_)
-   {
-      // Wait for initialization
-      p->initializationCondition_.wait(lock);
-   }
 }
 
 std::shared_ptr<NtpClient> NtpClient::Instance()
@@ -6,6 +6,8 @@
 #include <scwx/util/time.hpp>
 #include <scwx/wsr88d/ar2v_file.hpp>
 
+#include <algorithm>
+#include <future>
 #include <shared_mutex>
 #include <utility>
 
@@ -44,6 +46,8 @@ static const auto logger_ = util::Logger::Create(logPrefix_);
 static const std::string kDefaultBucketName_ = "unidata-nexrad-level2-chunks";
 static const std::string kDefaultRegion_     = "us-east-1";
 
+static constexpr std::size_t kMaxConcurrentChunkRequests_ = 6u;
+
 class AwsLevel2ChunksDataProvider::Impl
 {
 public:
@@ -72,6 +76,7 @@ public:
       std::string                           lastKey_;
       int                                   nextFile_ {1};
       bool                                  hasAllFiles_ {false};
+      std::size_t                           generation_ {0};
    };
 
    explicit Impl(AwsLevel2ChunksDataProvider* self,
@@ -118,8 +123,9 @@ public:
    std::chrono::system_clock::time_point GetScanTime(const std::string& prefix);
    int GetScanNumber(const std::string& prefix);
 
-   bool                             LoadScan(Impl::ScanRecord& scanRecord);
-   std::tuple<bool, size_t, size_t> ListObjects();
+   bool                              LoadScan(Impl::ScanRecord& scanRecord);
+   std::shared_ptr<wsr88d::Ar2vFile> GetMergedFile();
+   std::tuple<bool, size_t, size_t>  ListObjects();
 
    std::string                        radarSite_;
    std::string                        bucketName_;
@@ -137,6 +143,14 @@ public:
 
    std::chrono::seconds updatePeriod_;
 
+   // The current scan merged with the last scan, rebuilt only when either scan
+   // changes
+   std::shared_ptr<wsr88d::Ar2vFile> mergedFile_ {};
+   std::shared_ptr<wsr88d::Ar2vFile> mergedCurrentFile_ {};
+   std::shared_ptr<wsr88d::Ar2vFile> mergedLastFile_ {};
+   std::size_t                       mergedCurrentGeneration_ {0};
+   std::size_t                       mergedLastGeneration_ {0};
+
    std::weak_ptr<AwsLevel2DataProvider> level2DataProvider_;
 
    AwsLevel2ChunksDataProvider* self_;
@@ -517,10 +531,21 @@ bool AwsLevel2ChunksDataProvider::Impl::LoadScan(Impl::ScanRecord& scanRecord)
       return false;
    }
 
-   bool  hasNew = false;
-   auto& chunks = listOutcome.GetResult().GetContents();
-   logger_->trace("Found {} new chunks.", chunks.size());
-   for (const auto& chunk : chunks)
+   struct Chunk
+   {
+      std::string key_;
+      int         keyNumber_;
+      char        keyChar_;
+
+      std::future<Aws::S3::Model::GetObjectOutcome> outcome_ {};
+   };
+
+   auto&              chunkObjects = listOutcome.GetResult().GetContents();
+   std::vector<Chunk> chunks {};
+   logger_->trace("Found {} new chunks.", chunkObjects.size());
+
+   chunks.reserve(chunkObjects.size());
+   for (const auto& chunk : chunkObjects)
    {
       const std::string& key = chunk.GetKey();
 
@@ -535,7 +560,7 @@ bool AwsLevel2ChunksDataProvider::Impl::LoadScan(Impl::ScanRecord& scanRecord)
       const int          keyNumber      = std::stoi(keyNumberStr);
       // As far as order goes, only the first one matters. This may cause some
       // issues if keys come in out of order, but usually they just skip chunks
-      if (scanRecord.nextFile_ == 1 && keyNumber != scanRecord.nextFile_)
+      if (scanRecord.nextFile_ == 1 && chunks.empty() && keyNumber != 1)
       {
          logger_->warn("Chunk found that was not in order {} {}",
                        scanRecord.lastKey_,
@@ -553,55 +578,90 @@ bool AwsLevel2ChunksDataProvider::Impl::LoadScan(Impl::ScanRecord& scanRecord)
       }
       const char keyChar = key[secondSlash + charPos];
 
-      Aws::S3::Model::GetObjectRequest objectRequest;
-      objectRequest.SetBucket(bucketName_);
-      objectRequest.SetKey(key);
+      chunks.push_back({key, keyNumber, keyChar});
+   }
+
+   // Request all chunks up front with bounded concurrency, and decode each
+   // chunk in sequence order as soon as it and its predecessors are available
+   boost::asio::thread_pool requestPool {std::clamp<std::size_t>(
+      chunks.size(), 1u, kMaxConcurrentChunkRequests_)};
+
+   for (auto& chunk : chunks)
+   {
+      auto promise =
+         std::make_shared<std::promise<Aws::S3::Model::GetObjectOutcome>>();
+      chunk.outcome_ = promise->get_future();
+
+      boost::asio::post(requestPool,
+                        [this, promise, key = chunk.key_]()
+                        {
+                           Aws::S3::Model::GetObjectRequest objectRequest;
+                           objectRequest.SetBucket(bucketName_);
+                           objectRequest.SetKey(key);
+
+                           promise->set_value(
+                              client_->GetObject(objectRequest));
+                        });
+   }
 
-      auto outcome = client_->GetObject(objectRequest);
+   // If decoding stops early, destroying the request pool abandons any
+   // requests which have not yet started. Chunks loaded before a failure are
+   // still indexed below.
+   bool hasNew = false;
+   for (auto& chunk : chunks)
+   {
+      auto outcome = chunk.outcome_.get();
 
       if (!outcome.IsSuccess())
       {
          logger_->warn("Could not get object: {}",
                        outcome.GetError().GetMessage());
-         return hasNew;
+         break;
       }
 
-      auto& body = outcome.GetResultWithOwnership().GetBody();
+      auto& body   = outcome.GetResultWithOwnership().GetBody();
+      bool  loaded = false;
 
-      switch (keyChar)
+      switch (chunk.keyChar_)
       {
       case 'S':
       { // First chunk
          scanRecord.nexradFile_ = std::make_shared<wsr88d::Ar2vFile>();
-         if (!scanRecord.nexradFile_->LoadData(body))
+         loaded                 = scanRecord.nexradFile_->LoadData(body);
+         if (!loaded)
          {
             logger_->warn("Failed to load first chunk");
-            return hasNew;
          }
          break;
       }
       case 'I':
       { // Middle chunk
-         if (!scanRecord.nexradFile_->LoadLDMRecords(body))
+         loaded = scanRecord.nexradFile_->LoadLDMRecords(body);
+         if (!loaded)
          {
             logger_->warn("Failed to load middle chunk");
-            return hasNew;
          }
          break;
       }
       case 'E':
       { // Last chunk
-         if (!scanRecord.nexradFile_->LoadLDMRecords(body))
+         loaded = scanRecord.nexradFile_->LoadLDMRecords(body);
+         if (!loaded)
          {
             logger_->warn("Failed to load last chunk");
-            return hasNew;
+            break;
          }
          scanRecord.hasAllFiles_ = true;
          break;
       }
       default:
          logger_->warn("Could not load chunk with unknown char");
-         return hasNew;
+         break;
+      }
+
+      if (!loaded)
+      {
+         break;
       }
       hasNew = true;
 
@@ -613,8 +673,8 @@ bool AwsLevel2ChunksDataProvider::Impl::LoadScan(Impl::ScanRecord& scanRecord)
       scanRecord.secondLastModified_ = scanRecord.lastModified_;
       scanRecord.lastModified_       = lastModified;
 
-      scanRecord.nextFile_ = keyNumber + 1;
-      scanRecord.lastKey_  = key;
+      scanRecord.nextFile_ = chunk.keyNumber_ + 1;
+      scanRecord.lastKey_  = chunk.key_;
    }
 
    if (scanRecord.nexradFile_ == nullptr)
@@ -624,11 +684,35 @@ bool AwsLevel2ChunksDataProvider::Impl::LoadScan(Impl::ScanRecord& scanRecord)
    else if (hasNew)
    {
       scanRecord.nexradFile_->IndexFile();
+      ++scanRecord.generation_;
    }
 
    return hasNew;
 }
 
+std::shared_ptr<wsr88d::Ar2vFile>
+AwsLevel2ChunksDataProvider::Impl::GetMergedFile()
+{
+   if (mergedFile_ == nullptr ||
+       mergedCurrentFile_ != currentScan_.nexradFile_ ||
+       mergedCurrentGeneration_ != currentScan_.generation_ ||
+       mergedLastFile_ != lastScan_.nexradFile_ ||
+       mergedLastGeneration_ != lastScan_.generation_)
+   {
+      // Pass the previously merged file, so only elevation scans with new
+      // radials are merged again
+      mergedFile_ = std::make_shared<wsr88d::Ar2vFile>(
+         currentScan_.nexradFile_, lastScan_.nexradFile_, mergedFile_);
+
+      mergedCurrentFile_       = currentScan_.nexradFile_;
+      mergedCurrentGeneration_ = currentScan_.generation_;
+      mergedLastFile_          = lastScan_.nexradFile_;
+      mergedLastGeneration_    = lastScan_.generation_;
+   }
+
+   return mergedFile_;
+}
+
 std::shared_ptr<wsr88d::NexradFile>
 AwsLevel2ChunksDataProvider::LoadObjectByTime(
    std::chrono::system_clock::time_point time)
@@ -639,8 +723,7 @@ AwsLevel2ChunksDataProvider::LoadObjectByTime(
    if (p->currentScan_.valid_ &&
        (time == epoch || time >= p->currentScan_.time_))
    {
-      return std::make_shared<wsr88d::Ar2vFile>(p->currentScan_.nexradFile_,
-                                                p->lastScan_.nexradFile_);
+      return p->GetMergedFile();
    }
    else if (p->lastScan_.valid_ && time >= p->lastScan_.time_)
    {
@@ -1,12 +1,16 @@
 #define _SILENCE_STDEXT_ARR_ITERS_DEPRECATION_WARNING
 
 #include <scwx/provider/aws_nexrad_data_provider.hpp>
+#include <scwx/provider/object_cache.hpp>
+#include <scwx/util/arenabuf.hpp>
 #include <scwx/util/environment.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/util/map.hpp>
 #include <scwx/util/time.hpp>
 #include <scwx/wsr88d/nexrad_file_factory.hpp>
 
+#include <istream>
+#include <iterator>
 #include <shared_mutex>
 
 #include <aws/core/auth/AWSCredentials.h>
@@ -326,22 +330,56 @@ AwsNexradDataProvider::LoadObjectByKey(const std::string& key)
 {
    std::shared_ptr<wsr88d::NexradFile> nexradFile = nullptr;
 
-   Aws::S3::Model::GetObjectRequest request;
-   request.SetBucket(p->bucketName_);
-   request.SetKey(key);
+   auto& objectCache = ObjectCache::Instance();
 
-   auto outcome = p->client_->GetObject(request);
+   // Check the object cache before making a network request
+   std::shared_ptr<std::vector<char>> data =
+      objectCache.Get(p->bucketName_, key);
+   const bool cached = (data != nullptr);
 
-   if (outcome.IsSuccess())
+   // Reading from the arena may modify the data in place (e.g., byte swapping
+   // uncompressed moment data), so downloaded objects are read from a copy
+   // and the original payload is cached
+   std::shared_ptr<const std::vector<char>> payload {};
+
+   if (!cached)
    {
+      Aws::S3::Model::GetObjectRequest request;
+      request.SetBucket(p->bucketName_);
+      request.SetKey(key);
+
+      auto outcome = p->client_->GetObject(request);
+
+      if (!outcome.IsSuccess())
+      {
+         logger_->warn("Could not get object: {}",
+                       outcome.GetError().GetMessage());
+         return nullptr;
+      }
+
       auto& body = outcome.GetResultWithOwnership().GetBody();
 
-      nexradFile = wsr88d::NexradFileFactory::Create(body);
+      if (!objectCache.enabled())
+      {
+         return wsr88d::NexradFileFactory::Create(body);
+      }
+
+      payload = std::make_shared<const std::vector<char>>(
+         std::istreambuf_iterator<char>(body),
+         std::istreambuf_iterator<char>());
+      data = std::make_shared<std::vector<char>>(*payload);
    }
-   else
+
+   util::arenabuf objectBuffer {data, 0, data->size()};
+   std::istream   is {&objectBuffer};
+
+   nexradFile = wsr88d::NexradFileFactory::Create(is);
+
+   // Only cache downloaded objects which were successfully read. The cache
+   // write is performed in the background, off of the product load path.
+   if (!cached && nexradFile != nullptr)
    {
-      logger_->warn("Could not get object: {}",
-                    outcome.GetError().GetMessage());
+      objectCache.PutAsync(p->bucketName_, key, std::move(payload));
    }
 
    return nexradFile;
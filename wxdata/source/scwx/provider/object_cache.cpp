@@ -0,0 +1,461 @@
+#include <scwx/provider/object_cache.hpp>
+#include <scwx/util/digest.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <unordered_map>
+
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/stream.hpp>
+#include <fmt/format.h>
+
+namespace scwx::provider
+{
+
+static const std::string logPrefix_ = "scwx::provider::object_cache";
+static const auto        logger_    = util::Logger::Create(logPrefix_);
+
+static constexpr std::array<char, 8> kMagic_ {
+   'S', 'C', 'W', 'X', 'O', 'B', 'J', '1'};
+static constexpr std::size_t kDigestSize_ = 32u; // SHA-256
+static const std::string     kObjectExtension_ {".obj"};
+static const std::string     kTempExtension_ {".tmp"};
+
+typedef std::array<std::uint8_t, kDigestSize_> Digest;
+
+struct ObjectHeader
+{
+   std::array<char, kMagic_.size()> magic_ {};
+   std::uint64_t                    dataSize_ {};
+   std::uint32_t                    nameSize_ {};
+   Digest                           digest_ {};
+};
+
+class ObjectCache::Impl
+{
+public:
+   struct Entry
+   {
+      std::uintmax_t                  size_ {};
+      std::filesystem::file_time_type lastAccess_ {};
+   };
+
+   explicit Impl() = default;
+   ~Impl()         = default;
+
+   Impl(const Impl&)            = delete;
+   Impl& operator=(const Impl&) = delete;
+   Impl(Impl&&)                 = delete;
+   Impl& operator=(Impl&&)      = delete;
+
+   std::filesystem::path GetObjectPath(const std::string& name) const;
+   void                  Put(const std::string&       bucket,
+                             const std::string&       key,
+                             const std::vector<char>& data);
+   void                  Evict();
+   void                  Remove(const std::filesystem::path& path);
+   void                  Touch(const std::filesystem::path& path);
+
+   static bool ComputeDigest(const char* data, std::size_t size, Digest& digest);
+   static std::string GetObjectName(const std::string& bucket,
+                                    const std::string& key);
+
+   mutable std::mutex    mutex_ {};
+   std::filesystem::path directory_ {};
+   std::uintmax_t        maxSize_ {};
+   std::uintmax_t        totalSize_ {};
+   std::atomic<bool>     enabled_ {false};
+
+   std::unordered_map<std::string, Entry> entries_ {};
+
+   std::atomic<std::size_t> tempCounter_ {0};
+
+   // Asynchronous writes, destroyed first to stop writes before the cache
+   boost::asio::thread_pool threadPool_ {1u};
+};
+
+ObjectCache::ObjectCache() : p(std::make_unique<Impl>()) {}
+ObjectCache::~ObjectCache() = default;
+
+ObjectCache::ObjectCache(ObjectCache&&) noexcept            = default;
+ObjectCache& ObjectCache::operator=(ObjectCache&&) noexcept = default;
+
+ObjectCache& ObjectCache::Instance()
+{
+   static ObjectCache instance_ {};
+   return instance_;
+}
+
+bool ObjectCache::enabled() const
+{
+   return p->enabled_;
+}
+
+std::uintmax_t ObjectCache::size() const
+{
+   const std::unique_lock lock {p->mutex_};
+   return p->totalSize_;
+}
+
+void ObjectCache::Initialize(const std::string& directory,
+                             std::uintmax_t     maxSize)
+{
+   const std::unique_lock lock {p->mutex_};
+
+   std::error_code error;
+
+   p->enabled_   = false;
+   p->directory_ = directory;
+   p->maxSize_   = maxSize;
+   p->totalSize_ = 0;
+   p->entries_.clear();
+
+   if (!std::filesystem::exists(p->directory_, error) &&
+       !std::filesystem::create_directories(p->directory_, error))
+   {
+      logger_->error("Unable to create object cache directory: \"{}\" ({})",
+                     directory,
+                     error.message());
+      return;
+   }
+
+   // Index existing objects
+   for (auto it = std::filesystem::recursive_directory_iterator(
+           p->directory_, error);
+        !error && it != std::filesystem::recursive_directory_iterator();
+        it.increment(error))
+   {
+      if (!it->is_regular_file(error))
+      {
+         continue;
+      }
+
+      const auto& path = it->path();
+      if (path.extension() == kTempExtension_)
+      {
+         // Remove interrupted writes
+         std::filesystem::remove(path, error);
+         continue;
+      }
+      else if (path.extension() != kObjectExtension_)
+      {
+         continue;
+      }
+
+      const std::uintmax_t size       = it->file_size(error);
+      const auto           lastAccess = it->last_write_time(error);
+
+      p->entries_.insert_or_assign(path.stem().string(),
+                                   Impl::Entry {size, lastAccess});
+      p->totalSize_ += size;
+   }
+
+   logger_->debug("Object cache contains {} objects ({} bytes)",
+                  p->entries_.size(),
+                  p->totalSize_);
+
+   p->enabled_ = true;
+
+   p->Evict();
+}
+
+std::shared_ptr<std::vector<char>>
+ObjectCache::Get(const std::string& bucket, const std::string& key)
+{
+   if (!p->enabled_)
+   {
+      return nullptr;
+   }
+
+   const std::string           name = Impl::GetObjectName(bucket, key);
+   const std::filesystem::path path = p->GetObjectPath(name);
+   const std::string           objectName = bucket + "/" + key;
+
+   std::uintmax_t                  size {};
+   std::filesystem::file_time_type lastAccess {};
+
+   {
+      const std::unique_lock lock {p->mutex_};
+      auto                   it = p->entries_.find(name);
+      if (it == p->entries_.cend())
+      {
+         return nullptr;
+      }
+      size       = it->second.size_;
+      lastAccess = it->second.lastAccess_;
+   }
+
+   // The object is read without holding the lock, and may be concurrently
+   // evicted or replaced. A missing or short object is treated as a cache miss.
+   std::ifstream ifs {path, std::ios_base::in | std::ios_base::binary};
+   ObjectHeader  header {};
+   std::string   headerName {};
+   auto          data = std::make_shared<std::vector<char>>();
+   Digest        digest {};
+
+   ifs.read(header.magic_.data(), header.magic_.size());
+   ifs.read(reinterpret_cast<char*>(&header.dataSize_),
+            sizeof(header.dataSize_));
+   ifs.read(reinterpret_cast<char*>(&header.nameSize_),
+            sizeof(header.nameSize_));
+   ifs.read(reinterpret_cast<char*>(header.digest_.data()),
+            static_cast<std::streamsize>(header.digest_.size()));
+
+   bool valid = ifs.good() && header.magic_ == kMagic_ &&
+                header.nameSize_ == objectName.size() &&
+                header.dataSize_ <= size;
+
+   if (valid)
+   {
+      headerName.resize(header.nameSize_);
+      data->resize(header.dataSize_);
+
+      ifs.read(headerName.data(),
+               static_cast<std::streamsize>(headerName.size()));
+      ifs.read(data->data(), static_cast<std::streamsize>(data->size()));
+
+      // The object is valid if its name and data digest both match
+      valid = ifs.good() && ifs.peek() == std::ifstream::traits_type::eof() &&
+              headerName == objectName &&
+              Impl::ComputeDigest(data->data(), data->size(), digest) &&
+              digest == header.digest_;
+   }
+
+   ifs.close();
+
+   if (!valid)
+   {
+      const std::unique_lock lock {p->mutex_};
+
+      // Only remove the object if it has not been evicted, replaced or
+      // successfully read since it was opened
+      auto it = p->entries_.find(name);
+      if (it != p->entries_.cend() && it->second.lastAccess_ == lastAccess)
+      {
+         logger_->warn("Removing invalid cached object: {}", objectName);
+         p->Remove(path);
+      }
+
+      return nullptr;
+   }
+
+   logger_->trace("Loaded cached object: {}", objectName);
+
+   {
+      const std::unique_lock lock {p->mutex_};
+      p->Touch(path);
+   }
+
+   return data;
+}
+
+void ObjectCache::Put(const std::string&       bucket,
+                      const std::string&       key,
+                      const std::vector<char>& data)
+{
+   p->Put(bucket, key, data);
+}
+
+void ObjectCache::PutAsync(const std::string&                       bucket,
+                           const std::string&                       key,
+                           std::shared_ptr<const std::vector<char>> data)
+{
+   if (!p->enabled_ || data == nullptr)
+   {
+      return;
+   }
+
+   boost::asio::post(p->threadPool_,
+                     [impl = p.get(), bucket, key, data = std::move(data)]()
+                     { impl->Put(bucket, key, *data); });
+}
+
+void ObjectCache::Impl::Put(const std::string&       bucket,
+                            const std::string&       key,
+                            const std::vector<char>& data)
+{
+   if (!enabled_)
+   {
+      return;
+   }
+
+   const std::string           name = GetObjectName(bucket, key);
+   const std::filesystem::path path = GetObjectPath(name);
+   const std::string           objectName = bucket + "/" + key;
+
+   ObjectHeader header {.magic_    = kMagic_,
+                        .dataSize_ = data.size(),
+                        .nameSize_ =
+                           static_cast<std::uint32_t>(objectName.size()),
+                        .digest_ = {}};
+
+   if (!ComputeDigest(data.data(), data.size(), header.digest_))
+   {
+      return;
+   }
+
+   // Write to a temporary file, and move into place when complete, so that an
+   // interrupted write is never read as a cached object
+   const std::filesystem::path tempPath =
+      path.parent_path() /
+      fmt::format("{}.{}.tmp", name, tempCounter_.fetch_add(1));
+
+   std::error_code error;
+   std::filesystem::create_directories(path.parent_path(), error);
+
+   {
+      std::ofstream ofs {tempPath,
+                         std::ios_base::out | std::ios_base::binary |
+                            std::ios_base::trunc};
+
+      ofs.write(header.magic_.data(), header.magic_.size());
+      ofs.write(reinterpret_cast<const char*>(&header.dataSize_),
+                sizeof(header.dataSize_));
+      ofs.write(reinterpret_cast<const char*>(&header.nameSize_),
+                sizeof(header.nameSize_));
+      ofs.write(reinterpret_cast<const char*>(header.digest_.data()),
+                static_cast<std::streamsize>(header.digest_.size()));
+      ofs.write(objectName.data(),
+                static_cast<std::streamsize>(objectName.size()));
+      ofs.write(data.data(), static_cast<std::streamsize>(data.size()));
+
+      if (!ofs.good())
+      {
+         logger_->warn("Unable to write cached object: {}", objectName);
+         ofs.close();
+         std::filesystem::remove(tempPath, error);
+         return;
+      }
+   }
+
+   const std::unique_lock lock {mutex_};
+
+   std::filesystem::rename(tempPath, path, error);
+   if (error)
+   {
+      logger_->warn("Unable to store cached object: {} ({})",
+                    objectName,
+                    error.message());
+      std::filesystem::remove(tempPath, error);
+      return;
+   }
+
+   const std::uintmax_t size = std::filesystem::file_size(path, error);
+
+   auto it = entries_.find(name);
+   if (it != entries_.end())
+   {
+      totalSize_ -= it->second.size_;
+   }
+
+   entries_.insert_or_assign(
+      name, Entry {size, std::filesystem::file_time_type::clock::now()});
+   totalSize_ += size;
+
+   Evict();
+}
+
+std::filesystem::path
+ObjectCache::Impl::GetObjectPath(const std::string& name) const
+{
+   // Distribute objects across subdirectories by the first byte of the name
+   return directory_ / name.substr(0, 2) / (name + kObjectExtension_);
+}
+
+void ObjectCache::Impl::Evict()
+{
+   if (totalSize_ <= maxSize_)
+   {
+      return;
+   }
+
+   std::vector<std::pair<std::filesystem::file_time_type, std::string>>
+      entries {};
+   entries.reserve(entries_.size());
+   for (const auto& entry : entries_)
+   {
+      entries.emplace_back(entry.second.lastAccess_, entry.first);
+   }
+
+   // Evict least recently used objects first
+   std::sort(entries.begin(), entries.end());
+
+   for (auto it = entries.cbegin();
+        it != entries.cend() && totalSize_ > maxSize_;
+        ++it)
+   {
+      logger_->trace("Evicting cached object: {}", it->second);
+      Remove(GetObjectPath(it->second));
+   }
+}
+
+void ObjectCache::Impl::Remove(const std::filesystem::path& path)
+{
+   std::error_code error;
+   std::filesystem::remove(path, error);
+
+   auto it = entries_.find(path.stem().string());
+   if (it != entries_.end())
+   {
+      totalSize_ -= it->second.size_;
+      entries_.erase(it);
+   }
+}
+
+void ObjectCache::Impl::Touch(const std::filesystem::path& path)
+{
+   auto it = entries_.find(path.stem().string());
+   if (it != entries_.end())
+   {
+      // Record the access time on disk, so recently used objects are retained
+      // across sessions
+      std::error_code error;
+      it->second.lastAccess_ = std::filesystem::file_time_type::clock::now();
+      std::filesystem::last_write_time(path, it->second.lastAccess_, error);
+   }
+}
+
+bool ObjectCache::Impl::ComputeDigest(const char* data,
+                                      std::size_t size,
+                                      Digest&     digest)
+{
+   boost::iostreams::stream<boost::iostreams::array_source> is {data, size};
+   std::vector<std::uint8_t>                                 result {};
+
+   if (!util::ComputeDigest(EVP_sha256(), is, result) ||
+       result.size() != digest.size())
+   {
+      return false;
+   }
+
+   std::copy(result.cbegin(), result.cend(), digest.begin());
+
+   return true;
+}
+
+std::string ObjectCache::Impl::GetObjectName(const std::string& bucket,
+                                             const std::string& key)
+{
+   const std::string objectName = bucket + "/" + key;
+   Digest            digest {};
+   std::string       name {};
+
+   ComputeDigest(objectName.data(), objectName.size(), digest);
+
+   name.reserve(digest.size() * 2);
+   for (std::uint8_t byte : digest)
+   {
+      fmt::format_to(std::back_inserter(name), "{:02x}", byte);
+   }
+
+   return name;
+}
+
+} // namespace scwx::provider
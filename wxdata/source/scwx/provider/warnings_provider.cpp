@@ -10,10 +10,13 @@
 #endif
 
 #include <scwx/provider/warnings_provider.hpp>
+#include <scwx/common/characters.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/util/time.hpp>
 
+#include <charconv>
 #include <mutex>
+#include <string_view>
 
 #if defined(_MSC_VER)
 #   pragma warning(push, 0)
@@ -21,6 +24,7 @@
 
 #define LIBXML_HTML_ENABLED
 #include <cpr/cpr.h>
+#include <fmt/format.h>
 
 #if (__cpp_lib_chrono < 201907L)
 #   include <date/date.h>
@@ -36,6 +40,11 @@ namespace scwx::provider
 static const std::string logPrefix_ = "scwx::provider::warnings_provider";
 static const auto        logger_    = util::Logger::Create(logPrefix_);
 
+// Content lengths and byte ranges apply to the encoded content, so files are
+// always requested without content encoding
+static const std::pair<const std::string, std::string> kIdentityEncoding_ {
+   "Accept-Encoding", "identity"};
+
 class WarningsProvider::Impl
 {
 public:
@@ -49,6 +58,15 @@ public:
 
       std::string contentLengthStr_ {};
       std::string lastModifiedStr_ {};
+
+      // Size of the complete messages already loaded from the file
+      std::size_t consumedSize_ {};
+   };
+
+   struct FileRequest
+   {
+      std::size_t        offset_;
+      cpr::AsyncResponse response_;
    };
 
    using WarningFileMap = std::map<std::string, FileInfoRecord>;
@@ -64,8 +82,12 @@ public:
    Impl(const Impl&&)            = delete;
    Impl& operator=(const Impl&&) = delete;
 
-   bool UpdateFileRecord(const cpr::Response& response,
-                         const std::string&   filename);
+   std::optional<std::size_t> UpdateFileRecord(const cpr::Response& response,
+                                               const std::string&   filename);
+   void SetConsumedSize(const std::string& filename, std::size_t size);
+   void ResetFileRecord(const std::string& filename);
+
+   static std::size_t FindCompleteMessages(std::string_view data);
 
    std::string baseUrl_;
 
@@ -101,9 +123,9 @@ WarningsProvider::LoadUpdatedFiles(
 #   define kDateTimeFormat "warnings_%Y%m%d_%H.txt"
 #endif
 
-   std::vector<
-      std::pair<std::string,
-                cpr::AsyncWrapper<std::optional<cpr::AsyncResponse>, false>>>
+   std::vector<std::pair<
+      std::string,
+      cpr::AsyncWrapper<std::optional<Impl::FileRequest>, false>>>
                                                         asyncCallbacks;
    std::vector<std::shared_ptr<awips::TextProductFile>> updatedFiles;
 
@@ -126,18 +148,37 @@ WarningsProvider::LoadUpdatedFiles(
       asyncCallbacks.emplace_back(
          filename,
          cpr::HeadCallback(
-            [url, filename, this](
-               cpr::Response headResponse) -> std::optional<cpr::AsyncResponse>
+            [url, filename, this](cpr::Response headResponse)
+               -> std::optional<Impl::FileRequest>
             {
                if (headResponse.status_code == cpr::status::HTTP_OK)
                {
-                  const bool updated =
+                  const std::optional<std::size_t> offset =
                      p->UpdateFileRecord(headResponse, filename);
 
-                  if (updated)
+                  if (offset.has_value() && offset.value() == 0)
                   {
                      logger_->trace("GET request for file: {}", filename);
-                     return cpr::GetAsync(cpr::Url {url});
+                     return Impl::FileRequest {
+                        0,
+                        cpr::GetAsync(cpr::Url {url},
+                                      cpr::Header {kIdentityEncoding_})};
+                  }
+                  else if (offset.has_value())
+                  {
+                     // The file is only appended to, so request only the
+                     // bytes following the messages already loaded
+                     logger_->trace("GET request for file: {} (from byte {})",
+                                    filename,
+                                    offset.value());
+                     return Impl::FileRequest {
+                        offset.value(),
+                        cpr::GetAsync(
+                           cpr::Url {url},
+                           cpr::Header {{"Range",
+                                         fmt::format("bytes={}-",
+                                                     offset.value())},
+                                        kIdentityEncoding_})};
                   }
                }
                else if (headResponse.status_code != cpr::status::HTTP_NOT_FOUND)
@@ -149,7 +190,8 @@ WarningsProvider::LoadUpdatedFiles(
 
                return std::nullopt;
             },
-            cpr::Url {url}));
+            cpr::Url {url},
+            cpr::Header {kIdentityEncoding_}));
 
       // Query the next hour
       currentHour += 1h;
@@ -168,27 +210,56 @@ WarningsProvider::LoadUpdatedFiles(
 
          if (asyncResponse.has_value())
          {
-            auto response = asyncResponse.value().get();
+            const std::size_t offset   = asyncResponse.value().offset_;
+            auto              response = asyncResponse.value().response_.get();
+
+            std::string_view data {response.text};
+            std::size_t      dataOffset = 0;
+
+            if (response.status_code == cpr::status::HTTP_PARTIAL_CONTENT)
+            {
+               // The response contains only the requested range
+               dataOffset = offset;
+            }
+            else if (response.status_code == cpr::status::HTTP_OK &&
+                     offset > 0 && data.size() >= offset)
+            {
+               // The server ignored the range request, skip the messages
+               // which have already been loaded
+               logger_->debug("Range request ignored for file: {}", filename);
+               data.remove_prefix(offset);
+               dataOffset = offset;
+            }
+            else if (response.status_code != cpr::status::HTTP_OK)
+            {
+               logger_->warn("Could not load file: {} ({})",
+                             filename,
+                             response.status_line);
+
+               // Request the file again on the next update
+               p->ResetFileRecord(filename);
+               continue;
+            }
 
-            if (response.status_code == cpr::status::HTTP_OK)
+            // Only load complete messages, the remainder of the file will be
+            // requested once it has been written
+            data = data.substr(0, Impl::FindCompleteMessages(data));
+            p->SetConsumedSize(filename, dataOffset + data.size());
+
+            if (!data.empty())
             {
-               logger_->debug("Loading file: {}", filename);
+               logger_->debug(
+                  "Loading file: {} ({} bytes)", filename, data.size());
 
                // Load file
                const std::shared_ptr<awips::TextProductFile> textProductFile {
                   std::make_shared<awips::TextProductFile>()};
-               std::istringstream responseBody {response.text};
+               std::istringstream responseBody {std::string {data}};
                if (textProductFile->LoadData(filename, responseBody))
                {
                   updatedFiles.push_back(textProductFile);
                }
             }
-            else
-            {
-               logger_->warn("Could not load file: {} ({})",
-                             filename,
-                             response.status_line);
-            }
          }
       }
       else
@@ -200,10 +271,11 @@ WarningsProvider::LoadUpdatedFiles(
    return updatedFiles;
 }
 
-bool WarningsProvider::Impl::UpdateFileRecord(const cpr::Response& response,
-                                              const std::string&   filename)
+std::optional<std::size_t>
+WarningsProvider::Impl::UpdateFileRecord(const cpr::Response& response,
+                                         const std::string&   filename)
 {
-   bool updated = false;
+   std::optional<std::size_t> offset {};
 
    auto contentLengthIt = response.header.find("Content-Length");
    auto lastModifiedIt  = response.header.find("Last-Modified");
@@ -234,14 +306,35 @@ bool WarningsProvider::Impl::UpdateFileRecord(const cpr::Response& response,
       {
          // Size changed
          existingRecord.contentLengthStr_ = contentLengthIt->second;
-         updated                          = true;
+         offset                           = existingRecord.consumedSize_;
       }
       else if (!lastModified.empty() &&
                lastModified != existingRecord.lastModifiedStr_)
       {
          // Last modified changed
          existingRecord.lastModifiedStr_ = lastModifiedIt->second;
-         updated                         = true;
+         offset                          = existingRecord.consumedSize_;
+      }
+
+      std::size_t size {};
+      const auto [ptr, ec] =
+         std::from_chars(contentLength.data(),
+                         contentLength.data() + contentLength.size(),
+                         size);
+
+      if (offset.has_value() && ec == std::errc {})
+      {
+         if (size < existingRecord.consumedSize_)
+         {
+            // The file has been replaced, request the entire file
+            existingRecord.consumedSize_ = 0;
+            offset                       = 0;
+         }
+         else if (size == existingRecord.consumedSize_)
+         {
+            // All messages in the file have already been loaded
+            offset.reset();
+         }
       }
    }
    else
@@ -250,10 +343,61 @@ bool WarningsProvider::Impl::UpdateFileRecord(const cpr::Response& response,
       files_.emplace(std::piecewise_construct,
                      std::forward_as_tuple(filename),
                      std::forward_as_tuple(contentLength, lastModified));
-      updated = true;
+      offset = 0;
+   }
+
+   return offset;
+}
+
+void WarningsProvider::Impl::SetConsumedSize(const std::string& filename,
+                                             std::size_t        size)
+{
+   const std::unique_lock lock(filesMutex_);
+
+   auto it = files_.find(filename);
+   if (it != files_.cend())
+   {
+      it->second.consumedSize_ = size;
+   }
+}
+
+void WarningsProvider::Impl::ResetFileRecord(const std::string& filename)
+{
+   const std::unique_lock lock(filesMutex_);
+
+   auto it = files_.find(filename);
+   if (it != files_.cend())
+   {
+      it->second.contentLengthStr_.clear();
+      it->second.lastModifiedStr_.clear();
+   }
+}
+
+std::size_t WarningsProvider::Impl::FindCompleteMessages(std::string_view data)
+{
+   // Messages are terminated by an ETX character
+   std::size_t end = data.rfind(common::Characters::ETX);
+
+   if (end != std::string_view::npos)
+   {
+      // Include line breaks following the message, so the next request starts
+      // at the beginning of a message
+      ++end;
+      while (end < data.size() && (data[end] == '\r' || data[end] == '\n'))
+      {
+         ++end;
+      }
+
+      return end;
+   }
+   else if (data.find(common::Characters::SOH) != std::string_view::npos)
+   {
+      // A message has been started, but not yet completed
+      return 0;
    }
 
-   return updated;
+   // The data is not framed, and is loaded in its entirety
+   return data.size();
 }
 
 } // namespace scwx::provider
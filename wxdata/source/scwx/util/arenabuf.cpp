@@ -0,0 +1,71 @@
+#include <scwx/util/arenabuf.hpp>
+
+namespace scwx
+{
+namespace util
+{
+
+arenabuf::arenabuf(std::shared_ptr<std::vector<char>> arena,
+                   std::size_t                        offset,
+                   std::size_t                        size) :
+    arena_(std::move(arena))
+{
+   char* begin = arena_->data() + offset;
+   setg(begin, begin, begin + size);
+}
+
+const std::shared_ptr<std::vector<char>>& arenabuf::arena() const
+{
+   return arena_;
+}
+
+char* arenabuf::current() const
+{
+   return gptr();
+}
+
+arenabuf::pos_type arenabuf::seekoff(std::streamoff          off,
+                                     std::ios_base::seekdir  way,
+                                     std::ios_base::openmode which)
+{
+   if ((which & std::ios_base::in) == 0)
+   {
+      return pos_type(off_type(-1));
+   }
+
+   off_type newOffset;
+   switch (way)
+   {
+   case std::ios_base::beg:
+      newOffset = off;
+      break;
+   case std::ios_base::cur:
+      newOffset = (gptr() - eback()) + off;
+      break;
+   case std::ios_base::end:
+      newOffset = (egptr() - eback()) + off;
+      break;
+   default:
+      return pos_type(off_type(-1));
+   }
+
+   return seekpos(pos_type(newOffset), which);
+}
+
+arenabuf::pos_type arenabuf::seekpos(pos_type                pos,
+                                     std::ios_base::openmode which)
+{
+   const off_type offset = off_type(pos);
+
+   if ((which & std::ios_base::in) == 0 || offset < 0 ||
+       offset > egptr() - eback())
+   {
+      return pos_type(off_type(-1));
+   }
+
+   setg(eback(), eback() + offset, egptr());
+   return pos;
+}
+
+} // namespace util
+} // namespace scwx
@@ -2,6 +2,13 @@
 
 #include <scwx/util/strings.hpp>
 
+#include <cctype>
+#include <charconv>
+#include <locale>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+
 #include <boost/algorithm/string/trim.hpp>
 #include <boost/lexical_cast.hpp>
 #include <fmt/format.h>
@@ -74,55 +81,77 @@ std::string BytesToString(std::ptrdiff_t bytes)
    return fmt::format("{} TB", FormatNumber(terabytes));
 }
 
-std::vector<std::string> ParseTokens(const std::string&       s,
-                                     std::vector<std::string> delimiters,
-                                     std::size_t              pos)
+static std::size_t
+FindTokenEnd(std::string_view s, std::string_view delimiters, std::size_t& pos);
+static bool IsSpace(char c);
+
+std::vector<std::string> ParseTokens(const std::string&              s,
+                                     const std::vector<std::string>& delimiters,
+                                     std::size_t                     pos)
 {
+   const std::string_view   sv {s};
    std::vector<std::string> tokens {};
-   std::size_t              findPos {};
 
    // Iterate through each delimiter
-   for (std::size_t i = 0; i < delimiters.size() && pos != std::string::npos;
-        ++i)
+   for (std::size_t i = 0; i < delimiters.size(); ++i)
    {
-      // Skip leading spaces
-      while (pos < s.size() && std::isspace(s[pos]))
-      {
-         ++pos;
-      }
+      // Search for delimiter
+      std::size_t nextPos = FindTokenEnd(sv, delimiters[i], pos);
 
-      if (pos < s.size() && s[pos] == '"')
-      {
-         // Do not search for a delimeter within a quoted string
-         findPos = s.find('"', pos + 1);
-
-         // Increment search start to one after quotation mark
-         if (findPos != std::string::npos)
-         {
-            ++findPos;
-         }
-      }
-      else
+      // If the delimiter was not found, stop processing tokens
+      if (nextPos == std::string::npos)
       {
-         // Search starting at the current position
-         findPos = pos;
+         break;
       }
 
+      // Add the current substring as a token
+      tokens.emplace_back(Trim(sv.substr(pos, nextPos - pos)));
+
+      // Increment nextPos until the next non-space character
+      while (++nextPos < s.size() && IsSpace(s[nextPos])) {}
+
+      // Store new position value
+      pos = nextPos;
+   }
+
+   // Add the remainder of the string as a token
+   if (pos < s.size())
+   {
+      tokens.emplace_back(Trim(sv.substr(pos)));
+   }
+
+   return tokens;
+}
+
+std::size_t ParseTokens(std::string_view            s,
+                        std::string_view            delimiters,
+                        std::span<std::string_view> tokens,
+                        std::size_t                 pos)
+{
+   std::size_t tokenCount = 0;
+
+   if (tokens.empty())
+   {
+      return tokenCount;
+   }
+
+   // Reserve the last token for the remainder of the string
+   while (tokenCount < tokens.size() - 1)
+   {
       // Search for delimiter
-      std::size_t nextPos = s.find_first_of(delimiters[i], findPos);
+      std::size_t nextPos = FindTokenEnd(s, delimiters, pos);
 
       // If the delimiter was not found, stop processing tokens
-      if (nextPos == std::string::npos)
+      if (nextPos == std::string_view::npos)
       {
          break;
       }
 
       // Add the current substring as a token
-      auto& newToken = tokens.emplace_back(s.substr(pos, nextPos - pos));
-      boost::trim(newToken);
+      tokens[tokenCount++] = Trim(s.substr(pos, nextPos - pos));
 
       // Increment nextPos until the next non-space character
-      while (++nextPos < s.size() && std::isspace(s[nextPos])) {}
+      while (++nextPos < s.size() && IsSpace(s[nextPos])) {}
 
       // Store new position value
       pos = nextPos;
@@ -131,11 +160,63 @@ std::vector<std::string> ParseTokens(const std::string&       s,
    // Add the remainder of the string as a token
    if (pos < s.size())
    {
-      auto& newToken = tokens.emplace_back(s.substr(pos));
-      boost::trim(newToken);
+      tokens[tokenCount++] = Trim(s.substr(pos));
    }
 
-   return tokens;
+   return tokenCount;
+}
+
+std::string_view Trim(std::string_view s)
+{
+   std::size_t begin = 0;
+   std::size_t end   = s.size();
+
+   while (begin < end && IsSpace(s[begin]))
+   {
+      ++begin;
+   }
+   while (end > begin && IsSpace(s[end - 1]))
+   {
+      --end;
+   }
+
+   return s.substr(begin, end - begin);
+}
+
+static std::size_t
+FindTokenEnd(std::string_view s, std::string_view delimiters, std::size_t& pos)
+{
+   std::size_t findPos {};
+
+   // Skip leading spaces
+   while (pos < s.size() && IsSpace(s[pos]))
+   {
+      ++pos;
+   }
+
+   if (pos < s.size() && s[pos] == '"')
+   {
+      // Do not search for a delimeter within a quoted string
+      findPos = s.find('"', pos + 1);
+
+      // Increment search start to one after quotation mark
+      if (findPos != std::string_view::npos)
+      {
+         ++findPos;
+      }
+   }
+   else
+   {
+      // Search starting at the current position
+      findPos = pos;
+   }
+
+   return s.find_first_of(delimiters, findPos);
+}
+
+static bool IsSpace(char c)
+{
+   return std::isspace(static_cast<unsigned char>(c));
 }
 
 std::string ToString(const std::vector<std::string>& v)
@@ -172,5 +253,63 @@ std::optional<T> TryParseNumeric(const std::string& str)
    return value;
 }
 
+template<typename T>
+T ParseNumeric(std::string_view str)
+{
+   T value {};
+
+   // Skip leading whitespace and plus sign, which are not accepted by
+   // std::from_chars
+   std::size_t pos = 0;
+   while (pos < str.size() && IsSpace(str[pos]))
+   {
+      ++pos;
+   }
+   if (pos < str.size() && str[pos] == '+')
+   {
+      ++pos;
+   }
+
+   const char* first = str.data() + pos;
+   const char* last  = str.data() + str.size();
+
+   std::errc ec {};
+
+#if !defined(__cpp_lib_to_chars) || __cpp_lib_to_chars < 201611L
+   if constexpr (std::is_floating_point_v<T>)
+   {
+      // Floating point std::from_chars is not available in all standard
+      // libraries (libc++ prior to LLVM 20). Parse using the classic locale,
+      // independent of the application locale.
+      std::istringstream stream {std::string {first, last}};
+      stream.imbue(std::locale::classic());
+      stream >> value;
+
+      if (stream.fail())
+      {
+         ec = (value != T {}) ? std::errc::result_out_of_range :
+                                std::errc::invalid_argument;
+      }
+   }
+   else
+#endif
+   {
+      ec = std::from_chars(first, last, value).ec;
+   }
+
+   if (ec == std::errc::invalid_argument)
+   {
+      throw std::invalid_argument(
+         fmt::format("Could not parse numeric value: {}", str));
+   }
+   else if (ec == std::errc::result_out_of_range)
+   {
+      throw std::out_of_range(
+         fmt::format("Numeric value out of range: {}", str));
+   }
+
+   return value;
+}
+
 } // namespace util
 } // namespace scwx
@@ -0,0 +1,266 @@
+#include <scwx/util/task_graph.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+
+#include <boost/asio/post.hpp>
+
+namespace scwx
+{
+namespace util
+{
+
+static const std::string logPrefix_ = "scwx::util::task_graph";
+static const auto        logger_    = Logger::Create(logPrefix_);
+
+class TaskGraph::Impl
+{
+public:
+   struct Task
+   {
+      std::string              name_ {};
+      std::function<void()>    function_ {};
+      Thread                   thread_ {Thread::Pool};
+      std::size_t              dependencyCount_ {};
+      std::size_t              remainingDependencies_ {};
+      std::vector<std::size_t> dependents_ {};
+
+      std::chrono::steady_clock::time_point start_ {};
+      std::chrono::steady_clock::time_point end_ {};
+   };
+
+   explicit Impl(const std::string& name) : name_ {name} {}
+   ~Impl() = default;
+
+   Impl(const Impl&)             = delete;
+   Impl& operator=(const Impl&)  = delete;
+   Impl(const Impl&&)            = delete;
+   Impl& operator=(const Impl&&) = delete;
+
+   void Dispatch(std::size_t i, boost::asio::thread_pool& threadPool);
+   void Execute(std::size_t i, boost::asio::thread_pool& threadPool);
+   void LogTimings() const;
+
+   const std::string name_;
+
+   std::vector<Task>                            tasks_ {};
+   std::unordered_map<std::string, std::size_t> taskIndices_ {};
+
+   std::mutex              mutex_ {};
+   std::condition_variable condition_ {};
+   std::deque<std::size_t> callerQueue_ {};
+   std::size_t             remainingTasks_ {};
+   std::exception_ptr      exception_ {};
+
+   std::chrono::steady_clock::time_point runStart_ {};
+   std::chrono::steady_clock::time_point runEnd_ {};
+};
+
+TaskGraph::TaskGraph(const std::string& name) :
+    p(std::make_unique<Impl>(name))
+{
+}
+TaskGraph::~TaskGraph() = default;
+
+TaskGraph::TaskGraph(TaskGraph&&) noexcept            = default;
+TaskGraph& TaskGraph::operator=(TaskGraph&&) noexcept = default;
+
+void TaskGraph::AddTask(const std::string&              name,
+                        std::function<void()>           task,
+                        const std::vector<std::string>& dependencies,
+                        Thread                          thread)
+{
+   if (p->taskIndices_.contains(name))
+   {
+      throw std::invalid_argument("Duplicate task: " + name);
+   }
+
+   const std::size_t index = p->tasks_.size();
+
+   Impl::Task newTask {};
+   newTask.name_            = name;
+   newTask.function_        = std::move(task);
+   newTask.thread_          = thread;
+   newTask.dependencyCount_ = dependencies.size();
+
+   // Validate all dependencies before modifying the graph
+   std::vector<std::size_t> dependencyIndices {};
+   for (auto& dependency : dependencies)
+   {
+      auto it = p->taskIndices_.find(dependency);
+      if (it == p->taskIndices_.cend())
+      {
+         throw std::invalid_argument("Unknown dependency: " + dependency +
+                                     " (Task " + name + ")");
+      }
+      dependencyIndices.push_back(it->second);
+   }
+
+   for (std::size_t dependencyIndex : dependencyIndices)
+   {
+      p->tasks_[dependencyIndex].dependents_.push_back(index);
+   }
+
+   p->tasks_.push_back(std::move(newTask));
+   p->taskIndices_.emplace(name, index);
+}
+
+void TaskGraph::Run(boost::asio::thread_pool& threadPool)
+{
+   std::unique_lock lock {p->mutex_};
+
+   p->runStart_       = std::chrono::steady_clock::now();
+   p->remainingTasks_ = p->tasks_.size();
+   p->exception_      = nullptr;
+   p->callerQueue_.clear();
+
+   for (auto& task : p->tasks_)
+   {
+      task.remainingDependencies_ = task.dependencyCount_;
+   }
+
+   // Start tasks without dependencies
+   for (std::size_t i = 0; i < p->tasks_.size(); ++i)
+   {
+      if (p->tasks_[i].dependencyCount_ == 0)
+      {
+         p->Dispatch(i, threadPool);
+      }
+   }
+
+   // Run tasks on this thread as they become ready, until all tasks complete
+   while (p->remainingTasks_ > 0)
+   {
+      if (!p->callerQueue_.empty())
+      {
+         const std::size_t i = p->callerQueue_.front();
+         p->callerQueue_.pop_front();
+
+         lock.unlock();
+         p->Execute(i, threadPool);
+         lock.lock();
+      }
+      else
+      {
+         p->condition_.wait(lock);
+      }
+   }
+
+   p->runEnd_ = std::chrono::steady_clock::now();
+
+   p->LogTimings();
+
+   if (p->exception_ != nullptr)
+   {
+      std::rethrow_exception(p->exception_);
+   }
+}
+
+std::vector<TaskGraph::TaskTiming> TaskGraph::timings() const
+{
+   const std::unique_lock lock {p->mutex_};
+
+   std::vector<TaskTiming> timings {};
+   timings.reserve(p->tasks_.size());
+
+   for (auto& task : p->tasks_)
+   {
+      timings.push_back({task.name_,
+                         task.start_ - p->runStart_,
+                         task.end_ - task.start_});
+   }
+
+   return timings;
+}
+
+void TaskGraph::Impl::Dispatch(std::size_t               i,
+                               boost::asio::thread_pool& threadPool)
+{
+   // Must be called with the mutex locked
+   if (tasks_[i].thread_ == Thread::Caller)
+   {
+      callerQueue_.push_back(i);
+      condition_.notify_all();
+   }
+   else
+   {
+      boost::asio::post(threadPool,
+                        [this, i, &threadPool]() { Execute(i, threadPool); });
+   }
+}
+
+void TaskGraph::Impl::Execute(std::size_t               i,
+                              boost::asio::thread_pool& threadPool)
+{
+   Task& task = tasks_[i];
+
+   std::exception_ptr exception {};
+
+   const auto start = std::chrono::steady_clock::now();
+
+   try
+   {
+      task.function_();
+   }
+   catch (const std::exception& ex)
+   {
+      logger_->error("{}: {} failed: {}", name_, task.name_, ex.what());
+      exception = std::current_exception();
+   }
+   catch (...)
+   {
+      logger_->error("{}: {} failed", name_, task.name_);
+      exception = std::current_exception();
+   }
+
+   const auto end = std::chrono::steady_clock::now();
+
+   const std::unique_lock lock {mutex_};
+
+   task.start_ = start;
+   task.end_   = end;
+
+   if (exception != nullptr && exception_ == nullptr)
+   {
+      exception_ = exception;
+   }
+
+   // Start dependent tasks which are now ready
+   for (std::size_t dependent : task.dependents_)
+   {
+      if (--tasks_[dependent].remainingDependencies_ == 0)
+      {
+         Dispatch(dependent, threadPool);
+      }
+   }
+
+   --remainingTasks_;
+   condition_.notify_all();
+}
+
+void TaskGraph::Impl::LogTimings() const
+{
+   using namespace std::chrono;
+
+   for (auto& task : tasks_)
+   {
+      logger_->info(
+         "{}: {} started at {} ms, completed in {} ms",
+         name_,
+         task.name_,
+         duration_cast<milliseconds>(task.start_ - runStart_).count(),
+         duration_cast<milliseconds>(task.end_ - task.start_).count());
+   }
+
+   logger_->info("{}: completed in {} ms",
+                 name_,
+                 duration_cast<milliseconds>(runEnd_ - runStart_).count());
+}
+
+} // namespace util
+} // namespace scwx
@@ -2,13 +2,15 @@
 #include <scwx/wsr88d/rda/digital_radar_data.hpp>
 #include <scwx/wsr88d/rda/level2_message_factory.hpp>
 #include <scwx/wsr88d/rda/rda_types.hpp>
+#include <scwx/util/arenabuf.hpp>
 #include <scwx/util/logger.hpp>
-#include <scwx/util/rangebuf.hpp>
 #include <scwx/util/time.hpp>
 #include <scwx/common/geographic.hpp>
 
+#include <algorithm>
+#include <execution>
 #include <fstream>
-#include <sstream>
+#include <numeric>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -22,6 +24,8 @@
 
 #include <boost/algorithm/string/trim.hpp>
 #include <boost/iostreams/copy.hpp>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
 #include <boost/iostreams/filtering_streambuf.hpp>
 #include <boost/iostreams/filter/bzip2.hpp>
 #include <fmt/chrono.h>
@@ -45,6 +49,24 @@ static const auto        logger_    = util::Logger::Create(logPrefix_);
 class Ar2vFileImpl
 {
 public:
+   struct LDMRecord
+   {
+      std::size_t compressedOffset_ {};
+      std::size_t compressedSize_ {};
+   };
+
+   typedef std::map<float, std::shared_ptr<rda::GenericRadarData>> AzimuthMap;
+
+   struct MergedScan
+   {
+      std::shared_ptr<rda::ElevationScan> scan_ {};
+      std::size_t                         scanRadials_ {};
+      std::shared_ptr<rda::ElevationScan> previousScan_ {};
+      std::size_t                         previousScanRadials_ {};
+      std::shared_ptr<const AzimuthMap>   previousAzimuths_ {};
+      std::shared_ptr<rda::ElevationScan> mergedScan_ {};
+   };
+
    explicit Ar2vFileImpl() {};
    ~Ar2vFileImpl() = default;
 
@@ -55,6 +77,16 @@ public:
    void        ParseLDMRecord(std::istream& is);
    void ProcessRadarData(const std::shared_ptr<rda::GenericRadarData>& message);
 
+   std::shared_ptr<rda::ElevationScan>
+   MergeElevationScan(rda::DataBlockType                         dataBlockType,
+                      float                                      elevation,
+                      const std::shared_ptr<rda::ElevationScan>& scan,
+                      const std::shared_ptr<rda::ElevationScan>& previousScan,
+                      const Ar2vFileImpl*                        previous);
+
+   static std::vector<std::shared_ptr<rda::Level2Message>>
+   ReadLDMRecord(std::istream& is);
+
    std::string   tapeFilename_ {};
    std::string   extensionNumber_ {};
    std::uint32_t julianDate_ {0};
@@ -72,7 +104,19 @@ public:
                               std::shared_ptr<rda::ElevationScan>>>>
       index_ {};
 
-   std::list<std::stringstream> rawRecords_ {};
+   // Decompressed LDM records are stored in a single arena, with each record
+   // decompressed in place into its own contiguous block. Radials parsed from
+   // the arena reference moment data without copying, and share ownership of
+   // the arena.
+   std::shared_ptr<std::vector<std::vector<char>>> recordArena_ {};
+
+   // Total size of record arenas decompressed into this file. The arena is
+   // released after parsing, but remains referenced by parsed radials.
+   std::size_t recordArenaSize_ {0u};
+
+   // Incomplete elevation scans merged with the previous scan, retained so a
+   // subsequent merge only rebuilds the elevations which have changed
+   std::map<std::pair<rda::DataBlockType, float>, MergedScan> mergedScans_ {};
 };
 
 Ar2vFile::Ar2vFile() : p(std::make_unique<Ar2vFileImpl>()) {}
@@ -101,6 +145,15 @@ std::size_t Ar2vFile::message_count() const
    return p->messageCount_;
 }
 
+std::size_t Ar2vFile::memory_usage() const
+{
+   // Moment data references the record arena, so the arena dominates. Parsed
+   // message structures are estimated per message.
+   static constexpr std::size_t kEstimatedMessageSize_ = 1024u;
+
+   return p->recordArenaSize_ + p->messageCount_ * kEstimatedMessageSize_;
+}
+
 std::chrono::system_clock::time_point Ar2vFile::start_time() const
 {
    return util::TimePoint(p->julianDate_, p->milliseconds_);
@@ -275,8 +328,10 @@ std::size_t Ar2vFileImpl::DecompressLDMRecords(std::istream& is)
 {
    logger_->trace("Decompressing LDM Records");
 
-   std::size_t numRecords = 0;
+   std::vector<char>      compressedData {};
+   std::vector<LDMRecord> records {};
 
+   // Find LDM record boundaries, reading the compressed records sequentially
    while (is.peek() != EOF)
    {
       std::streampos startPosition = is.tellg();
@@ -296,59 +351,146 @@ std::size_t Ar2vFileImpl::DecompressLDMRecords(std::istream& is)
          break;
       }
 
-      boost::iostreams::filtering_streambuf<boost::iostreams::input> in;
-      util::rangebuf r(is.rdbuf(), recordSize);
-      in.push(boost::iostreams::bzip2_decompressor());
-      in.push(r);
+      LDMRecord& record        = records.emplace_back();
+      record.compressedOffset_ = compressedData.size();
 
-      try
-      {
-         std::stringstream ss;
-         std::streamsize   bytesCopied = boost::iostreams::copy(in, ss);
-         logger_->trace("Decompressed record size = {} bytes", bytesCopied);
+      compressedData.resize(record.compressedOffset_ + recordSize);
+      is.read(&compressedData[record.compressedOffset_],
+              static_cast<std::streamsize>(recordSize));
 
-         rawRecords_.push_back(std::move(ss));
+      record.compressedSize_ = static_cast<std::size_t>(is.gcount());
+      compressedData.resize(record.compressedOffset_ + record.compressedSize_);
+
+      if (record.compressedSize_ != recordSize)
+      {
+         logger_->warn("LDM record truncated: {} < {} bytes",
+                       record.compressedSize_,
+                       recordSize);
       }
-      catch (const boost::iostreams::bzip2_error& ex)
+   }
+
+   // Each LDM record is an independent bzip2 stream, decompress concurrently
+   // directly into the arena
+   recordArena_ = std::make_shared<std::vector<std::vector<char>>>();
+   recordArena_->resize(records.size());
+
+   std::vector<std::size_t> recordNumbers(records.size());
+   std::iota(recordNumbers.begin(), recordNumbers.end(), 0u);
+
+   std::for_each(
+      std::execution::par,
+      recordNumbers.cbegin(),
+      recordNumbers.cend(),
+      [this, &compressedData, &records](std::size_t recordNumber)
       {
-         logger_->warn(
-            "Error decompressing record {}: {}", numRecords, ex.what());
+         const LDMRecord&   record = records[recordNumber];
+         std::vector<char>& data   = (*recordArena_)[recordNumber];
 
-         is.seekg(startPosition + std::streampos(recordSize),
-                  std::ios_base::beg);
-      }
+         boost::iostreams::filtering_streambuf<boost::iostreams::input> in;
+         in.push(boost::iostreams::bzip2_decompressor());
+         in.push(boost::iostreams::array_source(
+            &compressedData[record.compressedOffset_],
+            record.compressedSize_));
+
+         try
+         {
+            std::streamsize bytesCopied = boost::iostreams::copy(
+               in, boost::iostreams::back_inserter(data));
+            logger_->trace("Decompressed record {} size = {} bytes",
+                           recordNumber,
+                           bytesCopied);
+         }
+         catch (const boost::iostreams::bzip2_error& ex)
+         {
+            logger_->warn(
+               "Error decompressing record {}: {}", recordNumber, ex.what());
+
+            // Discard any partially decompressed data
+            data.clear();
+         }
+
+         // Release the slack left by growing the record during decompression,
+         // as the record is retained for as long as its radials
+         data.shrink_to_fit();
+      });
 
-      ++numRecords;
+   // Account for the retained size of the records
+   for (auto& data : *recordArena_)
+   {
+      recordArenaSize_ += data.capacity();
    }
 
-   logger_->trace("Decompressed {} LDM Records", numRecords);
+   logger_->trace("Decompressed {} LDM Records", records.size());
 
-   return numRecords;
+   return records.size();
 }
 
 void Ar2vFileImpl::ParseLDMRecords()
 {
    logger_->trace("Parsing LDM Records");
 
-   std::size_t count = 0;
+   std::vector<std::vector<std::shared_ptr<rda::Level2Message>>> messages(
+      recordArena_->size());
 
-   for (auto it = rawRecords_.begin(); it != rawRecords_.end(); it++)
-   {
-      std::stringstream& ss = *it;
+   std::vector<std::size_t> recordNumbers(recordArena_->size());
+   std::iota(recordNumbers.begin(), recordNumbers.end(), 0u);
+
+   // Records are independent, parse concurrently, views into the arena are
+   // disjoint
+   std::for_each(
+      std::execution::par,
+      recordNumbers.cbegin(),
+      recordNumbers.cend(),
+      [this, &messages](std::size_t recordNumber)
+      {
+         std::vector<char>& data = (*recordArena_)[recordNumber];
+         if (data.empty())
+         {
+            // Record failed to decompress
+            return;
+         }
+
+         // Share ownership of the whole arena with radials parsed from the
+         // record
+         const std::shared_ptr<std::vector<char>> record {recordArena_, &data};
 
-      logger_->trace("Record {}", count++);
+         util::arenabuf recordBuffer {record, 0u, data.size()};
+         std::istream   recordStream {&recordBuffer};
 
-      ParseLDMRecord(ss);
+         logger_->trace("Record {}", recordNumber);
+
+         messages[recordNumber] = ReadLDMRecord(recordStream);
+      });
+
+   // Merge messages in record order
+   for (auto& recordMessages : messages)
+   {
+      for (auto& message : recordMessages)
+      {
+         HandleMessage(message);
+      }
    }
 
-   rawRecords_.clear();
+   // Parsed radials retain ownership of the arena as needed
+   recordArena_.reset();
 }
 
 void Ar2vFileImpl::ParseLDMRecord(std::istream& is)
+{
+   for (auto& message : ReadLDMRecord(is))
+   {
+      HandleMessage(message);
+   }
+}
+
+std::vector<std::shared_ptr<rda::Level2Message>>
+Ar2vFileImpl::ReadLDMRecord(std::istream& is)
 {
    static constexpr std::size_t kDefaultSegmentSize = 2432;
    static constexpr std::size_t kCtmHeaderSize      = 12;
 
+   std::vector<std::shared_ptr<rda::Level2Message>> messages {};
+
    auto ctx = rda::Level2MessageFactory::CreateContext();
 
    while (!is.eof() && !is.fail())
@@ -397,7 +539,7 @@ void Ar2vFileImpl::ParseLDMRecord(std::istream& is)
 
          if (msgInfo.messageValid)
          {
-            HandleMessage(msgInfo.message);
+            messages.push_back(std::move(msgInfo.message));
          }
       }
 
@@ -405,6 +547,8 @@ void Ar2vFileImpl::ParseLDMRecord(std::istream& is)
       is.seekg(messageStart + static_cast<std::streampos>(messageSize),
                std::ios_base::beg);
    }
+
+   return messages;
 }
 
 void Ar2vFileImpl::HandleMessage(std::shared_ptr<rda::Level2Message>& message)
@@ -546,10 +690,127 @@ bool IsRadarDataIncomplete(
    return angleDelta > kIncompleteDataAngleThreshold_;
 }
 
-Ar2vFile::Ar2vFile(const std::shared_ptr<Ar2vFile>& current,
-                   const std::shared_ptr<Ar2vFile>& last) :
+std::shared_ptr<rda::ElevationScan> Ar2vFileImpl::MergeElevationScan(
+   rda::DataBlockType                         dataBlockType,
+   float                                      elevation,
+   const std::shared_ptr<rda::ElevationScan>& scan,
+   const std::shared_ptr<rda::ElevationScan>& previousScan,
+   const Ar2vFileImpl*                        previous)
+{
+   const auto key = std::make_pair(dataBlockType, elevation);
+
+   MergedScan mergedScan {};
+   if (previous != nullptr)
+   {
+      auto it = previous->mergedScans_.find(key);
+      if (it != previous->mergedScans_.cend())
+      {
+         mergedScan = it->second;
+      }
+   }
+
+   // The previous scan may still be gaining radials if it was incomplete
+   if (mergedScan.previousScan_ != previousScan ||
+       mergedScan.previousScanRadials_ != previousScan->size())
+   {
+      // Sort by the azimuth. Makes the rest of this way easier
+      auto previousAzimuths = std::make_shared<AzimuthMap>();
+      for (const auto& radial : *previousScan)
+      {
+         (*previousAzimuths)[radial.second->azimuth_angle().value()] =
+            radial.second;
+      }
+
+      mergedScan.scan_                = nullptr;
+      mergedScan.previousScan_        = previousScan;
+      mergedScan.previousScanRadials_ = previousScan->size();
+      mergedScan.previousAzimuths_    = std::move(previousAzimuths);
+   }
+   else if (mergedScan.scan_ == scan && mergedScan.scanRadials_ == scan->size())
+   {
+      // Radials are only appended to an elevation scan, so the merged scan is
+      // unchanged if no radials have been added
+      mergedScans_[key] = mergedScan;
+      return mergedScan.mergedScan_;
+   }
+
+   // Make the new scan
+   auto newScan = std::make_shared<rda::ElevationScan>();
+
+   // Copy over the new radials
+   for (const auto& radial : *scan)
+   {
+      (*newScan)[radial.first] = radial.second;
+   }
+
+   /* Correctly order the old radials. The radials need to be in order for the
+    * rendering to work, and the index needs to start at 0 and increase by one
+    * from there. Since the new radial should have index 0, the old radial needs
+    * to be reshaped to match the new radials indexing.
+    */
+
+   const double lowestAzm = scan->cbegin()->second->azimuth_angle().value();
+   const double heighestAzm =
+      scan->crbegin()->second->azimuth_angle().value();
+   std::uint16_t index = scan->crbegin()->first + 1;
+
+   const auto& previousAzimuths = *mergedScan.previousAzimuths_;
+
+   if (lowestAzm <= heighestAzm) // New scan does not contain 0/360
+   {
+      // Get the radials following the new radials
+      for (auto radial = previousAzimuths.upper_bound(
+              static_cast<float>(heighestAzm));
+           radial != previousAzimuths.cend();
+           ++radial)
+      {
+         (*newScan)[index] = radial->second;
+         ++index;
+      }
+      // Get the radials before the new radials
+      for (const auto& radial : previousAzimuths)
+      {
+         if (radial.first < lowestAzm)
+         {
+            (*newScan)[index] = radial.second;
+            ++index;
+         }
+         else
+         {
+            break;
+         }
+      }
+   }
+   else // New scan includes 0/360
+   {
+      // The radials will already be in the right order
+      for (const auto& radial : previousAzimuths)
+      {
+         if (radial.first > heighestAzm && radial.first < lowestAzm)
+         {
+            (*newScan)[index] = radial.second;
+            ++index;
+         }
+      }
+   }
+
+   mergedScan.scan_        = scan;
+   mergedScan.scanRadials_ = scan->size();
+   mergedScan.mergedScan_  = newScan;
+
+   mergedScans_[key] = std::move(mergedScan);
+
+   return newScan;
+}
+
+Ar2vFile::Ar2vFile(const std::shared_ptr<Ar2vFile>&       current,
+                   const std::shared_ptr<Ar2vFile>&       last,
+                   const std::shared_ptr<const Ar2vFile>& previous) :
     Ar2vFile()
 {
+   const Ar2vFileImpl* previousImpl =
+      (previous != nullptr) ? previous->p.get() : nullptr;
+
    // This is only used to index right now, so not a huge deal
    p->vcpData_ = nullptr;
 
@@ -615,78 +876,12 @@ Ar2vFile::Ar2vFile(const std::shared_ptr<Ar2vFile>& current,
                   secondMostRecent = possibleSecondMostRecent->second;
                }
 
-               // Make the new scan
-               auto newScan = std::make_shared<rda::ElevationScan>();
-
-               // Copy over the new radials
-               for (const auto& radial : *(mostRecent->second))
-               {
-                  (*newScan)[radial.first] = radial.second;
-               }
-
-               /* Correctly order the old radials. The radials need to be in
-                * order for the rendering to work, and the index needs to start
-                * at 0 and increase by one from there. Since the new radial
-                * should have index 0, the old radial needs to be reshaped to
-                * match the new radials indexing.
-                */
-
-               const double lowestAzm =
-                  mostRecent->second->cbegin()->second->azimuth_angle().value();
-               const double heighestAzm = mostRecent->second->crbegin()
-                                             ->second->azimuth_angle()
-                                             .value();
-               std::uint16_t index = mostRecent->second->crbegin()->first + 1;
-
-               // Sort by the azimuth. Makes the rest of this way easier
-               auto secondMostRecentAzmMap =
-                  std::map<float, std::shared_ptr<rda::GenericRadarData>>();
-               for (const auto& radial : *secondMostRecent)
-               {
-                  secondMostRecentAzmMap[radial.second->azimuth_angle()
-                                            .value()] = radial.second;
-               }
-
-               if (lowestAzm <= heighestAzm) // New scan does not contain 0/360
-               {
-                  // Get the radials following the new radials
-                  for (const auto& radial : secondMostRecentAzmMap)
-                  {
-                     if (radial.first > heighestAzm)
-                     {
-                        (*newScan)[index] = radial.second;
-                        ++index;
-                     }
-                  }
-                  // Get the radials before the new radials
-                  for (const auto& radial : secondMostRecentAzmMap)
-                  {
-                     if (radial.first < lowestAzm)
-                     {
-                        (*newScan)[index] = radial.second;
-                        ++index;
-                     }
-                     else
-                     {
-                        break;
-                     }
-                  }
-               }
-               else // New scan includes 0/360
-               {
-                  // The radials will already be in the right order
-                  for (const auto& radial : secondMostRecentAzmMap)
-                  {
-                     if (radial.first > heighestAzm && radial.first < lowestAzm)
-                     {
-                        (*newScan)[index] = radial.second;
-                        ++index;
-                     }
-                  }
-               }
-
                p->index_[type.first][elevation.first][mostRecent->first] =
-                  newScan;
+                  p->MergeElevationScan(type.first,
+                                        elevation.first,
+                                        mostRecent->second,
+                                        secondMostRecent,
+                                        previousImpl);
             }
             else
             {
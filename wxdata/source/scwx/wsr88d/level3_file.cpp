@@ -51,6 +51,8 @@ public:
    std::shared_ptr<rpg::CcbHeader>     ccbHeader_;
    std::shared_ptr<awips::WmoHeader>   innerHeader_;
    std::shared_ptr<rpg::Level3Message> message_;
+
+   std::size_t messageSize_ {0};
 };
 
 Level3File::Level3File() : p(std::make_unique<Level3FileImpl>()) {}
@@ -69,6 +71,13 @@ std::shared_ptr<rpg::Level3Message> Level3File::message() const
    return p->message_;
 }
 
+std::size_t Level3File::memory_usage() const
+{
+   // Decoded product data is approximately the size of the uncompressed
+   // message
+   return p->messageSize_;
+}
+
 bool Level3File::LoadFile(const std::string& filename)
 {
    logger_->debug("LoadFile: {}", filename);
@@ -184,8 +193,16 @@ bool Level3FileImpl::DecompressFile(std::istream& is, std::stringstream& ss)
 
 bool Level3FileImpl::LoadFileData(std::istream& is)
 {
+   const std::streampos messageStart = is.tellg();
+
    message_ = rpg::Level3MessageFactory::Create(is);
 
+   const std::streampos messageEnd = is.tellg();
+   if (messageStart != std::streampos(-1) && messageEnd != std::streampos(-1))
+   {
+      messageSize_ = static_cast<std::size_t>(messageEnd - messageStart);
+   }
+
    return (message_ != nullptr);
 }
 
@@ -1,4 +1,5 @@
 #include <scwx/wsr88d/rda/digital_radar_data_generic.hpp>
+#include <scwx/util/arenabuf.hpp>
 #include <scwx/util/logger.hpp>
 
 namespace scwx::wsr88d::rda
@@ -67,6 +68,12 @@ public:
 
    std::vector<std::uint8_t>  momentGates8_ {};
    std::vector<std::uint16_t> momentGates16_ {};
+
+   // When parsed from an arena, moment gates reference the arena directly
+   std::shared_ptr<const std::vector<char>> arena_ {nullptr};
+   const void*                              arenaMoments_ {nullptr};
+
+   bool ReadMomentGatesFromArena(std::istream& is);
 };
 
 DigitalRadarDataGeneric::MomentDataBlock::MomentDataBlock(
@@ -147,6 +154,11 @@ const void* DigitalRadarDataGeneric::MomentDataBlock::data_moments() const
 {
    const void* dataMoments = nullptr;
 
+   if (p->arenaMoments_ != nullptr)
+   {
+      return p->arenaMoments_;
+   }
+
    switch (p->dataWordSize_)
    {
    case 8: // NOLINT(cppcoreguidelines-avoid-magic-numbers)
@@ -208,7 +220,11 @@ bool DigitalRadarDataGeneric::MomentDataBlock::Parse(std::istream& is)
 
    if (p->numberOfDataMomentGates_ <= 1840)
    {
-      if (p->dataWordSize_ == 8)
+      if (p->ReadMomentGatesFromArena(is))
+      {
+         // Moment gates reference the arena, no copy required
+      }
+      else if (p->dataWordSize_ == 8)
       {
          p->momentGates8_.resize(p->numberOfDataMomentGates_);
          is.read(reinterpret_cast<char*>(p->momentGates8_.data()),
@@ -239,6 +255,48 @@ bool DigitalRadarDataGeneric::MomentDataBlock::Parse(std::istream& is)
    return dataBlockValid;
 }
 
+bool DigitalRadarDataGeneric::MomentDataBlock::Impl::ReadMomentGatesFromArena(
+   std::istream& is)
+{
+   // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers)
+
+   auto* arenaBuffer = dynamic_cast<util::arenabuf*>(is.rdbuf());
+   if (arenaBuffer == nullptr || (dataWordSize_ != 8 && dataWordSize_ != 16))
+   {
+      return false;
+   }
+
+   const std::size_t wordSize  = dataWordSize_ / 8u;
+   const std::size_t dataSize  = numberOfDataMomentGates_ * wordSize;
+   char*             dataBegin = arenaBuffer->current();
+
+   if (static_cast<std::size_t>(arenaBuffer->in_avail()) < dataSize ||
+       reinterpret_cast<std::uintptr_t>(dataBegin) % wordSize != 0)
+   {
+      // Truncated or misaligned data, fall back to copying
+      return false;
+   }
+
+   if (wordSize == 2)
+   {
+      // The arena is owned by the decoder, so swap to host byte order in place
+      auto* gates16 = reinterpret_cast<std::uint16_t*>(dataBegin);
+      std::transform(gates16,
+                     gates16 + numberOfDataMomentGates_,
+                     gates16,
+                     [](std::uint16_t u) { return ntohs(u); });
+   }
+
+   // NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
+
+   arena_        = arenaBuffer->arena();
+   arenaMoments_ = dataBegin;
+
+   is.seekg(static_cast<std::streamoff>(dataSize), std::ios_base::cur);
+
+   return true;
+}
+
 class DigitalRadarDataGeneric::VolumeDataBlock::Impl
 {
 public:
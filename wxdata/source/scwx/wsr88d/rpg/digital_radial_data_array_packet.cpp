@@ -1,6 +1,7 @@
 #include <scwx/wsr88d/rpg/digital_radial_data_array_packet.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <array>
 #include <istream>
 #include <string>
 
@@ -20,14 +21,11 @@ class DigitalRadialDataArrayPacketImpl
 public:
    struct Radial
    {
-      uint16_t             numberOfBytes_;
-      uint16_t             startAngle_;
-      uint16_t             deltaAngle_;
-      std::vector<uint8_t> level_;
+      uint16_t numberOfBytes_;
+      uint16_t startAngle_;
+      uint16_t deltaAngle_;
 
-      Radial() : numberOfBytes_ {0}, startAngle_ {0}, deltaAngle_ {0}, level_ {}
-      {
-      }
+      Radial() : numberOfBytes_ {0}, startAngle_ {0}, deltaAngle_ {0} {}
    };
 
    explicit DigitalRadialDataArrayPacketImpl() :
@@ -38,6 +36,7 @@ public:
        jCenterOfSweep_ {0},
        rangeScaleFactor_ {0},
        radial_ {},
+       level_ {},
        dataSize_ {0}
    {
    }
@@ -54,6 +53,9 @@ public:
    // Repeat for each radial
    std::vector<Radial> radial_;
 
+   // Levels of all radials, numberOfRangeBins_ per radial
+   std::vector<uint8_t> level_;
+
    size_t dataSize_;
 };
 
@@ -118,10 +120,10 @@ float DigitalRadialDataArrayPacket::delta_angle(uint16_t r) const
    return p->radial_[r].deltaAngle_ * 0.1f;
 }
 
-const std::vector<uint8_t>&
-DigitalRadialDataArrayPacket::level(uint16_t r) const
+std::span<const uint8_t> DigitalRadialDataArrayPacket::level(uint16_t r) const
 {
-   return p->radial_[r].level_;
+   return {p->level_.data() + static_cast<size_t>(r) * p->numberOfRangeBins_,
+           p->numberOfRangeBins_};
 }
 
 bool DigitalRadialDataArrayPacket::Parse(std::istream& is)
@@ -180,19 +182,21 @@ bool DigitalRadialDataArrayPacket::Parse(std::istream& is)
    if (blockValid)
    {
       p->radial_.resize(p->numberOfRadials_);
+      p->level_.resize(static_cast<size_t>(p->numberOfRadials_) *
+                       p->numberOfRangeBins_);
 
       for (uint16_t r = 0; r < p->numberOfRadials_; r++)
       {
          auto& radial = p->radial_[r];
 
-         is.read(reinterpret_cast<char*>(&radial.numberOfBytes_), 2);
-         is.read(reinterpret_cast<char*>(&radial.startAngle_), 2);
-         is.read(reinterpret_cast<char*>(&radial.deltaAngle_), 2);
+         // Read the radial header in a single read
+         std::array<uint16_t, 3> radialHeader {};
+         is.read(reinterpret_cast<char*>(radialHeader.data()), 6);
          bytesRead += 6;
 
-         radial.numberOfBytes_ = ntohs(radial.numberOfBytes_);
-         radial.startAngle_    = ntohs(radial.startAngle_);
-         radial.deltaAngle_    = ntohs(radial.deltaAngle_);
+         radial.numberOfBytes_ = ntohs(radialHeader[0]);
+         radial.startAngle_    = ntohs(radialHeader[1]);
+         radial.deltaAngle_    = ntohs(radialHeader[2]);
 
          if (radial.numberOfBytes_ < 1 || radial.numberOfBytes_ > 1840)
          {
@@ -213,12 +217,16 @@ bool DigitalRadialDataArrayPacket::Parse(std::istream& is)
             break;
          }
 
-         // Read radial bins
+         // Read radial bins directly into the level array
          size_t dataSize = p->numberOfRangeBins_;
-         radial.level_.resize(dataSize);
-         is.read(reinterpret_cast<char*>(radial.level_.data()), dataSize);
+         is.read(reinterpret_cast<char*>(p->level_.data() + r * dataSize),
+                 dataSize);
 
-         is.seekg(radial.numberOfBytes_ - dataSize, std::ios_base::cur);
+         // Skip any padding
+         if (radial.numberOfBytes_ > dataSize)
+         {
+            is.seekg(radial.numberOfBytes_ - dataSize, std::ios_base::cur);
+         }
          bytesRead += radial.numberOfBytes_;
       }
    }
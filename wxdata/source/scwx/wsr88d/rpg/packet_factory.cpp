@@ -91,7 +91,9 @@ std::shared_ptr<Packet> PacketFactory::Create(std::istream& is)
 
    is.seekg(-2, std::ios_base::cur);
 
-   if (packetValid && create_.find(packetCode) == create_.end())
+   auto it = packetValid ? create_.find(packetCode) : create_.cend();
+
+   if (packetValid && it == create_.cend())
    {
       logger_->warn("Unknown packet code: {0} (0x{0:x})", packetCode);
       packetValid = false;
@@ -100,7 +102,7 @@ std::shared_ptr<Packet> PacketFactory::Create(std::istream& is)
    if (packetValid)
    {
       logger_->trace("Found packet code: {0} (0x{0:x})", packetCode);
-      packet = create_.at(packetCode)(is);
+      packet = it->second(is);
    }
 
    return packet;
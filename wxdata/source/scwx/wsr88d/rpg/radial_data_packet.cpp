@@ -1,6 +1,8 @@
 #include <scwx/wsr88d/rpg/radial_data_packet.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <algorithm>
+#include <array>
 #include <istream>
 #include <string>
 
@@ -19,20 +21,11 @@ class RadialDataPacketImpl
 public:
    struct Radial
    {
-      uint16_t             numberOfRleHalfwords_;
-      uint16_t             startAngle_;
-      uint16_t             angleDelta_;
-      std::vector<uint8_t> data_;
-      std::vector<uint8_t> level_;
-
-      Radial() :
-          numberOfRleHalfwords_ {0},
-          startAngle_ {0},
-          angleDelta_ {0},
-          data_ {},
-          level_ {}
-      {
-      }
+      uint16_t numberOfRleHalfwords_;
+      uint16_t startAngle_;
+      uint16_t angleDelta_;
+
+      Radial() : numberOfRleHalfwords_ {0}, startAngle_ {0}, angleDelta_ {0} {}
    };
 
    explicit RadialDataPacketImpl() :
@@ -43,6 +36,7 @@ public:
        jCenterOfSweep_ {0},
        scaleFactor_ {0},
        radial_ {},
+       level_ {},
        dataSize_ {0}
    {
    }
@@ -59,6 +53,9 @@ public:
    // Repeat for each radial
    std::vector<Radial> radial_;
 
+   // Unpacked levels of all radials, numberOfRangeBins_ per radial
+   std::vector<uint8_t> level_;
+
    size_t dataSize_;
 };
 
@@ -117,9 +114,10 @@ float RadialDataPacket::delta_angle(uint16_t r) const
    return p->radial_[r].angleDelta_ * 0.1f;
 }
 
-const std::vector<uint8_t>& RadialDataPacket::level(uint16_t r) const
+std::span<const uint8_t> RadialDataPacket::level(uint16_t r) const
 {
-   return p->radial_[r].level_;
+   return {p->level_.data() + static_cast<size_t>(r) * p->numberOfRangeBins_,
+           p->numberOfRangeBins_};
 }
 
 size_t RadialDataPacket::data_size() const
@@ -177,19 +175,24 @@ bool RadialDataPacket::Parse(std::istream& is)
    if (blockValid)
    {
       p->radial_.resize(p->numberOfRadials_);
+      p->level_.assign(
+         static_cast<size_t>(p->numberOfRadials_) * p->numberOfRangeBins_, 0);
+
+      // Run Length Encoded data of the current radial
+      std::vector<uint8_t> rleData {};
 
       for (uint16_t r = 0; r < p->numberOfRadials_; r++)
       {
          auto& radial = p->radial_[r];
 
-         is.read(reinterpret_cast<char*>(&radial.numberOfRleHalfwords_), 2);
-         is.read(reinterpret_cast<char*>(&radial.startAngle_), 2);
-         is.read(reinterpret_cast<char*>(&radial.angleDelta_), 2);
+         // Read the radial header in a single read
+         std::array<uint16_t, 3> radialHeader {};
+         is.read(reinterpret_cast<char*>(radialHeader.data()), 6);
          bytesRead += 6;
 
-         radial.numberOfRleHalfwords_ = ntohs(radial.numberOfRleHalfwords_);
-         radial.startAngle_           = ntohs(radial.startAngle_);
-         radial.angleDelta_           = ntohs(radial.angleDelta_);
+         radial.numberOfRleHalfwords_ = ntohs(radialHeader[0]);
+         radial.startAngle_           = ntohs(radialHeader[1]);
+         radial.angleDelta_           = ntohs(radialHeader[2]);
 
          if (radial.numberOfRleHalfwords_ < 1 ||
              radial.numberOfRleHalfwords_ > 230)
@@ -203,29 +206,25 @@ bool RadialDataPacket::Parse(std::istream& is)
 
          // Read RLE halfwords
          size_t dataSize = radial.numberOfRleHalfwords_ * 2;
-         radial.data_.resize(dataSize);
-         is.read(reinterpret_cast<char*>(radial.data_.data()), dataSize);
+         rleData.resize(dataSize);
+         is.read(reinterpret_cast<char*>(rleData.data()), dataSize);
          bytesRead += dataSize;
 
-         // If the final byte is 0, truncate it
-         if (radial.data_.back() == 0)
-         {
-            radial.data_.pop_back();
-         }
-
-         // Unpack the levels from the Run Length Encoded data
-         radial.level_.resize(p->numberOfRangeBins_);
+         // Unpack the levels from the Run Length Encoded data. A trailing 0
+         // byte has a run length of 0, and is ignored.
+         uint8_t* level =
+            p->level_.data() + static_cast<size_t>(r) * p->numberOfRangeBins_;
 
          uint16_t b = 0;
-         for (auto it = radial.data_.cbegin(); it != radial.data_.cend(); it++)
+         for (auto it = rleData.cbegin();
+              it != rleData.cend() && b < p->numberOfRangeBins_;
+              it++)
          {
-            uint8_t run   = *it >> 4;
-            uint8_t level = *it & 0x0f;
+            const uint16_t run = std::min<uint16_t>(
+               *it >> 4, static_cast<uint16_t>(p->numberOfRangeBins_ - b));
 
-            for (int i = 0; i < run && b < p->numberOfRangeBins_; i++)
-            {
-               radial.level_[b++] = level;
-            }
+            std::fill_n(level + b, run, static_cast<uint8_t>(*it & 0x0f));
+            b += run;
          }
       }
    }
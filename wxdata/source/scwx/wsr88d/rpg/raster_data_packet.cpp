@@ -1,6 +1,7 @@
 #include <scwx/wsr88d/rpg/raster_data_packet.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <algorithm>
 #include <istream>
 #include <numeric>
 #include <string>
@@ -20,11 +21,11 @@ class RasterDataPacketImpl
 public:
    struct Row
    {
-      uint16_t             numberOfBytes_;
-      std::vector<uint8_t> data_;
-      std::vector<uint8_t> level_;
+      uint16_t numberOfBytes_;
+      size_t   levelOffset_;
+      uint16_t levelSize_;
 
-      Row() : numberOfBytes_ {0}, data_ {}, level_ {} {}
+      Row() : numberOfBytes_ {0}, levelOffset_ {0}, levelSize_ {0} {}
    };
 
    explicit RasterDataPacketImpl() :
@@ -39,6 +40,7 @@ public:
        numberOfRows_ {0},
        packagingDescriptor_ {0},
        row_ {},
+       level_ {},
        dataSize_ {0}
    {
    }
@@ -58,6 +60,9 @@ public:
    // Repeat for each row
    std::vector<Row> row_;
 
+   // Unpacked levels of all rows, stored contiguously
+   std::vector<uint8_t> level_;
+
    size_t dataSize_;
 };
 
@@ -121,9 +126,10 @@ uint16_t RasterDataPacket::packaging_descriptor() const
    return p->packagingDescriptor_;
 }
 
-const std::vector<uint8_t>& RasterDataPacket::level(uint16_t r) const
+std::span<const uint8_t> RasterDataPacket::level(uint16_t r) const
 {
-   return p->row_[r].level_;
+   const auto& row = p->row_[r];
+   return {p->level_.data() + row.levelOffset_, row.levelSize_};
 }
 
 size_t RasterDataPacket::data_size() const
@@ -182,6 +188,10 @@ bool RasterDataPacket::Parse(std::istream& is)
    if (blockValid)
    {
       p->row_.resize(p->numberOfRows_);
+      p->level_.clear();
+
+      // Run Length Encoded data of the current row
+      std::vector<uint8_t> rleData {};
 
       for (uint16_t r = 0; r < p->numberOfRows_; r++)
       {
@@ -204,36 +214,37 @@ bool RasterDataPacket::Parse(std::istream& is)
 
          // Read row data
          size_t dataSize = row.numberOfBytes_;
-         row.data_.resize(dataSize);
-         is.read(reinterpret_cast<char*>(row.data_.data()), dataSize);
+         rleData.resize(dataSize);
+         is.read(reinterpret_cast<char*>(rleData.data()), dataSize);
          bytesRead += dataSize;
 
-         // If the final byte is 0, truncate it
-         if (row.data_.back() == 0)
-         {
-            row.data_.pop_back();
-         }
-
-         // Unpack the levels from the Run Length Encoded data
+         // Unpack the levels from the Run Length Encoded data. A trailing 0
+         // byte has a run length of 0, and is ignored.
          uint16_t binCount =
-            std::accumulate(row.data_.cbegin(),
-                            row.data_.cend(),
+            std::accumulate(rleData.cbegin(),
+                            rleData.cend(),
                             static_cast<uint16_t>(0u),
                             [](const uint16_t& a, const uint8_t& b) -> uint16_t
                             { return a + (b >> 4); });
 
-         row.level_.resize(binCount);
+         if (r == 0)
+         {
+            // Rows are typically the same size
+            p->level_.reserve(static_cast<size_t>(binCount) *
+                              p->numberOfRows_);
+         }
+
+         row.levelOffset_ = p->level_.size();
+         row.levelSize_   = binCount;
+         p->level_.resize(row.levelOffset_ + binCount);
 
-         uint16_t b = 0;
-         for (auto it = row.data_.cbegin(); it != row.data_.cend(); it++)
+         uint8_t* level = p->level_.data() + row.levelOffset_;
+         for (auto it = rleData.cbegin(); it != rleData.cend(); it++)
          {
-            uint8_t run   = *it >> 4;
-            uint8_t level = *it & 0x0f;
+            uint8_t run = *it >> 4;
 
-            for (int i = 0; i < run && b < binCount; i++)
-            {
-               row.level_[b++] = level;
-            }
+            std::fill_n(level, run, static_cast<uint8_t>(*it & 0x0f));
+            level += run;
          }
       }
    }
@@ -75,6 +75,7 @@ set(HDR_PROVIDER include/scwx/provider/aws_level2_data_provider.hpp
                  include/scwx/provider/nexrad_data_provider.hpp
                  include/scwx/provider/nexrad_data_provider_factory.hpp
                  include/scwx/provider/nws_api_provider.hpp
+                 include/scwx/provider/object_cache.hpp
                  include/scwx/provider/warnings_provider.hpp)
 set(SRC_PROVIDER source/scwx/provider/aws_level2_data_provider.cpp
                  source/scwx/provider/aws_level2_chunks_data_provider.cpp
@@ -84,6 +85,7 @@ set(SRC_PROVIDER source/scwx/provider/aws_level2_data_provider.cpp
                  source/scwx/provider/nexrad_data_provider.cpp
                  source/scwx/provider/nexrad_data_provider_factory.cpp
                  source/scwx/provider/nws_api_provider.cpp
+                 source/scwx/provider/object_cache.cpp
                  source/scwx/provider/warnings_provider.cpp)
 set(HDR_TYPES include/scwx/types/iem_types.hpp
               include/scwx/types/ntp_types.hpp
@@ -91,7 +93,8 @@ set(HDR_TYPES include/scwx/types/iem_types.hpp
 set(SRC_TYPES source/scwx/types/iem_types.cpp
               source/scwx/types/ntp_types.cpp
               source/scwx/types/nws_types.cpp)
-set(HDR_UTIL include/scwx/util/digest.hpp
+set(HDR_UTIL include/scwx/util/arenabuf.hpp
+             include/scwx/util/digest.hpp
              include/scwx/util/enum.hpp
              include/scwx/util/environment.hpp
              include/scwx/util/float.hpp
@@ -103,10 +106,12 @@ set(HDR_UTIL include/scwx/util/digest.hpp
              include/scwx/util/rangebuf.hpp
              include/scwx/util/streams.hpp
              include/scwx/util/strings.hpp
+             include/scwx/util/task_graph.hpp
              include/scwx/util/threads.hpp
              include/scwx/util/time.hpp
              include/scwx/util/vectorbuf.hpp)
-set(SRC_UTIL source/scwx/util/digest.cpp
+set(SRC_UTIL source/scwx/util/arenabuf.cpp
+             source/scwx/util/digest.cpp
              source/scwx/util/environment.cpp
              source/scwx/util/float.cpp
              source/scwx/util/hash.cpp
@@ -115,6 +120,7 @@ set(SRC_UTIL source/scwx/util/digest.cpp
              source/scwx/util/rangebuf.cpp
              source/scwx/util/streams.cpp
              source/scwx/util/strings.cpp
+             source/scwx/util/task_graph.cpp
              source/scwx/util/time.cpp
              source/scwx/util/threads.cpp
              source/scwx/util/vectorbuf.cpp)